@@ -9,6 +9,7 @@
 
 #include "ErrOutputter.h"
 
+#include <atomic>
 #include <stdint.h>
 #include <string>
 #include <map>
@@ -172,6 +173,77 @@ public:
   virtual bool Consume(const PdscMsg& msg, const std::string& fileName) = 0;
 };
 
+/**
+ * @brief captures messages issued by a thread between Start() and Stop().
+ * Used by worker threads to buffer messages which are then replayed in deterministic order.
+*/
+class ErrLogCapture
+{
+public:
+  /**
+   * @brief constructor
+  */
+  ErrLogCapture();
+
+  /**
+   * @brief destructor, stops capturing if still active
+  */
+  ~ErrLogCapture();
+
+  /**
+   * @brief starts capturing messages issued by the calling thread
+  */
+  void Start();
+
+  /**
+   * @brief stops capturing messages, must be called by the thread that called Start()
+  */
+  void Stop();
+
+  /**
+   * @brief stores a message if the calling thread captures messages
+   * @param msg message object
+   * @param fileName name of the currently processed file
+   * @return true if the message is captured and should not be processed in the regular way
+  */
+  static bool Capture(const PdscMsg& msg, const std::string& fileName);
+
+  /**
+   * @brief processes captured messages in the calling thread in the order they were issued
+  */
+  void Replay() const;
+
+  /**
+   * @brief moves messages captured by another capture into this one ordered by line number,
+   *        a message without line number stays in front of the next message of its capture,
+   *        on equal line numbers messages of this capture come first
+   * @param other capture to take messages from, must not capture anymore
+  */
+  void Merge(ErrLogCapture& other);
+
+  /**
+   * @brief check if any message is captured
+   * @return true if no message is captured
+  */
+  bool IsEmpty() const { return m_messages.empty(); }
+
+  /**
+   * @brief getter for captured messages
+   * @return list of captured messages with the name of the file processed when the message was issued
+  */
+  const std::list<std::pair<PdscMsg, std::string> >& GetMessages() const { return m_messages; }
+
+private:
+  ErrLogCapture(const ErrLogCapture&) = delete;
+  ErrLogCapture& operator=(const ErrLogCapture&) = delete;
+
+  std::list<std::pair<PdscMsg, std::string> > m_messages;
+  ErrLogCapture* m_prev;
+  bool m_active;
+
+  static thread_local ErrLogCapture* theCapture;
+};
+
 /**
  * @brief message logger. Can handle program output and error messages on different levels.
 */
@@ -194,19 +266,20 @@ public:
    * @return pointer to class
   */
   static ErrLog* Get() {
-    if (!theErrLog) {
-      theErrLog = new ErrLog();
+    ErrLog* errLog = theErrLog;
+    if (!errLog) {
+      errLog = Create();
     }
-    return theErrLog;
+    return errLog;
   }
 
   /**
    * @brief singleton operation: destroys global application object
   */
   static void Destroy() {
-    if (theErrLog) {
-      delete theErrLog;
-      theErrLog = nullptr;
+    ErrLog* errLog = theErrLog.exchange(nullptr);
+    if (errLog) {
+      delete errLog;
     }
   }
 
@@ -222,13 +295,13 @@ public:
   virtual void InitMessageTable();
 
   /**
-   * @brief get current message consumer (redirection of messages)
+   * @brief get current message consumer (redirection of messages) of the calling thread
    * @return current message consumer
   */
   IErrConsumer* GetErrConsumer() const { return m_ErrConsumer; }
 
   /**
-   * @brief set a new message consumer (redirection of messages)
+   * @brief set a new message consumer (redirection of messages) for the calling thread
    * @param errConsumer new message consumer
    * @return previous message consumer
   */
@@ -383,11 +456,17 @@ public:
   void          SetLevelToError       ()                                { SetLevel(MsgLevel::LEVEL_ERROR);          }
 
   /**
-   * @brief sets the name of the currently processed file
+   * @brief sets the name of the file currently processed by the calling thread
    * @param fileName the name of the currently processed file
   */
   void          SetFileName           (const std::string &fileName)     { m_fileName = fileName;                    }
 
+  /**
+   * @brief gets the name of the file currently processed by the calling thread
+   * @return the name of the currently processed file
+  */
+  const std::string& GetFileName      () const                          { return m_fileName;                        }
+
   /**
    * @brief build and print whole message
    * @param msg message object
@@ -503,7 +582,7 @@ public:
 
 protected:
   char*                   m_outBuf;
-  IErrConsumer*           m_ErrConsumer;     // not deleted in destructor
+  static thread_local IErrConsumer* m_ErrConsumer; // per thread, not deleted in destructor
   ErrOutputter*           m_ErrOutputter;    // gets deleted in destructor!
 
   bool                    m_quietMode;
@@ -511,9 +590,9 @@ protected:
 
   MsgLevel                m_msgOutLevel;
   bool                    m_tmpLevelVerbose;
-  std::string             m_fileName;
-  int                     m_errCnt;
-  int                     m_warnCnt;
+  static thread_local std::string m_fileName;  // per thread
+  std::atomic<int>        m_errCnt;
+  std::atomic<int>        m_warnCnt;
   std::set<std::string>   m_diagSuppressMsg;
   std::set<std::string>   m_diagShowOnlyMsg;
 
@@ -530,8 +609,14 @@ private:
     ~ErrLogDestroyer() { ErrLog::Destroy(); }
   };
 
+  /**
+   * @brief creates global application object if not yet done, can be called concurrently
+   * @return pointer to class
+  */
+  static ErrLog* Create();
+
   static ErrLogDestroyer theErrLogDestroyer;
-  static ErrLog* theErrLog;  // the application-wide ErrLog Object
+  static std::atomic<ErrLog*> theErrLog;  // the application-wide ErrLog Object
 
   static const MsgTable msgTable;
   static const MsgTableStrict msgStrictTable;
@@ -9,16 +9,23 @@
 #include <cstdio>
 #include <cstring>
 #include <cstdarg>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
 using namespace std;
 
 const string ErrLog::NEW_LINE_STRING = "\n";
 
 ErrLog::ErrLogDestroyer ErrLog::theErrLogDestroyer;
-ErrLog* ErrLog::theErrLog = nullptr;  // the application-wide ErrLog Object
+atomic<ErrLog*> ErrLog::theErrLog(nullptr);  // the application-wide ErrLog Object
+thread_local IErrConsumer* ErrLog::m_ErrConsumer = nullptr;
+thread_local string ErrLog::m_fileName;
+thread_local ErrLogCapture* ErrLogCapture::theCapture = nullptr;
 MsgTable PdscMsg::m_messageTable;
 MsgTableStrict PdscMsg::m_messageTableStrict;
-MsgLevel g_msgLevel;
+thread_local MsgLevel g_msgLevel;
+static mutex theOutputMutex;  // serializes output of messages issued by concurrent threads
 
 
 const string& PdscMsg::GetSubstitute(const string &key) const
@@ -28,7 +35,7 @@ const string& PdscMsg::GetSubstitute(const string &key) const
     return it->second;
   }
 
-  static string errStr;
+  static thread_local string errStr;
   errStr = "<";
   errStr += key;
   errStr += ">";
@@ -138,7 +145,6 @@ void PdscMsg::AddMessagesStrict(const MsgTableStrict& table)
 
 ErrLog::ErrLog ():
 m_outBuf(0),
-m_ErrConsumer(nullptr),
 m_ErrOutputter(nullptr),
 m_quietMode(false),
 m_strictMode(false),
@@ -153,12 +159,12 @@ m_allowSuppressError (false)
 {
   m_outBuf = new char[OUTBUF_SIZE];
 
+  InitLevelStrTable();
+  InitMessageTable();
+
   if(!theErrLog){
     theErrLog = this;
   }
-
-  InitLevelStrTable();
-  InitMessageTable();
 }
 
 
@@ -180,6 +186,16 @@ ErrLog::~ErrLog ()
   delete[] m_outBuf;
 }
 
+ErrLog* ErrLog::Create()
+{
+  static mutex createMutex;
+  lock_guard<mutex> lock(createMutex);
+  if(!theErrLog) {
+    new ErrLog(); // registers itself as theErrLog
+  }
+  return theErrLog;
+}
+
 void ErrLog::InitMessageTable()
 {
   PdscMsg::AddMessages(msgTable);
@@ -506,7 +522,11 @@ bool ErrLog::SuppressMessage (const std::string &msgNum)
 
 void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
 {
-  static int prevWasMsg = 0, prevSuppressed = 0;
+  static thread_local int prevWasMsg = 0, prevSuppressed = 0;
+
+  if(ErrLogCapture::Capture(msg, m_fileName)) {
+    return;
+  }
 
   MsgLevel msgLevel = msg.GetMsgLevel ();
   g_msgLevel = msgLevel;
@@ -547,6 +567,7 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
     return;
   }
 
+  lock_guard<mutex> lock(theOutputMutex);
   prevSuppressed = 0;
   int lineNo = msg.GetLineNo();
   unsigned doCRLF = msg.GetCrLf();
@@ -611,6 +632,98 @@ int ErrLog::WillMsgPrint(const string &num) const
   return 0;
 }
 
+ErrLogCapture::ErrLogCapture() :
+  m_prev(nullptr),
+  m_active(false)
+{
+}
+
+ErrLogCapture::~ErrLogCapture()
+{
+  Stop();
+}
+
+void ErrLogCapture::Start()
+{
+  if(m_active) {
+    return;
+  }
+  m_prev = theCapture;
+  theCapture = this;
+  m_active = true;
+}
+
+void ErrLogCapture::Stop()
+{
+  if(!m_active) {
+    return;
+  }
+  if(theCapture == this) {
+    theCapture = m_prev;
+  }
+  m_prev = nullptr;
+  m_active = false;
+}
+
+bool ErrLogCapture::Capture(const PdscMsg& msg, const string& fileName)
+{
+  if(!theCapture) {
+    return false;
+  }
+
+  theCapture->m_messages.push_back(make_pair(msg, fileName));
+  return true;
+}
+
+void ErrLogCapture::Replay() const
+{
+  if(theCapture == this) {
+    return; // still capturing in this thread
+  }
+  ErrLog* errLog = ErrLog::Get();
+  const string prevFileName = errLog->GetFileName();
+  for(auto& [msg, fileName] : m_messages) {
+    errLog->SetFileName(fileName);
+    errLog->PDSC_PrintMessage(msg);
+  }
+  errLog->SetFileName(prevFileName);
+}
+
+void ErrLogCapture::Merge(ErrLogCapture& other)
+{
+  if(&other == this || other.m_messages.empty()) {
+    return;
+  }
+  // sort key of a message without line number is the line of the next message of the same capture
+  auto getLines = [](const list<pair<PdscMsg, string> >& messages) {
+    vector<int32_t> lines(messages.size(), INT32_MAX);
+    int32_t nextLine = INT32_MAX;
+    size_t index = messages.size();
+    for(auto it = messages.rbegin(); it != messages.rend(); it++) {
+      if(it->first.GetLineNo() >= 0) {
+        nextLine = it->first.GetLineNo();
+      }
+      lines[--index] = nextLine;
+    }
+    return lines;
+  };
+  const vector<int32_t> lines = getLines(m_messages);
+  const vector<int32_t> otherLines = getLines(other.m_messages);
+
+  auto it = m_messages.begin();
+  size_t index = 0;
+  size_t otherIndex = 0;
+  while(!other.m_messages.empty()) {
+    if(it == m_messages.end() || otherLines[otherIndex] < lines[index]) {
+      m_messages.splice(it, other.m_messages, other.m_messages.begin());
+      otherIndex++;
+    } else {
+      it++;
+      index++;
+    }
+  }
+}
+
 // Utils
 string ErrLog::CreateDecNum(unsigned int num)
 {
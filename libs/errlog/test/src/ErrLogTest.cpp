@@ -13,6 +13,7 @@
 #include <vector>
 #include <list>
 #include <string>
+#include <thread>
 
 using namespace std;
 
@@ -110,3 +111,78 @@ TEST_F(ErrLogTest, PdscMessage) {
   ErrLog::Get()->Save();
   ErrLog::Get()->ClearLogMessages();
 }
+
+TEST_F(ErrLogTest, CaptureAndReplay) {
+  ErrLog::Get()->ClearLogMessages();
+  ErrLog::Get()->SetFileName("Main.test");
+
+  list<string> threadMessages;
+  ErrLogCapture capture;
+  thread worker([&]() {
+    capture.Start();
+    ErrLog::Get()->SetFileName("Capture.test");
+    LogMsg("M017", MSG(" captured "), 3, 0);
+    capture.Stop();
+    threadMessages = ErrLog::Get()->GetLogMessages();
+  });
+  worker.join();
+  // nothing is printed while capturing
+  EXPECT_TRUE(threadMessages.empty());
+  EXPECT_TRUE(ErrLog::Get()->GetLogMessages().empty());
+  EXPECT_FALSE(capture.IsEmpty());
+  EXPECT_EQ(ErrLog::Get()->GetErrCnt(), 0);
+
+  capture.Replay();
+  static const list<string> testMessages = {
+    "\n",
+    "\n",
+    "*** ERROR M017:",
+    " Capture.test",
+    " (Line 3) ",
+    "\n  ",
+    "An Error Message ( captured ) cannot be suppressed."
+  };
+  CompareMessages(ErrLog::Get()->GetLogMessages(), testMessages);
+  EXPECT_EQ(ErrLog::Get()->GetErrCnt(), 1);
+  // file name of calling thread is restored
+  EXPECT_EQ(ErrLog::Get()->GetFileName(), "Main.test");
+  ErrLog::Get()->ClearLogMessages();
+}
+
+TEST_F(ErrLogTest, CaptureMerge) {
+  ErrLog::Get()->ClearLogMessages();
+  ErrLog::Get()->SetFileName("Merge.test");
+
+  ErrLogCapture first;
+  first.Start();
+  LogMsg("M017", MSG(" header "));
+  LogMsg("M017", MSG(" first 10 "), 10, 0);
+  LogMsg("M017", MSG(" first 30 "), 30, 0);
+  LogMsg("M017", MSG(" trailer "));
+  first.Stop();
+
+  ErrLogCapture second;
+  second.Start();
+  LogMsg("M017", MSG(" second 5 "), 5, 0);
+  LogMsg("M017", MSG(" second 20 "), 20, 0);
+  LogMsg("M017", MSG(" second 30 "), 30, 0);
+  LogMsg("M017", MSG(" second 40 "), 40, 0);
+  second.Stop();
+
+  first.Merge(second);
+  EXPECT_TRUE(second.IsEmpty());
+  first.Replay();
+
+  vector<string> order;
+  for (const auto& message : ErrLog::Get()->GetLogMessages()) {
+    const size_t pos = message.find('(');
+    if (message.find("An Error Message") == 0 && pos != string::npos) {
+      order.push_back(message.substr(pos + 2, message.find(')') - pos - 3));
+    }
+  }
+  static const vector<string> expected = {
+    "second 5", "header", "first 10", "second 20", "first 30", "second 30", "second 40", "trailer"
+  };
+  EXPECT_EQ(expected, order);
+  ErrLog::Get()->ClearLogMessages();
+}
@@ -0,0 +1,150 @@
+#ifndef RteZipArchive_H
+#define RteZipArchive_H
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                          */
+/******************************************************************************/
+/** @file  RteZipArchive.h
+  * @brief read-only access to ZIP archives, e.g. *.pack files
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief read-only virtual file system of a ZIP archive
+ *
+ * The archive is memory mapped and only its central directory is read on Open(), entry names are kept in hash
+ * indexes. Paths are relative to the archive root, use '/' or '\' as separators and may contain '.' and '..'
+ * segments. Entries are decompressed on ReadFile() only, stored and deflated entries are supported.
+ * All const methods can be called concurrently.
+*/
+class RteZipArchive
+{
+public:
+  /**
+   * @brief default constructor
+  */
+  RteZipArchive();
+
+  /**
+   * @brief destructor, closes the archive
+  */
+  ~RteZipArchive();
+
+  /**
+   * @brief open an archive and read its central directory
+   * @param fileName archive file name
+   * @return true if the archive is opened, false if the file cannot be mapped or is not a ZIP archive
+  */
+  bool Open(const std::string& fileName);
+
+  /**
+   * @brief close the archive
+  */
+  void Close();
+
+  /**
+   * @brief check if an archive is opened
+   * @return true if opened
+  */
+  bool IsOpen() const { return m_data != nullptr; }
+
+  /**
+   * @brief getter for the archive file name
+   * @return archive file name passed to Open()
+  */
+  const std::string& GetFileName() const { return m_fileName; }
+
+  /**
+   * @brief getter for the number of files in the archive
+   * @return number of file entries
+  */
+  size_t GetFileCount() const { return m_files.size(); }
+
+  /**
+   * @brief check if a file or directory exists in the archive
+   * @param path path relative to archive root
+   * @return true if exists
+  */
+  bool Exists(const std::string& path) const;
+
+  /**
+   * @brief check if a path is a directory in the archive, the root is a directory
+   * @param path path relative to archive root
+   * @return true if path is a directory
+  */
+  bool IsDirectory(const std::string& path) const;
+
+  /**
+   * @brief check if a path is a file in the archive
+   * @param path path relative to archive root
+   * @return true if path is a file
+  */
+  bool IsRegularFile(const std::string& path) const;
+
+  /**
+   * @brief case-insensitive lookup of a file or directory
+   * @param path path relative to archive root
+   * @param exactPath returns the normalized path as written in the archive
+   * @return true if found
+  */
+  bool GetExactPath(const std::string& path, std::string& exactPath) const;
+
+  /**
+   * @brief list the names of files and directories contained in a directory
+   * @param dir directory relative to archive root, empty for the root
+   * @param names returns the names in archive order
+   * @return true if dir is a directory
+  */
+  bool List(const std::string& dir, std::vector<std::string>& names) const;
+
+  /**
+   * @brief read a file from the archive
+   * @param path path relative to archive root
+   * @param content returns decompressed file content
+   * @return true if the file is read and its checksum matches
+  */
+  bool ReadFile(const std::string& path, std::string& content) const;
+
+  /**
+   * @brief normalize a path relative to archive root: use '/' as separator, remove '.' and resolve '..' segments
+   * @param path path to normalize
+   * @param normalized returns normalized path without leading and trailing separators
+   * @return false if the path leaves the archive root
+  */
+  static bool NormalizePath(const std::string& path, std::string& normalized);
+
+private:
+  struct Entry {
+    uint64_t offset;         // offset of local file header
+    uint64_t compressedSize;
+    uint64_t size;
+    uint32_t crc;
+    uint16_t method;
+    uint16_t flags;
+  };
+
+  bool ReadCentralDirectory();
+  void AddPath(const std::string& path, bool isDir);
+
+  RteZipArchive(const RteZipArchive&) = delete;
+  RteZipArchive& operator=(const RteZipArchive&) = delete;
+
+  std::string m_fileName;
+  const uint8_t* m_data;
+  size_t m_size;
+  std::unordered_map<std::string, Entry> m_files;
+  std::unordered_map<std::string, std::vector<std::string> > m_dirs;    // directory -> contained names
+  std::unordered_map<std::string, std::string> m_lowerCasePaths;       // lower case path -> exact path
+};
+
+#endif // RteZipArchive_H
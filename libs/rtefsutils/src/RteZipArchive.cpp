@@ -0,0 +1,704 @@
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                          */
+/******************************************************************************/
+/** @file  RteZipArchive.cpp
+  * @brief read-only access to ZIP archives, e.g. *.pack files
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 AND Zlib
+ */
+/******************************************************************************/
+
+#include "RteZipArchive.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// record signatures
+static constexpr uint32_t SIG_LOCAL_HEADER = 0x04034b50;
+static constexpr uint32_t SIG_CENTRAL_HEADER = 0x02014b50;
+static constexpr uint32_t SIG_END_OF_CENTRAL_DIR = 0x06054b50;
+static constexpr uint32_t SIG_ZIP64_END_OF_CENTRAL_DIR = 0x06064b50;
+static constexpr uint32_t SIG_ZIP64_LOCATOR = 0x07064b50;
+
+// record sizes without variable length fields
+static constexpr size_t LOCAL_HEADER_SIZE = 30;
+static constexpr size_t CENTRAL_HEADER_SIZE = 46;
+static constexpr size_t END_OF_CENTRAL_DIR_SIZE = 22;
+static constexpr size_t ZIP64_END_OF_CENTRAL_DIR_SIZE = 56;
+static constexpr size_t ZIP64_LOCATOR_SIZE = 20;
+
+static constexpr uint16_t METHOD_STORED = 0;
+static constexpr uint16_t METHOD_DEFLATED = 8;
+static constexpr uint16_t FLAG_ENCRYPTED = 0x0001;
+static constexpr uint16_t EXTRA_ZIP64 = 0x0001;
+
+static uint16_t Read16(const uint8_t* p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t Read32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+    (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static uint64_t Read64(const uint8_t* p) {
+  return static_cast<uint64_t>(Read32(p)) | (static_cast<uint64_t>(Read32(p + 4)) << 32);
+}
+
+static string ToLower(const string& s) {
+  string lower(s);
+  transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+  return lower;
+}
+
+// maximum compression ratio of DEFLATE: a 258 bytes match is coded in at least two bits
+static constexpr uint64_t MAX_DEFLATE_RATIO = 1032;
+
+static uint32_t Crc32(const uint8_t* data, size_t size) {
+  static const array<uint32_t, 256> table = []() {
+    array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      t[i] = c;
+    }
+    return t;
+  }();
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; i++) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+/*
+ * The Inflater class is an altered version of puff.c, the reference DEFLATE decoder
+ * distributed with zlib (contrib/puff), adapted to C++ and to decode into a string
+ * with an output size limit. The original notice of puff.h applies to this class:
+ *
+ * Copyright (C) 2002-2013 Mark Adler, all rights reserved
+ * version 2.3, 21 Jan 2013
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the author be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ * Mark Adler    madler@alumni.caltech.edu
+ */
+
+/**
+ * @brief decoder for raw DEFLATE streams (RFC 1951) using canonical Huffman decoding
+*/
+class Inflater
+{
+public:
+  /**
+   * @brief constructor
+   * @param in pointer to compressed data
+   * @param inSize size of compressed data
+   * @param out string to append decompressed data to
+   * @param outLimit maximum size of out, decoding fails if the stream produces more data
+  */
+  Inflater(const uint8_t* in, size_t inSize, string& out, size_t outLimit) :
+    m_in(in), m_inSize(inSize), m_inPos(0), m_bitBuf(0), m_bitCnt(0), m_error(false), m_out(out), m_outLimit(outLimit) {}
+
+  bool Run() {
+    bool last = false;
+    while (!last && !m_error) {
+      last = Bits(1) != 0;
+      const int type = Bits(2);
+      bool ok = false;
+      switch (type) {
+        case 0: ok = Stored(); break;
+        case 1: ok = Fixed(); break;
+        case 2: ok = Dynamic(); break;
+        default: break;
+      }
+      if (!ok) {
+        return false;
+      }
+    }
+    return !m_error;
+  }
+
+private:
+  static constexpr int MAX_BITS = 15;
+  static constexpr int MAX_LCODES = 286;
+  static constexpr int MAX_DCODES = 30;
+  static constexpr int FIX_LCODES = 288;
+
+  struct Huffman {
+    uint16_t count[MAX_BITS + 1];
+    uint16_t symbol[FIX_LCODES];
+  };
+
+  int Bits(int need) {
+    uint32_t val = m_bitBuf;
+    while (m_bitCnt < need) {
+      if (m_inPos >= m_inSize) {
+        m_error = true;
+        return 0;
+      }
+      val |= static_cast<uint32_t>(m_in[m_inPos++]) << m_bitCnt;
+      m_bitCnt += 8;
+    }
+    m_bitBuf = val >> need;
+    m_bitCnt -= need;
+    return static_cast<int>(val & ((1u << need) - 1));
+  }
+
+  bool Stored() {
+    m_bitBuf = 0;     // skip to byte boundary
+    m_bitCnt = 0;
+    if (m_inPos + 4 > m_inSize) {
+      return false;
+    }
+    const unsigned len = Read16(m_in + m_inPos);
+    const unsigned nlen = Read16(m_in + m_inPos + 2);
+    m_inPos += 4;
+    if (len != (~nlen & 0xFFFF) || m_inPos + len > m_inSize || len > m_outLimit - m_out.size()) {
+      return false;
+    }
+    m_out.append(reinterpret_cast<const char*>(m_in + m_inPos), len);
+    m_inPos += len;
+    return true;
+  }
+
+  int Decode(const Huffman& h) {
+    int code = 0;    // bits being decoded
+    int first = 0;   // first code of length len
+    int index = 0;   // index of first code of length len in symbol table
+    for (int len = 1; len <= MAX_BITS; len++) {
+      code |= Bits(1);
+      if (m_error) {
+        return -1;
+      }
+      const int count = h.count[len];
+      if (code - count < first) {
+        return h.symbol[index + (code - first)];
+      }
+      index += count;
+      first += count;
+      first <<= 1;
+      code <<= 1;
+    }
+    return -1;     // ran out of codes
+  }
+
+  // returns 0 for a complete code, > 0 for an incomplete code, < 0 for an over-subscribed code
+  static int Construct(Huffman& h, const uint16_t* length, int n) {
+    memset(h.count, 0, sizeof(h.count));
+    for (int symbol = 0; symbol < n; symbol++) {
+      h.count[length[symbol]]++;
+    }
+    if (h.count[0] == n) {
+      return 0;    // no codes, complete but decoding fails
+    }
+    int left = 1;
+    for (int len = 1; len <= MAX_BITS; len++) {
+      left <<= 1;
+      left -= h.count[len];
+      if (left < 0) {
+        return left;
+      }
+    }
+    uint16_t offs[MAX_BITS + 1];
+    offs[1] = 0;
+    for (int len = 1; len < MAX_BITS; len++) {
+      offs[len + 1] = offs[len] + h.count[len];
+    }
+    for (int symbol = 0; symbol < n; symbol++) {
+      if (length[symbol] != 0) {
+        h.symbol[offs[length[symbol]]++] = static_cast<uint16_t>(symbol);
+      }
+    }
+    return left;
+  }
+
+  bool Codes(const Huffman& lencode, const Huffman& distcode) {
+    static const uint16_t lbase[29] = {
+      3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const uint16_t lext[29] = {
+      0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const uint16_t dbase[30] = {
+      1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+      1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const uint16_t dext[30] = {
+      0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    for (;;) {
+      int symbol = Decode(lencode);
+      if (symbol < 0) {
+        return false;
+      }
+      if (symbol < 256) {
+        if (m_out.size() >= m_outLimit) {
+          return false;
+        }
+        m_out.push_back(static_cast<char>(symbol));
+      } else if (symbol == 256) {
+        return true;   // end of block
+      } else {
+        symbol -= 257;
+        if (symbol >= 29) {
+          return false;
+        }
+        const size_t len = lbase[symbol] + Bits(lext[symbol]);
+        symbol = Decode(distcode);
+        if (symbol < 0 || symbol >= MAX_DCODES) {
+          return false;
+        }
+        const size_t dist = dbase[symbol] + Bits(dext[symbol]);
+        if (m_error || dist > m_out.size() || len > m_outLimit - m_out.size()) {
+          return false;
+        }
+        // copy byte by byte: source and destination may overlap
+        for (size_t i = 0, from = m_out.size() - dist; i < len; i++) {
+          m_out.push_back(m_out[from + i]);
+        }
+      }
+    }
+  }
+
+  bool Fixed() {
+    static Huffman lencode, distcode;
+    static const bool initialized = []() {
+      uint16_t lengths[FIX_LCODES];
+      int symbol = 0;
+      for (; symbol < 144; symbol++) lengths[symbol] = 8;
+      for (; symbol < 256; symbol++) lengths[symbol] = 9;
+      for (; symbol < 280; symbol++) lengths[symbol] = 7;
+      for (; symbol < FIX_LCODES; symbol++) lengths[symbol] = 8;
+      Construct(lencode, lengths, FIX_LCODES);
+      for (symbol = 0; symbol < MAX_DCODES; symbol++) lengths[symbol] = 5;
+      Construct(distcode, lengths, MAX_DCODES);
+      return true;
+    }();
+    return initialized && Codes(lencode, distcode);
+  }
+
+  bool Dynamic() {
+    static const uint16_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    const int nlen = Bits(5) + 257;
+    const int ndist = Bits(5) + 1;
+    const int ncode = Bits(4) + 4;
+    if (m_error || nlen > MAX_LCODES || ndist > MAX_DCODES) {
+      return false;
+    }
+
+    uint16_t lengths[MAX_LCODES + MAX_DCODES] = {};
+    for (int index = 0; index < ncode; index++) {
+      lengths[order[index]] = static_cast<uint16_t>(Bits(3));
+    }
+    Huffman lencode, distcode;
+    if (m_error || Construct(lencode, lengths, 19) != 0) {
+      return false;    // code lengths code must be complete
+    }
+
+    for (int index = 0; index < nlen + ndist;) {
+      int symbol = Decode(lencode);
+      if (symbol < 0) {
+        return false;
+      }
+      if (symbol < 16) {
+        lengths[index++] = static_cast<uint16_t>(symbol);
+        continue;
+      }
+      uint16_t len = 0;
+      if (symbol == 16) {
+        if (index == 0) {
+          return false;
+        }
+        len = lengths[index - 1];
+        symbol = 3 + Bits(2);
+      } else if (symbol == 17) {
+        symbol = 3 + Bits(3);
+      } else {
+        symbol = 11 + Bits(7);
+      }
+      if (m_error || index + symbol > nlen + ndist) {
+        return false;
+      }
+      while (symbol--) {
+        lengths[index++] = len;
+      }
+    }
+    if (lengths[256] == 0) {
+      return false;    // no end-of-block code
+    }
+    // incomplete codes are only allowed for a single length 1 code
+    int err = Construct(lencode, lengths, nlen);
+    if (err < 0 || (err > 0 && nlen - lencode.count[0] != 1)) {
+      return false;
+    }
+    err = Construct(distcode, lengths + nlen, ndist);
+    if (err < 0 || (err > 0 && ndist - distcode.count[0] != 1)) {
+      return false;
+    }
+    return Codes(lencode, distcode);
+  }
+
+  const uint8_t* m_in;
+  size_t m_inSize;
+  size_t m_inPos;
+  uint32_t m_bitBuf;
+  int m_bitCnt;
+  bool m_error;
+  string& m_out;
+  size_t m_outLimit;
+};
+
+RteZipArchive::RteZipArchive() :
+  m_data(nullptr),
+  m_size(0)
+{
+}
+
+RteZipArchive::~RteZipArchive()
+{
+  RteZipArchive::Close();
+}
+
+bool RteZipArchive::Open(const string& fileName)
+{
+  Close();
+
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+#ifdef _WIN32
+  HANDLE file = CreateFileW(filesystem::path(fileName).wstring().c_str(), GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping) {
+        data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        size = data ? static_cast<size_t>(fileSize.QuadPart) : 0;
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+  }
+#else
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped != MAP_FAILED) {
+        data = static_cast<const uint8_t*>(mapped);
+        size = static_cast<size_t>(st.st_size);
+      }
+    }
+    close(fd);
+  }
+#endif
+  if (!data) {
+    return false;
+  }
+
+  m_fileName = fileName;
+  m_data = data;
+  m_size = size;
+  if (!ReadCentralDirectory()) {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void RteZipArchive::Close()
+{
+  if (m_data) {
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+  }
+  m_size = 0;
+  m_fileName.clear();
+  m_files.clear();
+  m_dirs.clear();
+  m_lowerCasePaths.clear();
+}
+
+bool RteZipArchive::ReadCentralDirectory()
+{
+  if (m_size < END_OF_CENTRAL_DIR_SIZE) {
+    return false;
+  }
+  // end of central directory record is followed by a comment of at most 64K
+  size_t eocd = m_size - END_OF_CENTRAL_DIR_SIZE;
+  const size_t lowest = eocd > 0xFFFF ? eocd - 0xFFFF : 0;
+  while (Read32(m_data + eocd) != SIG_END_OF_CENTRAL_DIR) {
+    if (eocd == lowest) {
+      return false;
+    }
+    eocd--;
+  }
+  uint64_t entryCount = Read16(m_data + eocd + 10);
+  uint64_t dirSize = Read32(m_data + eocd + 12);
+  uint64_t dirOffset = Read32(m_data + eocd + 16);
+
+  if (eocd >= ZIP64_LOCATOR_SIZE && Read32(m_data + eocd - ZIP64_LOCATOR_SIZE) == SIG_ZIP64_LOCATOR) {
+    const uint64_t zip64Eocd = Read64(m_data + eocd - ZIP64_LOCATOR_SIZE + 8);
+    if (m_size < ZIP64_END_OF_CENTRAL_DIR_SIZE || zip64Eocd > m_size - ZIP64_END_OF_CENTRAL_DIR_SIZE ||
+      Read32(m_data + zip64Eocd) != SIG_ZIP64_END_OF_CENTRAL_DIR) {
+      return false;
+    }
+    entryCount = Read64(m_data + zip64Eocd + 32);
+    dirSize = Read64(m_data + zip64Eocd + 40);
+    dirOffset = Read64(m_data + zip64Eocd + 48);
+  }
+  if (dirOffset > m_size || dirSize > m_size - dirOffset) {
+    return false;
+  }
+
+  m_dirs[""];   // root
+  const uint8_t* p = m_data + dirOffset;
+  const uint8_t* end = p + dirSize;
+  for (uint64_t i = 0; i < entryCount; i++) {
+    if (end - p < static_cast<ptrdiff_t>(CENTRAL_HEADER_SIZE) || Read32(p) != SIG_CENTRAL_HEADER) {
+      return false;
+    }
+    Entry entry;
+    entry.flags = Read16(p + 8);
+    entry.method = Read16(p + 10);
+    entry.crc = Read32(p + 16);
+    entry.compressedSize = Read32(p + 20);
+    entry.size = Read32(p + 24);
+    const size_t nameLen = Read16(p + 28);
+    const size_t extraLen = Read16(p + 30);
+    const size_t commentLen = Read16(p + 32);
+    entry.offset = Read32(p + 42);
+    if (static_cast<size_t>(end - p) < CENTRAL_HEADER_SIZE + nameLen + extraLen + commentLen) {
+      return false;
+    }
+    const string name(reinterpret_cast<const char*>(p + CENTRAL_HEADER_SIZE), nameLen);
+
+    // 64-bit values replace the 32-bit fields set to 0xFFFFFFFF in this order
+    const uint8_t* extra = p + CENTRAL_HEADER_SIZE + nameLen;
+    const uint8_t* extraEnd = extra + extraLen;
+    while (extraEnd - extra >= 4) {
+      const uint16_t id = Read16(extra);
+      const uint16_t len = Read16(extra + 2);
+      const uint8_t* field = extra + 4;
+      if (extraEnd - field < len) {
+        break;
+      }
+      if (id == EXTRA_ZIP64) {
+        const uint8_t* fieldEnd = field + len;
+        for (uint64_t* value : { &entry.size, &entry.compressedSize, &entry.offset }) {
+          if (*value == 0xFFFFFFFF && fieldEnd - field >= 8) {
+            *value = Read64(field);
+            field += 8;
+          }
+        }
+      }
+      extra += 4 + len;
+    }
+    p += CENTRAL_HEADER_SIZE + nameLen + extraLen + commentLen;
+
+    string path;
+    if (!NormalizePath(name, path) || path.empty()) {
+      continue;    // entries outside of the root are not accessible
+    }
+    const bool isDir = !name.empty() && (name.back() == '/' || name.back() == '\\');
+    if (!isDir) {
+      if (m_files.find(path) != m_files.end()) {
+        continue;  // first entry wins
+      }
+      m_files[path] = entry;
+    }
+    AddPath(path, isDir);
+  }
+  return true;
+}
+
+void RteZipArchive::AddPath(const string& path, bool isDir)
+{
+  if (isDir) {
+    if (!m_dirs.emplace(path, vector<string>()).second) {
+      return;      // already known
+    }
+  }
+  m_lowerCasePaths.emplace(ToLower(path), path);
+
+  const size_t pos = path.find_last_of('/');
+  const string parent = pos == string::npos ? string() : path.substr(0, pos);
+  const string name = pos == string::npos ? path : path.substr(pos + 1);
+  if (!parent.empty()) {
+    AddPath(parent, true);   // directories without own entry
+  }
+  m_dirs[parent].push_back(name);
+}
+
+bool RteZipArchive::NormalizePath(const string& path, string& normalized)
+{
+  vector<string> segments;
+  size_t start = 0;
+  while (start <= path.size()) {
+    size_t pos = path.find_first_of("/\\", start);
+    if (pos == string::npos) {
+      pos = path.size();
+    }
+    const string segment = path.substr(start, pos - start);
+    if (segment == "..") {
+      if (segments.empty()) {
+        return false;
+      }
+      segments.pop_back();
+    } else if (!segment.empty() && segment != ".") {
+      segments.push_back(segment);
+    }
+    start = pos + 1;
+  }
+  normalized.clear();
+  for (const auto& segment : segments) {
+    if (!normalized.empty()) {
+      normalized += '/';
+    }
+    normalized += segment;
+  }
+  return true;
+}
+
+bool RteZipArchive::Exists(const string& path) const
+{
+  string normalized;
+  if (!NormalizePath(path, normalized)) {
+    return false;
+  }
+  return m_dirs.find(normalized) != m_dirs.end() || m_files.find(normalized) != m_files.end();
+}
+
+bool RteZipArchive::IsDirectory(const string& path) const
+{
+  string normalized;
+  return NormalizePath(path, normalized) && m_dirs.find(normalized) != m_dirs.end();
+}
+
+bool RteZipArchive::IsRegularFile(const string& path) const
+{
+  string normalized;
+  return NormalizePath(path, normalized) && m_files.find(normalized) != m_files.end();
+}
+
+bool RteZipArchive::GetExactPath(const string& path, string& exactPath) const
+{
+  string normalized;
+  if (!NormalizePath(path, normalized)) {
+    return false;
+  }
+  if (normalized.empty()) {
+    exactPath.clear();
+    return IsOpen();
+  }
+  auto it = m_lowerCasePaths.find(ToLower(normalized));
+  if (it == m_lowerCasePaths.end()) {
+    return false;
+  }
+  exactPath = it->second;
+  return true;
+}
+
+bool RteZipArchive::List(const string& dir, vector<string>& names) const
+{
+  string normalized;
+  if (!NormalizePath(dir, normalized)) {
+    return false;
+  }
+  auto it = m_dirs.find(normalized);
+  if (it == m_dirs.end()) {
+    return false;
+  }
+  names = it->second;
+  return true;
+}
+
+bool RteZipArchive::ReadFile(const string& path, string& content) const
+{
+  content.clear();
+  string normalized;
+  if (!NormalizePath(path, normalized)) {
+    return false;
+  }
+  auto it = m_files.find(normalized);
+  if (it == m_files.end()) {
+    return false;
+  }
+  const Entry& entry = it->second;
+  if ((entry.flags & FLAG_ENCRYPTED) || entry.offset > m_size - LOCAL_HEADER_SIZE ||
+    Read32(m_data + entry.offset) != SIG_LOCAL_HEADER) {
+    return false;
+  }
+  // local name and extra field lengths may differ from the central directory
+  const uint64_t dataOffset = entry.offset + LOCAL_HEADER_SIZE +
+    Read16(m_data + entry.offset + 26) + Read16(m_data + entry.offset + 28);
+  if (dataOffset > m_size || entry.compressedSize > m_size - dataOffset) {
+    return false;
+  }
+  const uint8_t* data = m_data + dataOffset;
+  const size_t dataSize = static_cast<size_t>(entry.compressedSize);
+
+  if (entry.method == METHOD_STORED) {
+    content.assign(reinterpret_cast<const char*>(data), dataSize);
+  } else if (entry.method == METHOD_DEFLATED) {
+    // the header size is not trusted: it limits the output, the reserved size is limited by the data size
+    const size_t outLimit = static_cast<size_t>(min<uint64_t>(entry.size, SIZE_MAX));
+    content.reserve(static_cast<size_t>(min<uint64_t>(entry.size, dataSize * MAX_DEFLATE_RATIO)));
+    Inflater inflater(data, dataSize, content, outLimit);
+    if (!inflater.Run()) {
+      content.clear();
+      return false;
+    }
+  } else {
+    return false;   // unsupported compression method
+  }
+  if (content.size() != entry.size ||
+    Crc32(reinterpret_cast<const uint8_t*>(content.data()), content.size()) != entry.crc) {
+    content.clear();
+    return false;
+  }
+  return true;
+}
+
+// end of RteZipArchive.cpp
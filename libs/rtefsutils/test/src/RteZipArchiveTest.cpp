@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "gtest/gtest.h"
+#include "RteFsUtils.h"
+#include "RteZipArchive.h"
+
+#include <fstream>
+
+using namespace std;
+
+// archive with deflated and stored entries:
+// Vendor.Pack.pdsc, Include/, Include/Dev.h, Source/Main.c
+static const unsigned char testArchive[] = {
+  0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0x78, 0xa2,
+  0xc1, 0xde, 0x45, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x56, 0x65,
+  0x6e, 0x64, 0x6f, 0x72, 0x2e, 0x50, 0x61, 0x63, 0x6b, 0x2e, 0x70, 0x64, 0x73, 0x63, 0xb3, 0xb1,
+  0xaf, 0xc8, 0xcd, 0x51, 0x28, 0x4b, 0x2d, 0x2a, 0xce, 0xcc, 0xcf, 0xb3, 0x55, 0x32, 0xd4, 0x33,
+  0x50, 0xb2, 0xb7, 0xe3, 0xb2, 0x29, 0x48, 0x4c, 0xce, 0x4e, 0x4c, 0x4f, 0xb5, 0xe3, 0x52, 0x50,
+  0xb0, 0x49, 0xcb, 0xcc, 0x49, 0x55, 0xc8, 0x4b, 0xcc, 0x4d, 0xb5, 0x55, 0xf2, 0xcc, 0x4b, 0xce,
+  0x29, 0x4d, 0x49, 0xd5, 0x77, 0x49, 0x2d, 0xd3, 0xcb, 0x50, 0xd2, 0xa7, 0xb1, 0xb4, 0x8d, 0x3e,
+  0xdc, 0x19, 0x00, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+  0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x49, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x5a, 0xd1, 0x56, 0xf8, 0xbc, 0x0e, 0x00, 0x00, 0x00, 0x0e,
+  0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x44,
+  0x65, 0x76, 0x2e, 0x68, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x44, 0x45, 0x56, 0x20,
+  0x31, 0x0a, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a,
+  0xf1, 0x7b, 0x43, 0x6e, 0x1f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2f, 0x4d, 0x61, 0x69, 0x6e, 0x2e, 0x63, 0xcb, 0xcc, 0x2b,
+  0x51, 0xc8, 0x4d, 0xcc, 0xcc, 0xd3, 0x28, 0xcb, 0xcf, 0x4c, 0xd1, 0x54, 0xa8, 0x56, 0x28, 0x4a,
+  0x2d, 0x29, 0x2d, 0xca, 0x53, 0x30, 0xb0, 0x56, 0xa8, 0xe5, 0x02, 0x00, 0x50, 0x4b, 0x01, 0x02,
+  0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0x78, 0xa2, 0xc1, 0xde,
+  0x45, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x56, 0x65, 0x6e, 0x64, 0x6f, 0x72,
+  0x2e, 0x50, 0x61, 0x63, 0x6b, 0x2e, 0x70, 0x64, 0x73, 0x63, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x01, 0x73, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f,
+  0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x5a,
+  0xd1, 0x56, 0xf8, 0xbc, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x99, 0x00, 0x00, 0x00, 0x49, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x44, 0x65, 0x76, 0x2e, 0x68, 0x50, 0x4b, 0x01, 0x02, 0x14,
+  0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0xf1, 0x7b, 0x43, 0x6e, 0x1f,
+  0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x01, 0xd2, 0x00, 0x00, 0x00, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2f,
+  0x4d, 0x61, 0x69, 0x6e, 0x2e, 0x63, 0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0xea, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00,
+};
+
+// archive with deflated entries:
+// Stored.txt: three stored blocks, Blocks.txt: compressed blocks separated by empty stored blocks,
+// Limit.txt: inflates to more data than the header size, Huge.txt: header size larger than the data
+static const unsigned char deflateArchive[] = {
+  0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0xcc, 0x98,
+  0x66, 0x4e, 0x46, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x53, 0x74,
+  0x6f, 0x72, 0x65, 0x64, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x0f, 0x00, 0xf0, 0xff, 0x73, 0x74, 0x6f,
+  0x72, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x31, 0x0a, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x0f, 0x00, 0xf0, 0xff, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f,
+  0x63, 0x6b, 0x20, 0x32, 0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x0f, 0x00, 0xf0, 0xff, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x33, 0x0a, 0x50, 0x4b,
+  0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0x19, 0xa9, 0xb7, 0xf6,
+  0x3b, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x6f, 0x63,
+  0x6b, 0x73, 0x2e, 0x74, 0x78, 0x74, 0xca, 0xcc, 0x2b, 0x51, 0x48, 0x54, 0xb0, 0x55, 0x30, 0xb4,
+  0xe6, 0xca, 0xa4, 0x26, 0x13, 0x00, 0x00, 0x00, 0xff, 0xff, 0xca, 0xcc, 0x2b, 0x51, 0x48, 0x52,
+  0xb0, 0x55, 0x30, 0xb2, 0xe6, 0xca, 0xa4, 0x26, 0x13, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd3, 0xd7,
+  0x52, 0xc8, 0x49, 0x2c, 0x2e, 0x51, 0x48, 0xca, 0xc9, 0x4f, 0xce, 0x56, 0xd0, 0xd2, 0xe7, 0x02,
+  0x00, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0x0b,
+  0x57, 0x04, 0xbb, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4c,
+  0x69, 0x6d, 0x69, 0x74, 0x2e, 0x74, 0x78, 0x74, 0x73, 0x74, 0x1c, 0x05, 0xa3, 0x60, 0x14, 0x0c,
+  0x77, 0x00, 0x00, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21,
+  0x5a, 0xa7, 0x02, 0x1c, 0xb6, 0x08, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00,
+  0x00, 0x48, 0x75, 0x67, 0x65, 0x2e, 0x74, 0x78, 0x74, 0x2b, 0xce, 0x4d, 0xcc, 0xc9, 0xe1, 0x02,
+  0x00, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21,
+  0x5a, 0xcc, 0x98, 0x66, 0x4e, 0x46, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x53,
+  0x74, 0x6f, 0x72, 0x65, 0x64, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0x19, 0xa9, 0xb7, 0xf6, 0x3b, 0x00, 0x00,
+  0x00, 0xc1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa4, 0x01, 0x6e, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x2e, 0x74, 0x78,
+  0x74, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21,
+  0x5a, 0x0b, 0x57, 0x04, 0xbb, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x01, 0xd1, 0x00, 0x00, 0x00, 0x4c,
+  0x69, 0x6d, 0x69, 0x74, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5a, 0xa7, 0x02, 0x1c, 0xb6, 0x08, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa4, 0x01, 0x03, 0x01, 0x00, 0x00, 0x48, 0x75, 0x67, 0x65, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b,
+  0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x31, 0x01,
+  0x00, 0x00, 0x00, 0x00,
+};
+
+const string archiveDir = "RteZipArchiveTest";
+const string archiveFile = archiveDir + "/Vendor.Pack.1.0.0.pack";
+
+class RteZipArchiveTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    RteFsUtils::CreateDirectories(archiveDir);
+    ofstream file(archiveFile, ios::binary);
+    file.write(reinterpret_cast<const char*>(testArchive), sizeof(testArchive));
+  }
+  void TearDown() override {
+    RteFsUtils::RemoveDir(archiveDir);
+  }
+};
+
+TEST_F(RteZipArchiveTest, Open) {
+  RteZipArchive archive;
+  EXPECT_FALSE(archive.Open(archiveDir + "/unknown.pack"));
+  EXPECT_FALSE(archive.IsOpen());
+  RteFsUtils::CreateTextFile(archiveDir + "/text.pack", "no archive");
+  EXPECT_FALSE(archive.Open(archiveDir + "/text.pack"));
+
+  ASSERT_TRUE(archive.Open(archiveFile));
+  EXPECT_TRUE(archive.IsOpen());
+  EXPECT_EQ(archiveFile, archive.GetFileName());
+  EXPECT_EQ(3, archive.GetFileCount());
+  archive.Close();
+  EXPECT_FALSE(archive.IsOpen());
+  EXPECT_FALSE(archive.Exists("Vendor.Pack.pdsc"));
+}
+
+TEST_F(RteZipArchiveTest, Lookup) {
+  RteZipArchive archive;
+  ASSERT_TRUE(archive.Open(archiveFile));
+
+  EXPECT_TRUE(archive.Exists("Vendor.Pack.pdsc"));
+  EXPECT_TRUE(archive.Exists("./Include/../Source\\Main.c"));
+  EXPECT_TRUE(archive.IsRegularFile("Include/Dev.h"));
+  EXPECT_FALSE(archive.IsRegularFile("Include"));
+  EXPECT_TRUE(archive.IsDirectory("Include/"));
+  EXPECT_TRUE(archive.IsDirectory("Source"));   // no own entry
+  EXPECT_TRUE(archive.IsDirectory(""));
+  EXPECT_FALSE(archive.Exists("include/dev.h"));
+  EXPECT_FALSE(archive.Exists("../Vendor.Pack.pdsc"));
+
+  string exactPath;
+  EXPECT_TRUE(archive.GetExactPath("include\\DEV.H", exactPath));
+  EXPECT_EQ("Include/Dev.h", exactPath);
+  EXPECT_TRUE(archive.GetExactPath("source", exactPath));
+  EXPECT_EQ("Source", exactPath);
+  EXPECT_FALSE(archive.GetExactPath("Source/Main.cpp", exactPath));
+
+  vector<string> names;
+  EXPECT_TRUE(archive.List("", names));
+  EXPECT_EQ(vector<string>({ "Vendor.Pack.pdsc", "Include", "Source" }), names);
+  EXPECT_TRUE(archive.List("Include", names));
+  EXPECT_EQ(vector<string>({ "Dev.h" }), names);
+  EXPECT_FALSE(archive.List("Include/Dev.h", names));
+}
+
+TEST_F(RteZipArchiveTest, ReadFile) {
+  RteZipArchive archive;
+  ASSERT_TRUE(archive.Open(archiveFile));
+
+  string content;
+  EXPECT_TRUE(archive.ReadFile("Include/Dev.h", content));
+  EXPECT_EQ("#define DEV 1\n", content);
+  EXPECT_TRUE(archive.ReadFile("Source/Main.c", content));
+  EXPECT_EQ("int main(void) { return 0; }\n", content);
+  EXPECT_TRUE(archive.ReadFile("Vendor.Pack.pdsc", content));
+  EXPECT_EQ(0, content.find("<?xml version=\"1.0\"?>\n<package>\n  <file name=\"Include/Dev.h\"/>\n"));
+  EXPECT_EQ(content.size() - 11, content.find("</package>\n"));
+  EXPECT_FALSE(archive.ReadFile("Include", content));
+  EXPECT_FALSE(archive.ReadFile("Source/Unknown.c", content));
+  EXPECT_TRUE(content.empty());
+}
+
+TEST_F(RteZipArchiveTest, NormalizePath) {
+  string normalized;
+  EXPECT_TRUE(RteZipArchive::NormalizePath("/a//b\\./c/", normalized));
+  EXPECT_EQ("a/b/c", normalized);
+  EXPECT_TRUE(RteZipArchive::NormalizePath("a/../b/..", normalized));
+  EXPECT_EQ("", normalized);
+  EXPECT_FALSE(RteZipArchive::NormalizePath("a/../../b", normalized));
+}
+
+TEST_F(RteZipArchiveTest, ReadFileDeflateBlocks) {
+  const string deflateFile = archiveDir + "/Vendor.Deflate.1.0.0.pack";
+  {
+    ofstream file(deflateFile, ios::binary);
+    file.write(reinterpret_cast<const char*>(deflateArchive), sizeof(deflateArchive));
+  }
+  RteZipArchive archive;
+  ASSERT_TRUE(archive.Open(deflateFile));
+
+  string content;
+  EXPECT_TRUE(archive.ReadFile("Stored.txt", content));
+  EXPECT_EQ("stored block 1\nstored block 2\nstored block 3\n", content);
+
+  string expected;
+  for (int i = 0; i < 8; i++) {
+    expected += "int a = 1;\n";
+  }
+  for (int i = 0; i < 8; i++) {
+    expected += "int b = 2;\n";
+  }
+  expected += "/* last block */\n";
+  EXPECT_TRUE(archive.ReadFile("Blocks.txt", content));
+  EXPECT_EQ(expected, content);
+
+  // decoding stops at the header size
+  EXPECT_FALSE(archive.ReadFile("Limit.txt", content));
+  EXPECT_TRUE(content.empty());
+  EXPECT_FALSE(archive.ReadFile("Huge.txt", content));
+  EXPECT_TRUE(content.empty());
+}
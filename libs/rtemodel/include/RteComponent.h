@@ -638,7 +638,7 @@ public:
    * @param bRespectVersion flag to consider Cversion and Capiversion attributes, default is true
    * @return true if at least one component has all attributes found in the supplied map
   */
-  bool MatchComponentAttributes(const std::map<std::string, std::string>& attributes, bool bRespectVersion = true) const override;
+  bool MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion = true) const override;
 
   /**
    * @brief get short component aggregate display name to use in a tree view
@@ -698,7 +698,7 @@ public:
    * @param attributes std::map with attributes to match
    * @return pointer to RteComponent if found, nullptr otherwise
   */
-  RteComponent* FindComponent(const std::map<std::string, std::string>& attributes) const;
+  RteComponent* FindComponent(const XmlAttributes& attributes) const;
 
   /**
    * @brief get RteComponent with the latest version available for specified variant
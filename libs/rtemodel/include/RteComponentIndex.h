@@ -0,0 +1,72 @@
+#ifndef RteComponentIndex_H
+#define RteComponentIndex_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RteComponentIndex.h
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "RteComponent.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief index of component IDs for text lookup.
+ * Full component IDs (Cvendor::Cclass&Cbundle:Cgroup:Csub&Cvariant@Cversion) are split at component delimiters
+ * into tokens, every token maps to the components containing it. A lookup word is split the same way:
+ * its inner parts must be complete tokens, the last part is a token prefix, the first part a token suffix.
+ * Only the candidates of the most selective part are compared with the word.
+*/
+class RteComponentIndex
+{
+public:
+  /**
+   * @brief default constructor
+  */
+  RteComponentIndex() {};
+
+  /**
+   * @brief build index
+   * @param components map of full component ID to RteComponent pointer
+  */
+  void Build(const RteComponentMap& components);
+
+  /**
+   * @brief clear index
+  */
+  void Clear();
+
+  /**
+   * @brief get number of indexed components
+   * @return number of components
+  */
+  size_t GetCount() const { return m_components.size(); }
+
+  /**
+   * @brief find components with IDs containing all given words, same result as RteUtils::ApplyFilter() applied to the IDs
+   * @param words set of words to search for, empty words are ignored
+   * @param result map of full component ID to RteComponent pointer to fill
+  */
+  void ApplyFilter(const std::set<std::string>& words, RteComponentMap& result) const;
+
+protected:
+  void CollectCandidates(const std::string& word, std::vector<size_t>& candidates) const;
+
+private:
+  std::vector<std::pair<std::string, RteComponent*> > m_components; // sorted by ID
+  std::map<std::string, std::vector<size_t> > m_tokens; // token to sorted indices in m_components
+};
+
+#endif // RteComponentIndex_H
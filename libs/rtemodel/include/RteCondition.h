@@ -15,6 +15,10 @@
 /******************************************************************************/
 #include "RteItem.h"
 
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
+
 class RteTarget;
 class RteCondition;
 class RteComponent;
@@ -373,6 +377,41 @@ public:
    */
    static void SetVerboseFlags(unsigned flags ) { s_uVerboseFlags = flags; }
 
+   /**
+    * @brief get names of target attributes evaluated by filtering expressions of this and referenced conditions
+    * @return sorted vector of attribute names, collected once
+   */
+   const std::vector<std::string>& GetFilterAttributeNames();
+
+   /**
+    * @brief check if filtering results are shared between targets with equal attributes
+    * @return true if filter cache is used
+   */
+   static bool IsUseFilterCache() { return s_bUseFilterCache; }
+
+   /**
+    * @brief enable or disable sharing of filtering results between targets with equal attributes
+    * @param bUse true to use filter cache (default)
+   */
+   static void SetUseFilterCache(bool bUse) { s_bUseFilterCache = bUse; }
+
+   /**
+    * @brief get number of filtering results taken from the filter cache of all conditions
+    * @return number of cache hits since the last ResetFilterCacheStatistics() call
+   */
+   static unsigned long long GetFilterCacheHits() { return s_filterCacheHits; }
+
+   /**
+    * @brief get number of filtering results evaluated and added to the filter cache of all conditions
+    * @return number of cache misses since the last ResetFilterCacheStatistics() call
+   */
+   static unsigned long long GetFilterCacheMisses() { return s_filterCacheMisses; }
+
+   /**
+    * @brief reset filter cache hit and miss counters
+   */
+   static void ResetFilterCacheStatistics() { s_filterCacheHits = 0; s_filterCacheMisses = 0; }
+
 private:
   /**
     * @brief evaluate this condition, called from Evaluate()
@@ -408,12 +447,46 @@ protected:
   */
   void SetEvaluating(RteConditionContext* context, bool evaluating);
 
+  /**
+   * @brief collect names of target attributes evaluated by filtering expressions of this and referenced conditions
+   * @param names set to collect attribute names
+   * @param visited set of already visited conditions (recursion protection)
+  */
+  void CollectFilterAttributeNames(std::set<std::string>& names, std::set<const RteCondition*>& visited) const;
+
+  /**
+   * @brief build filter cache key: values of target attributes evaluated by filtering expressions
+   * @param target pointer to RteTarget providing filtering attributes
+   * @return key string
+  */
+  std::string GetFilterKey(RteTarget* target);
+
+  /**
+   * @brief get filtering result evaluated for another target with the same key
+   * @param key filter key returned by GetFilterKey()
+   * @return cached result, RteItem::UNDEFINED if not found
+  */
+  ConditionResult GetCachedFilterResult(const std::string& key) const;
+
+  /**
+   * @brief store filtering result for the given key
+   * @param key filter key returned by GetFilterKey()
+   * @param result filtering result
+  */
+  void SetCachedFilterResult(const std::string& key, ConditionResult result);
+
 private:
-  int m_bDeviceDependent; // cached device dependency flag
-  int m_bBoardDependent; // cached board dependency flag
+  std::atomic<int> m_bDeviceDependent; // cached device dependency flag
+  std::atomic<int> m_bBoardDependent; // cached board dependency flag
   bool m_bInCheck; // recursion protection flag for CalcDeviceAndBoardDependentFlags() and  ValidateRecursion()
-  std::set<RteConditionContext*> m_evaluating; // recursion protection for Evaluate(RteConditionContext*)
+  std::atomic<bool> m_bFilterAttributesCollected; // m_filterAttributeNames is filled
+  std::vector<std::string> m_filterAttributeNames; // attributes evaluated by filtering expressions
+  std::unordered_map<std::string, ConditionResult> m_filterResults; // filtering results shared between targets, key: filter key
+  mutable std::shared_mutex m_filterResultsMutex; // conditions are shared between targets that can be processed concurrently
   static unsigned s_uVerboseFlags;
+  static std::atomic<bool> s_bUseFilterCache;
+  static std::atomic<unsigned long long> s_filterCacheHits;
+  static std::atomic<unsigned long long> s_filterCacheMisses;
 };
 
 /**
@@ -628,6 +701,20 @@ public:
   */
   virtual RteItem::ConditionResult EvaluateExpression(RteConditionExpression* expr);
 
+  /**
+   * @brief check if supplied condition is being evaluated in this context (recursion protection)
+   * @param condition pointer to RteCondition to check
+   * @return true if condition is being evaluated
+  */
+  bool IsEvaluating(const RteCondition* condition) const;
+
+  /**
+   * @brief set if supplied condition is being evaluated in this context (recursion protection)
+   * @param condition pointer to RteCondition
+   * @param evaluating true before evaluating, false after evaluating
+  */
+  void SetEvaluating(const RteCondition* condition, bool evaluating);
+
 protected:
   void virtual VerboseIn(RteItem* item);
   void virtual VerboseOut(RteItem* item, RteItem::ConditionResult res);
@@ -636,6 +723,7 @@ protected:
   RteTarget* m_target; // owning target
   RteItem::ConditionResult m_result; // overall result
   std::map<RteItem*, RteItem::ConditionResult> m_cachedResults; // collection of cached results
+  std::set<const RteCondition*> m_evaluating; // conditions under evaluation, kept per context since conditions are shared between targets
   unsigned m_verboseIndent;
 };
 
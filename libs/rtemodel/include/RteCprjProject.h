@@ -100,7 +100,7 @@ public:
 
 protected:
   void FillToolchainAttributes(XmlItem &attributes) const;
-   RteTarget* CreateTarget(RteModel* filteredModel, const std::string& name, const std::map<std::string, std::string>& attributes) override;
+   RteTarget* CreateTarget(RteModel* filteredModel, const std::string& name, const XmlAttributes& attributes) override;
    void PropagateFilteredPackagesToTargetModel(const std::string& targetName) override;
    RteComponentInstance* AddCprjComponent(RteItem* item, RteTarget* target) override;
   void ApplySelectedComponentsToCprjFile();
@@ -29,7 +29,7 @@ public:
    * @param attributes collection of target attributes
   */
   RteCprjTarget(RteItem* parent, RteModel* filteredModel, const std::string& name,
-    const std::map<std::string, std::string>& attributes);
+    const XmlAttributes& attributes);
 
   /**
    * @brief destructor
@@ -17,6 +17,8 @@
 #include "RteItem.h"
 #include "RtePackage.h"
 
+#include <atomic>
+
 class RteDeviceItem;
 class RteDeviceProperty;
 typedef std::map<std::string, std::list<RteDeviceProperty*> > RteDevicePropertyMap;
@@ -1135,10 +1137,16 @@ protected:
   */
   void CollectEffectiveProperties(const std::string& pName = EMPTY_STRING);
 
+  /**
+   * @brief fill m_effectiveProperties member for all processors if not yet done, thread-safe
+  */
+  void CollectAllEffectiveProperties();
+
 protected:
   std::map<std::string, RteDeviceProperty*> m_processors; // processor properties
   std::map<std::string, RteDevicePropertyGroup*> m_properties; // features, algorithms, etc. grouped by tags
   std::map<std::string, RteEffectiveProperties> m_effectiveProperties; // features, algorithms, etc. grouped by tags key: processor name
+  std::atomic<bool> m_bEffectivePropertiesCollected; // m_effectiveProperties is filled
   std::list<RteDeviceItem*> m_deviceItems; // sub-items: devices in subFamily, subFamilies in family, families in top container
 };
 
@@ -22,10 +22,12 @@
 #include "YmlTree.h"
 
 #include <memory>
+#include <vector>
 
 class RteCprjProject;
 class CprjFile;
 class IXmlItemBuilder;
+class RtePackManifest;
 
 /**
  * @brief this singleton class orchestrates CMSIS RTE support, provides access to underlying RTE Model and manages *.cprj projects
@@ -322,6 +324,48 @@ public:
   bool LoadPacks(const std::list<std::string>& pdscFiles, std::list<RtePackage*>& packs,
                  RteModel* model = nullptr, bool bReplace = false) const;
 
+  /**
+   * @brief getter for maximum number of threads used to parse pdsc files
+   * @return number of parallel jobs, 0 means number of hardware threads
+  */
+  unsigned GetJobs() const { return m_jobs; }
+
+  /**
+   * @brief setter for maximum number of threads used to parse pdsc files
+   * @param jobs number of parallel jobs, 0 to use number of hardware threads, 1 to parse serially (default)
+  */
+  void SetJobs(unsigned jobs) { m_jobs = jobs; }
+
+  /**
+   * @brief check if parsed pdsc files and the pack manifest are cached in GetPackCacheDir()
+   * @return true if pack cache is used
+  */
+  bool IsUsePackCache() const { return m_bUsePackCache; }
+
+  /**
+   * @brief enable or disable caching parsed pdsc files and the pack manifest in GetPackCacheDir(), disabled by default
+   * @param bUse flag to use pack cache
+  */
+  void SetUsePackCache(bool bUse) { m_bUsePackCache = bUse; }
+
+  /**
+   * @brief get directory to cache parsed pdsc files
+   * @return directory set by SetPackCacheDir(), $CMSIS_PACK_ROOT/.Local/.cache by default
+  */
+  std::string GetPackCacheDir() const;
+
+  /**
+   * @brief set directory to cache parsed pdsc files and the pack manifest
+   * @param cacheDir absolute directory name, empty string to use the default $CMSIS_PACK_ROOT/.Local/.cache
+  */
+  void SetPackCacheDir(const std::string& cacheDir) { m_packCacheDir = cacheDir; }
+
+  /**
+   * @brief get file to store the manifest of installed and local packs
+   * @return $CMSIS_PACK_ROOT/.Local/.cache/packs.manifest
+  */
+  std::string GetPackManifestFile() const;
+
   /**
    * @brief getter for caller information (name & version)
    * @return XmlItem reference
@@ -336,6 +380,35 @@ public:
   void SetToolInfo(const XmlItem& attr) { m_toolInfo = attr; }
 
 protected:
+  /**
+   * @brief result of parsing a single pdsc file
+  */
+  struct PdscParseResult {
+    RtePackage* pack = nullptr;
+    bool success = false;
+    std::list<std::string> errors;
+  };
+
+  /**
+   * @brief parse pdsc files concurrently, each file with its own XMLTree and RteItemBuilder
+   * @param pdscFiles vector of pathnames to parse
+   * @param results vector to receive parse results in the order of pdscFiles
+   * @param parent RteItem to serve as parent for the loaded packs
+   * @param packState PackageState to assign to loaded packs
+  */
+  void ParsePdscFiles(const std::vector<std::string>& pdscFiles, std::vector<PdscParseResult>& results,
+                      RteItem* parent, PackageState packState) const;
+
+  /**
+   * @brief parse a pdsc file or rebuild its items from the pack cache if enabled
+   * @param xmlTree XMLTree to parse the file
+   * @param builder IXmlItemBuilder to create items, set to xmlTree on return
+   * @param pdscFile pdsc filename to parse
+   * @param packState PackageState of the pack, generated packs are not cached
+   * @return true if successful
+  */
+  bool ParsePdscFile(XMLTree* xmlTree, IXmlItemBuilder* builder, const std::string& pdscFile, PackageState packState) const;
+
   /**
    * @brief get local pdsc files, optionally filtered
    * @param attr pack attributes to filter
@@ -343,6 +416,30 @@ protected:
    * @return true if an entry is found
   */
   bool GetLocalPdscFiles(const XmlItem& attr, std::map<std::string, std::string, RtePackageComparator>& pdscMap) const;
+
+  /**
+   * @brief get local pdsc files, optionally filtered
+   * @param attr pack attributes to filter
+   * @param pdscMap map packId to pdsc path to fill
+   * @param manifest pointer to RtePackManifest to use, nullptr to parse index and pdsc files
+   * @return true if an entry is found
+  */
+  bool GetLocalPdscFiles(const XmlItem& attr, std::map<std::string, std::string, RtePackageComparator>& pdscMap,
+                         RtePackManifest* manifest) const;
+
+  /**
+   * @brief get installed pdsc files
+   * @param pdscMap map packId to pdsc path to fill
+   * @param manifest pointer to RtePackManifest to use, nullptr to scan pack root directory
+  */
+  void GetInstalledPdscFiles(std::map<std::string, std::string, RtePackageComparator>& pdscMap,
+                             RtePackManifest* manifest) const;
+
+  /**
+   * @brief load pack manifest if pack cache is used
+   * @return RtePackManifest pointer if pack cache is used, nullptr otherwise
+  */
+  std::unique_ptr<RtePackManifest> LoadPackManifest() const;
   /**
    * @brief parses $CMSIS_PACK_ROOT/.Local/loacl_repository.pidx file
    * @return pointer to "index" element if successful, nullptr otherwise
@@ -379,6 +476,9 @@ protected:
   XmlItem m_toolInfo;
   std::string m_cmsisPackRoot;
   std::string m_cmsisToolboxDir;
+  unsigned m_jobs;
+  bool m_bUsePackCache;
+  std::string m_packCacheDir;
   std::map<std::string, RteItem*> m_externalGeneratorFiles;
   std::map<std::string, RteGenerator*> m_externalGenerators;
 
@@ -8,7 +8,7 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -25,9 +25,37 @@
 #include "RteBoard.h"
 #include "RteGenerator.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 class RteComponentGroup;
 class RteProject;
 
+/**
+ * @brief device and board collections filled from the latest packs of a model.
+ * Filtered models using the same latest packs share one instance, it is not modified once filled.
+*/
+class RteDeviceCollection
+{
+public:
+  /**
+   * @brief constructor
+   * @param bUseDeviceTree true if devices are also added to the device tree
+  */
+  RteDeviceCollection(bool bUseDeviceTree);
+
+  /**
+   * @brief destructor, deletes device vendors and device tree
+  */
+  ~RteDeviceCollection();
+
+  std::map<std::string, RteDeviceVendor*> m_deviceVendors;
+  RteDeviceItemAggregate* m_deviceTree; // vendor/family/subfamily/device/variant/processor
+  RteBoardMap m_boards;
+  const bool m_bUseDeviceTree;
+};
+
 /**
  * @brief this class represents pack description file *.pdsc or project file *.cprj
 */
@@ -164,7 +192,7 @@ public:
    * @brief getter for boards contained in this object
    * @return reference to RteBoardMap object
   */
-  const RteBoardMap& GetBoards() const { return m_boards; }
+  const RteBoardMap& GetBoards() const { return m_devices->m_boards; }
 
   /**
    * @brief getter for compatible boards given by device
@@ -244,7 +272,7 @@ public:
    * @param componentAttributes given component attributes
    * @return RteApi pointer
   */
-  RteApi* GetApi(const std::map<std::string, std::string>& componentAttributes) const;
+  RteApi* GetApi(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief getter for api by given api ID
@@ -357,7 +385,7 @@ public:
    * @brief getter for collection of device vendors
    * @return collection of vendor ID mapped to RteDeviceVendor pointer
   */
-  const std::map<std::string, RteDeviceVendor*>& GetDeviceVendors() const { return m_deviceVendors; }
+  const std::map<std::string, RteDeviceVendor*>& GetDeviceVendors() const { return m_devices->m_deviceVendors; }
 
   /**
    * @brief find vendor by given vendor ID
@@ -415,7 +443,7 @@ public:
    * @brief getter for device tree represented by a RteDeviceItemAggregate object
    * @return RteDeviceItemAggregate pointer
   */
-  RteDeviceItemAggregate* GetDeviceTree() const { return m_deviceTree; }
+  RteDeviceItemAggregate* GetDeviceTree() const { return m_devices->m_deviceTree; }
 
   /**
    * @brief find recursively a device aggregate given by device and vendor name
@@ -446,7 +474,7 @@ public:
    * @param books collection of file path mapped to book title to fill
    * @param deviceAttributes device attributes
   */
-  void GetBoardBooks(std::map<std::string, std::string>& books, const std::map<std::string, std::string>& deviceAttributes) const;
+  void GetBoardBooks(std::map<std::string, std::string>& books, const XmlAttributes& deviceAttributes) const;
 
 public:
   /**
@@ -551,6 +579,9 @@ protected:
   virtual void FillDeviceTree();
   virtual void FillDeviceTree(RtePackage* pack);
 
+  std::shared_ptr<RteDeviceCollection> FindFilteredDevices(const std::vector<RtePackage*>& latestPacks, bool bUseDeviceTree);
+  void CacheFilteredDevices(const std::vector<RtePackage*>& latestPacks, const std::shared_ptr<RteDeviceCollection>& devices);
+
   void AddPackItemsToList(const Collection<RteItem*>& srcCollection, Collection<RteItem*>& dstCollection, const std::string& tag);
 
   bool IsApiDominatingOrNewer(RteApi* a);
@@ -567,13 +598,13 @@ protected:
   std::map<std::string, RteItem*> m_taxonomy; // collection of standard Class descriptions
   RteBundleMap m_bundles; // collection of available bundles
 
-  // device information
-  std::map<std::string, RteDeviceVendor*> m_deviceVendors;
-  RteDeviceItemAggregate* m_deviceTree;// vendor/family/subfamily/device/variant/processor
+  // device and board information
+  std::shared_ptr<RteDeviceCollection> m_devices;
   bool m_bUseDeviceTree; // flag is set to true by Pack Installer, uVision does not use RteDeviceItemAggregate items any more
 
-  // boards
-  RteBoardMap m_boards;
+  // device collections of filtered models mapped by their latest packs, used by global model
+  std::map<std::vector<RtePackage*>, std::weak_ptr<RteDeviceCollection> > m_filteredDevices;
+  std::mutex m_filteredDevicesMutex;
 
   // packs
   RtePackageMap m_packages; // sorted package map (full id to package, latest versions first)
@@ -616,6 +647,11 @@ public:
   */
    void ClearModel() override;
 
+  /**
+   * @brief clean up loaded projects and CMSIS RTE data model, keep parsed packs in the pack registry to insert them again
+  */
+   void ClearKeepPacks();
+
   /**
    * @brief setter for RteCallback object
    * @param callback given RteCallback object to set
@@ -677,13 +713,13 @@ public:
    * @brief getter for active project given by it's ID
    * @return RteProject pointer
   */
-  RteProject* GetActiveProject() const { return GetProject(m_nActiveProjectId); }
+  RteProject* GetActiveProject() const { return GetProject(GetActiveProjectId()); }
 
   /**
    * @brief getter for ID of the active project
-   * @return project ID as integer
+   * @return project ID as integer, ID set for the calling thread takes precedence
   */
-  int GetActiveProjectId() const { return m_nActiveProjectId; }
+  int GetActiveProjectId() const { return theThreadActiveProjectId > 0 ? theThreadActiveProjectId : m_nActiveProjectId; }
 
   /**
    * @brief setter for ID of active project
@@ -691,6 +727,12 @@ public:
   */
   void SetActiveProjectId(int id) { m_nActiveProjectId = id; }
 
+  /**
+   * @brief setter for ID of active project in the calling thread, allows processing projects concurrently
+   * @param id project ID to use in the calling thread, -1 to use the model's active project
+  */
+  static void SetThreadActiveProjectId(int id) { theThreadActiveProjectId = id; }
+
 
 protected:
   int GenerateProjectId();
@@ -700,6 +742,7 @@ protected:
   RtePackRegistry* m_packRegistry;
   std::map<int, RteProject*> m_projects;
   int m_nActiveProjectId; // 1-based project id
+  static thread_local int theThreadActiveProjectId; // overrides m_nActiveProjectId in the calling thread
 };
 
 #endif // RteModel_H
@@ -0,0 +1,109 @@
+#ifndef RtePackCache_H
+#define RtePackCache_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackCache.h
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "IXmlItemBuilder.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+class XMLTree;
+class XmlValueAdjuster;
+
+/**
+ * @brief persistent cache of parsed pdsc files.
+ * A cache entry stores the item tree passed to IXmlItemBuilder while parsing a pdsc file in a compact binary format.
+ * The tree is rebuilt from the entry without reading XML as long as size, modification time and content hash
+ * of the pdsc file as well as the value adjuster of the parser match the values stored in the entry.
+*/
+class RtePackCache
+{
+public:
+  /**
+   * @brief version of the cache entry format, entries with other versions are ignored
+  */
+  static constexpr uint32_t VERSION = 2;
+
+  /**
+   * @brief constructor
+   * @param cacheDir directory to store cache entries, typically $CMSIS_PACK_ROOT/.Local/.cache
+  */
+  RtePackCache(const std::string& cacheDir);
+
+  /**
+   * @brief getter for cache directory
+   * @return cache directory
+  */
+  const std::string& GetCacheDir() const { return m_cacheDir; }
+
+  /**
+   * @brief get name of the cache entry file for a pdsc file
+   * @param pdscFile absolute pdsc filename
+   * @return cache entry filename
+  */
+  std::string GetCacheFile(const std::string& pdscFile) const;
+
+  /**
+   * @brief rebuild items of a pdsc file from its cache entry or parse the file and store its entry.
+   * The method can be called concurrently for different files.
+   * @param xmlTree XMLTree to parse the file if no valid cache entry exists
+   * @param builder IXmlItemBuilder to create items, also set to xmlTree on return
+   * @param pdscFile absolute pdsc filename
+   * @return true if successful
+  */
+  bool Parse(XMLTree* xmlTree, IXmlItemBuilder* builder, const std::string& pdscFile) const;
+
+  /**
+   * @brief rebuild items from the cache entry of a pdsc file
+   * @param builder IXmlItemBuilder to create items
+   * @param pdscFile absolute pdsc filename
+   * @param adjuster XmlValueAdjuster of the parser the entry has been created with, can be nullptr
+   * @return true if a valid entry exists and items are created
+  */
+  bool Read(IXmlItemBuilder* builder, const std::string& pdscFile, const XmlValueAdjuster* adjuster) const;
+
+  /**
+   * @brief remove all cache entries
+   * @return true if successful
+  */
+  bool Clear() const;
+
+protected:
+  /**
+   * @brief properties of a pdsc file and its parser an entry is valid for
+  */
+  struct FileKey {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    uint64_t hash = 0;
+    std::string adjuster;
+  };
+
+  /**
+   * @brief item tree recorded while parsing a file
+  */
+  class Recorder;
+
+  static bool GetFileKey(const std::string& fileName, FileKey& key);
+  bool Read(IXmlItemBuilder* builder, const std::string& pdscFile, const FileKey& key) const;
+  bool Write(const std::string& pdscFile, const FileKey& key, const Recorder& recorder) const;
+
+private:
+  std::string m_cacheDir;
+};
+
+#endif // RtePackCache_H
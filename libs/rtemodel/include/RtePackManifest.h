@@ -0,0 +1,174 @@
+#ifndef RtePackManifest_H
+#define RtePackManifest_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackManifest.h
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief persistent manifest of packs installed in CMSIS_PACK_ROOT and listed in the local repository index.
+ * The manifest stores the contents of scanned pack root directories together with their modification times.
+ * A directory is only listed again if its modification time has changed, unchanged directories are taken
+ * from the manifest. Local repository entries are valid as long as the index file is not modified,
+ * pack IDs of local pdsc files as long as their size and modification time match and they are listed in the index.
+*/
+class RtePackManifest
+{
+public:
+  /**
+   * @brief version of the manifest format, manifests with other versions are ignored
+  */
+  static constexpr uint32_t VERSION = 1;
+
+  /**
+   * @brief local repository entry
+  */
+  struct LocalPdsc {
+    std::string vendor;
+    std::string name;
+    std::string pdscFile;
+  };
+
+  /**
+   * @brief constructor
+   * @param packRoot absolute CMSIS_PACK_ROOT directory
+   * @param manifestFile file to store the manifest, typically $CMSIS_PACK_ROOT/.Local/.cache/packs.manifest
+  */
+  RtePackManifest(const std::string& packRoot, const std::string& manifestFile);
+
+  /**
+   * @brief getter for pack root directory
+   * @return pack root directory
+  */
+  const std::string& GetPackRoot() const { return m_packRoot; }
+
+  /**
+   * @brief getter for manifest file
+   * @return manifest filename
+  */
+  const std::string& GetManifestFile() const { return m_manifestFile; }
+
+  /**
+   * @brief check if the manifest has been changed since it was loaded
+   * @return true if the manifest needs to be saved
+  */
+  bool IsModified() const { return m_bModified; }
+
+  /**
+   * @brief read manifest file, a missing, outdated or corrupted file results in an empty manifest
+   * @return true if the manifest file is read
+  */
+  bool Load();
+
+  /**
+   * @brief write manifest file if modified, the file is replaced atomically
+   * @return true if successful
+  */
+  bool Save();
+
+  /**
+   * @brief collect pdsc files in pack root directory, same result as RteFsUtils::GetPackageDescriptionFiles().
+   * Only directories modified since the last update are listed.
+   * @param files list of absolute pdsc filenames to fill
+   * @param depth maximum directory depth to search
+  */
+  void GetPackageDescriptionFiles(std::list<std::string>& files, int depth);
+
+  /**
+   * @brief get entries of local repository index stored in the manifest
+   * @param localPdscFiles vector to fill
+   * @return true if the index file is not modified since the entries were stored
+  */
+  bool GetLocalPdscFiles(std::vector<LocalPdsc>& localPdscFiles) const;
+
+  /**
+   * @brief store entries of the current local repository index, pack IDs of pdsc files no longer listed are removed
+   * @param localPdscFiles entries of the index file
+  */
+  void SetLocalPdscFiles(const std::vector<LocalPdsc>& localPdscFiles);
+
+  /**
+   * @brief get pack ID stored for a pdsc file
+   * @param pdscFile absolute pdsc filename
+   * @param version string to receive pack version
+   * @return pack ID if the file is not modified since the ID was stored, empty string otherwise
+  */
+  std::string GetPackId(const std::string& pdscFile, std::string& version) const;
+
+  /**
+   * @brief store pack ID of a pdsc file
+   * @param pdscFile absolute pdsc filename
+   * @param packId pack ID
+   * @param version pack version
+  */
+  void SetPackId(const std::string& pdscFile, const std::string& packId, const std::string& version);
+
+  /**
+   * @brief get local repository index filename
+   * @return $CMSIS_PACK_ROOT/.Local/local_repository.pidx
+  */
+  std::string GetLocalRepositoryIndex() const;
+
+protected:
+  /**
+   * @brief properties of a file an entry is valid for
+  */
+  struct FileKey {
+    int64_t mtime = 0;
+    uint64_t size = 0;
+    bool operator==(const FileKey& other) const { return mtime == other.mtime && size == other.size; }
+  };
+
+  /**
+   * @brief listed contents of a directory
+  */
+  struct DirEntry {
+    int64_t mtime = 0;
+    std::vector<std::string> files;
+    std::vector<std::string> dirs;
+    bool operator==(const DirEntry& other) const {
+      return mtime == other.mtime && files == other.files && dirs == other.dirs;
+    }
+  };
+
+  /**
+   * @brief pack ID of a pdsc file
+  */
+  struct PackIdEntry {
+    FileKey key;
+    std::string packId;
+    std::string version;
+  };
+
+  static bool GetFileKey(const std::string& fileName, FileKey& key);
+  void ScanDirectory(std::list<std::string>& files, const std::string& relPath, int depth,
+                     std::map<std::string, DirEntry>& scanned);
+  void PrunePackIds();
+
+private:
+  std::string m_packRoot;
+  std::string m_manifestFile;
+  bool m_bModified;
+  std::map<std::string, DirEntry> m_dirs; // key: directory path relative to pack root
+  bool m_bLocalIndex;
+  FileKey m_localIndexKey;
+  std::vector<LocalPdsc> m_localPdscFiles;
+  std::map<std::string, PackIdEntry> m_packIds; // key: pdsc filename
+};
+
+#endif // RtePackManifest_H
@@ -72,7 +72,7 @@ public:
    * @param model pointer to parent RteModel
    * @param attributes package attributes to assign
   */
-  RtePackage(RteItem* model, const std::map<std::string, std::string>& attributes);
+  RtePackage(RteItem* model, const XmlAttributes& attributes);
 
   /**
    * @brief virtual destructor
@@ -279,7 +279,7 @@ public:
    * @param componentAttributes given component attributes
    * @return RteApi pointer
   */
-  RteApi* GetApi(const std::map<std::string, std::string>& componentAttributes) const;
+  RteApi* GetApi(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief getter for api by given api ID
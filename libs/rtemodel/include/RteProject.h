@@ -645,7 +645,7 @@ public:
    * @param componentAttributes list of component attributes to match
    * @return RteComponentInstance pointer
   */
-  RteComponentInstance* GetApiInstance(const std::map<std::string, std::string>& componentAttributes) const;
+  RteComponentInstance* GetApiInstance(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief get CMSIS RTE data model specific to this project
@@ -706,7 +706,7 @@ public:
    * @param bForceFilterComponents true if validation of components should be initiated in case target is supported
    * @return true if target is successfully added
   */
-  virtual bool AddTarget(const std::string& targetName, const std::map<std::string, std::string>& attributes,
+  virtual bool AddTarget(const std::string& targetName, const XmlAttributes& attributes,
                          bool supported = true, bool bForceFilterComponents = true);
 
   /**
@@ -884,7 +884,7 @@ public:
 
 
 protected:
-  virtual RteTarget* CreateTarget(RteModel* filteredModel, const std::string& name, const std::map<std::string, std::string>& attributes);
+  virtual RteTarget* CreateTarget(RteModel* filteredModel, const std::string& name, const XmlAttributes& attributes);
   void AddTargetInfo(const std::string& targetName);
   bool RemoveTargetInfo(const std::string& targetName);
   bool RenameTargetInfo(const std::string& oldName, const std::string& newName);
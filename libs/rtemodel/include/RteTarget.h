@@ -15,6 +15,7 @@
 /******************************************************************************/
 #include "RteFile.h"
 #include "RteComponent.h"
+#include "RteComponentIndex.h"
 #include "RteCondition.h"
 #include "RteDevice.h"
 #include "RteBoard.h"
@@ -74,7 +75,7 @@ public:
    * @param name name of the target
    * @param attributes list of attributes
   */
-  RteTarget(RteItem* parent, RteModel* filteredModel, const std::string& name, const std::map<std::string, std::string>& attributes);
+  RteTarget(RteItem* parent, RteModel* filteredModel, const std::string& name, const XmlAttributes& attributes);
 
   /**
    * @brief destructor
@@ -203,6 +204,12 @@ public:
   */
   const RteComponentMap& GetFilteredComponents() const { return m_filteredComponents; }
 
+  /**
+   * @brief getter for index of filtered components, the index is built on first access after filtering
+   * @return RteComponentIndex of filtered components
+  */
+  const RteComponentIndex& GetComponentIndex();
+
   /**
    * @brief get collection of filtered bundles
    * @return map of ID to RteBundle pairs
@@ -287,7 +294,7 @@ public:
    * @param componentAttributes list of attributes of a component
    * @return pointer to an instance of type RteApi
   */
-  RteApi* GetApi(const std::map<std::string, std::string>& componentAttributes) const;
+  RteApi* GetApi(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief getter for RteApi instance determined by an api ID
@@ -1055,6 +1062,8 @@ protected:
 
   bool m_bTargetSupported; // target is supported by RTE, can only be defined from outside
   RteComponentMap m_filteredComponents; // components filtered for this target
+  RteComponentIndex m_componentIndex; // index of m_filteredComponents
+  bool m_bComponentIndexValid; // m_componentIndex is up to date
   RteComponentMap m_potentialComponents; // components filtered for this target regardless pack filter
   RteBundleMap m_filteredBundles; // collection of bundles with at least one filtered component
 
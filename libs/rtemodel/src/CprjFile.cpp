@@ -182,7 +182,7 @@ void CprjTargetElement::CollectEffectiveProperties(const string& procName)
       }
       if (pc->IsRemove())
         continue;
-      const map<string, string>& attr = p->GetAttributes();
+      const auto& attr = p->GetAttributes();
       pc->AddAttributes(attr, false); // merge attributes
       if (!m_startupMemory && propType == "memory" && pc->GetAttributeAsBool("startup")) {
         m_startupMemory = pc;
@@ -463,7 +463,7 @@ bool RteComponentAggregate::SetSelected(int nSel)
   return false;
 }
 
-bool RteComponentAggregate::MatchComponentAttributes(const map<string, string>& attributes, bool bRespectVersion) const
+bool RteComponentAggregate::MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion) const
 {
   if (!m_components.empty()) {
     for (auto [_, versionMap] : m_components) {
@@ -482,7 +482,7 @@ bool RteComponentAggregate::MatchComponentInstance(RteComponentInstance* ci) con
 {
   if (!ci)
     return false;
-  const map<string, string>& attributes = ci->GetAttributes();
+  const auto& attributes = ci->GetAttributes();
 
   for (auto [a, v] : m_attributes) {
     if (!a.empty() && a[0] == 'C') {
@@ -863,7 +863,7 @@ RteComponent* RteComponentAggregate::FindComponentMatch(const string& variant, c
   return nullptr;
 }
 
-RteComponent* RteComponentAggregate::FindComponent(const map<string, string>& attributes) const
+RteComponent* RteComponentAggregate::FindComponent(const XmlAttributes& attributes) const
 {
   {
     RteComponent* c = GetComponent();
@@ -0,0 +1,150 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RteComponentIndex.cpp
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "RteComponentIndex.h"
+
+#include "RteConstants.h"
+
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief split string at component delimiters, empty parts are kept
+*/
+static vector<string> SplitAtDelimiters(const string& s)
+{
+  vector<string> parts;
+  size_t start = 0;
+  for (size_t pos = s.find_first_of(RteConstants::COMPONENT_DELIMITERS); pos != string::npos;
+    pos = s.find_first_of(RteConstants::COMPONENT_DELIMITERS, start)) {
+    parts.push_back(s.substr(start, pos - start));
+    start = pos + 1;
+  }
+  parts.push_back(s.substr(start));
+  return parts;
+}
+
+void RteComponentIndex::Build(const RteComponentMap& components)
+{
+  Clear();
+  m_components.assign(components.begin(), components.end());
+  for (size_t i = 0; i < m_components.size(); i++) {
+    for (auto& token : SplitAtDelimiters(m_components[i].first)) {
+      vector<size_t>& indices = m_tokens[token];
+      if (indices.empty() || indices.back() != i) { // a token can occur several times in an ID
+        indices.push_back(i);
+      }
+    }
+  }
+}
+
+void RteComponentIndex::Clear()
+{
+  m_components.clear();
+  m_tokens.clear();
+}
+
+void RteComponentIndex::CollectCandidates(const string& word, vector<size_t>& candidates) const
+{
+  candidates.clear();
+  const vector<string> parts = SplitAtDelimiters(word);
+  const vector<size_t>* selected = nullptr;
+  // inner parts are complete tokens: take the one with fewest components
+  for (size_t i = 1; i + 1 < parts.size(); i++) {
+    if (parts[i].empty()) {
+      continue;
+    }
+    auto it = m_tokens.find(parts[i]);
+    if (it == m_tokens.end()) {
+      return; // no match
+    }
+    if (!selected || it->second.size() < selected->size()) {
+      selected = &it->second;
+    }
+  }
+  if (selected) {
+    candidates = *selected;
+    return;
+  }
+  if (parts.size() > 1 && !parts.back().empty()) {
+    // last part is a token prefix: tokens are sorted
+    const string& prefix = parts.back();
+    for (auto it = m_tokens.lower_bound(prefix); it != m_tokens.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+      candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+    }
+  } else if (!parts.front().empty()) {
+    // first part is a token suffix, a word without delimiters is contained in a token
+    const string& part = parts.front();
+    const bool bSuffix = parts.size() > 1;
+    for (auto& [token, indices] : m_tokens) {
+      if (token.size() < part.size()) {
+        continue;
+      }
+      if (bSuffix ? token.compare(token.size() - part.size(), part.size(), part) == 0 : token.find(part) != string::npos) {
+        candidates.insert(candidates.end(), indices.begin(), indices.end());
+      }
+    }
+  } else {
+    // only delimiters
+    candidates.resize(m_components.size());
+    for (size_t i = 0; i < candidates.size(); i++) {
+      candidates[i] = i;
+    }
+    return;
+  }
+  sort(candidates.begin(), candidates.end());
+  candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+}
+
+void RteComponentIndex::ApplyFilter(const set<string>& words, RteComponentMap& result) const
+{
+  result.clear();
+  vector<size_t> candidates;
+  bool bAll = true;
+  for (auto& word : words) {
+    if (word.empty()) {
+      continue;
+    }
+    vector<size_t> wordCandidates;
+    CollectCandidates(word, wordCandidates);
+    if (bAll || wordCandidates.size() < candidates.size()) {
+      candidates.swap(wordCandidates);
+      bAll = false;
+    }
+    if (candidates.empty()) {
+      return;
+    }
+  }
+  auto isMatch = [&words](const string& id) {
+    for (auto& word : words) {
+      if (!word.empty() && id.find(word) == string::npos) {
+        return false;
+      }
+    }
+    return true;
+  };
+  if (bAll) {
+    result.insert(m_components.begin(), m_components.end());
+    return;
+  }
+  for (auto i : candidates) {
+    const auto& [id, c] = m_components[i];
+    if (isMatch(id)) {
+      result.emplace_hint(result.end(), id, c);
+    }
+  }
+}
+
+// End of RteComponentIndex.cpp
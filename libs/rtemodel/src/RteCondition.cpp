@@ -18,6 +18,7 @@
 
 #include "XMLTree.h"
 
+#include <mutex>
 #include <sstream>
 using namespace std;
 
@@ -25,6 +26,9 @@ const std::string RteConditionExpression::ACCEPT_TAG("accept");
 const std::string RteConditionExpression::DENY_TAG("deny");
 const std::string RteConditionExpression::REQUIRE_TAG("require");
 unsigned RteCondition::s_uVerboseFlags = 0;
+atomic<bool> RteCondition::s_bUseFilterCache(true);
+atomic<unsigned long long> RteCondition::s_filterCacheHits(0);
+atomic<unsigned long long> RteCondition::s_filterCacheMisses(0);
 
 
 
@@ -209,7 +213,7 @@ RteItem::ConditionResult RteConditionExpression::EvaluateExpression(RteTarget* t
 {
   if (!target)
     return FAILED;
-  const map<string, string>& attributes = target->GetAttributes();
+  const auto& attributes = target->GetAttributes();
   for (auto [a, v] : m_attributes) {
     if (a.empty())
       continue;
@@ -336,7 +340,8 @@ RteCondition::RteCondition(RteItem* parent) :
   RteItem(parent),
   m_bDeviceDependent(-1),
   m_bBoardDependent(-1),
-  m_bInCheck(false)
+  m_bInCheck(false),
+  m_bFilterAttributesCollected(false)
 {
 }
 
@@ -400,28 +405,33 @@ bool RteCondition::ValidateRecursion()
 
 void RteCondition::CalcDeviceAndBoardDependentFlags()
 {
+  // conditions are shared between targets that can be processed concurrently
+  static recursive_mutex calcMutex;
+  lock_guard<recursive_mutex> lock(calcMutex);
   if (m_bDeviceDependent < 0 || m_bBoardDependent < 0) { // not yet calculated
-    m_bDeviceDependent = 0;
-    m_bBoardDependent = 0;
     if (m_bInCheck) { // to prevent recursion
       return;
     }
     m_bInCheck = true;
+    int bDeviceDependent = 0;
+    int bBoardDependent = 0;
     for (auto child : GetChildren()) {
       RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(child);
       if (!expr) {
         continue;
       }
       if (expr->IsDeviceDependent()) {
-        m_bDeviceDependent = 1;
+        bDeviceDependent = 1;
       }
       if (expr->IsBoardDependent()) {
-        m_bBoardDependent = 1;
+        bBoardDependent = 1;
       }
-      if (m_bDeviceDependent > 0 && m_bBoardDependent > 0) {
+      if (bDeviceDependent > 0 && bBoardDependent > 0) {
         break;
       }
     }
+    m_bDeviceDependent = bDeviceDependent;
+    m_bBoardDependent = bBoardDependent;
     m_bInCheck = false;
   }
 }
@@ -504,24 +514,116 @@ RteItem::ConditionResult RteCondition::Evaluate(RteConditionContext* context)
   if (IsEvaluating(context)) {
     return R_ERROR; // recursion error
   }
+  // filtering result only depends on target attributes referenced by the condition:
+  // share it between targets with equal values, verbose output requires full evaluation
+  RteTarget* target = context->GetTarget();
+  const bool bUseCache = IsUseFilterCache() && target && !context->IsDependencyContext() && !context->IsVerbose();
+  string key;
+  if (bUseCache) {
+    key = GetFilterKey(target);
+    ConditionResult cached = GetCachedFilterResult(key);
+    if (cached != UNDEFINED) {
+      s_filterCacheHits++;
+      return cached;
+    }
+  }
   SetEvaluating(context, true);
   RteItem::ConditionResult result = EvaluateCondition(context);
   SetEvaluating(context, false);
+  if (bUseCache) {
+    s_filterCacheMisses++;
+    SetCachedFilterResult(key, result);
+  }
   return result;
 }
 
+const vector<string>& RteCondition::GetFilterAttributeNames()
+{
+  if (!m_bFilterAttributesCollected) {
+    unique_lock<shared_mutex> lock(m_filterResultsMutex);
+    if (!m_bFilterAttributesCollected) {
+      set<string> names;
+      set<const RteCondition*> visited;
+      CollectFilterAttributeNames(names, visited);
+      m_filterAttributeNames.assign(names.begin(), names.end());
+      m_bFilterAttributesCollected = true;
+    }
+  }
+  return m_filterAttributeNames;
+}
+
+void RteCondition::CollectFilterAttributeNames(set<string>& names, set<const RteCondition*>& visited) const
+{
+  if (!visited.insert(this).second) {
+    return; // already collected or recursion
+  }
+  for (auto child : GetChildren()) {
+    RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(child);
+    if (!expr) {
+      continue;
+    }
+    switch (expr->GetExpressionDomain()) {
+    case BOARD_EXPRESSION:
+    case DEVICE_EXPRESSION:
+    case TOOLCHAIN_EXPRESSION:
+      // same attributes as evaluated by RteConditionExpression::EvaluateExpression()
+      for (auto [a, v] : expr->GetAttributes()) {
+        if (!a.empty() && a.at(0) != 'C' && a != "condition") {
+          names.insert(a);
+        }
+      }
+      break;
+    case CONDITION_EXPRESSION:
+    {
+      RteCondition* cond = expr->GetCondition();
+      if (cond) {
+        cond->CollectFilterAttributeNames(names, visited);
+      }
+      break;
+    }
+    default: // other expressions are ignored by filtering
+      break;
+    }
+  }
+}
+
+string RteCondition::GetFilterKey(RteTarget* target)
+{
+  const auto& attributes = target->GetAttributes();
+  string key;
+  for (auto& a : GetFilterAttributeNames()) {
+    auto ita = attributes.find(a);
+    if (ita != attributes.end()) {
+      // length prefix keeps keys unambiguous for any value
+      key += to_string(ita->second.size()) + ':' + ita->second;
+    } else {
+      key += '-';
+    }
+  }
+  return key;
+}
+
+RteItem::ConditionResult RteCondition::GetCachedFilterResult(const string& key) const
+{
+  shared_lock<shared_mutex> lock(m_filterResultsMutex);
+  auto it = m_filterResults.find(key);
+  return it != m_filterResults.end() ? it->second : UNDEFINED;
+}
+
+void RteCondition::SetCachedFilterResult(const string& key, ConditionResult result)
+{
+  unique_lock<shared_mutex> lock(m_filterResultsMutex);
+  m_filterResults[key] = result;
+}
+
 bool RteCondition::IsEvaluating(RteConditionContext* context) const
 {
-  return m_evaluating.find(context) != m_evaluating.end();
+  return context->IsEvaluating(this);
 }
 
 void RteCondition::SetEvaluating(RteConditionContext* context, bool evaluating)
 {
-  if (evaluating) {
-    m_evaluating.insert(context);
-  } else {
-    m_evaluating.erase(context);
-  }
+  context->SetEvaluating(this, evaluating);
 }
 
 
@@ -825,6 +927,20 @@ void RteConditionContext::Clear()
   m_cachedResults.clear();
 }
 
+bool RteConditionContext::IsEvaluating(const RteCondition* condition) const
+{
+  return m_evaluating.find(condition) != m_evaluating.end();
+}
+
+void RteConditionContext::SetEvaluating(const RteCondition* condition, bool evaluating)
+{
+  if (evaluating) {
+    m_evaluating.insert(condition);
+  } else {
+    m_evaluating.erase(condition);
+  }
+}
+
 
 bool RteConditionContext::IsVerbose() const
 {
@@ -91,7 +91,7 @@ bool RteCprjProject::SetToolchain(const string& toolchain, const std::string& to
 }
 
 
-RteTarget* RteCprjProject::CreateTarget(RteModel* filteredModel, const string& name, const map<string, string>& attributes)
+RteTarget* RteCprjProject::CreateTarget(RteModel* filteredModel, const string& name, const XmlAttributes& attributes)
 {
   RteTarget* target = new RteCprjTarget(this, filteredModel, name, attributes);
   CreateBoardInfo(target, GetCprjFile()->GetTargetElement());
@@ -20,7 +20,7 @@
 using namespace std;
 
 RteCprjTarget::RteCprjTarget(RteItem* parent, RteModel* filteredModel,
-  const string& name, const map<string, string>& attributes) :
+  const string& name, const XmlAttributes& attributes) :
   RteTarget(parent, filteredModel, name, attributes)
 {
 }
@@ -19,13 +19,15 @@
 
 #include "XMLTree.h"
 
+#include <mutex>
+
 using namespace std;
 
 static const list<RteDeviceProperty*> EMPTY_PROPERTY_LIST;
 
 const string& RteDeviceElement::GetEffectiveAttribute(const string& name) const
 {
-  map<string, string>::const_iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end())
     return it->second;
   // take from parent
@@ -38,7 +40,7 @@ const string& RteDeviceElement::GetEffectiveAttribute(const string& name) const
 
 bool RteDeviceElement::HasEffectiveAttribute(const string& name) const
 {
-  map<string, string>::const_iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end())
     return true;
   RteItem* parent = GetParent();
@@ -422,7 +424,8 @@ RteDeviceProperty* RteFlashInfo::CreateProperty(const string& tag) {
 /////////////////
 // device tree
 RteDeviceItem::RteDeviceItem(RteItem* parent) :
-  RteDeviceElement(parent)
+  RteDeviceElement(parent),
+  m_bEffectivePropertiesCollected(false)
 {
 }
 
@@ -439,6 +442,7 @@ void RteDeviceItem::Clear()
   m_properties.clear();
   m_deviceItems.clear(); // items are in m_children collection as well, do not delete here
   m_effectiveProperties.clear();
+  m_bEffectivePropertiesCollected = false;
   m_processors.clear();
   RteDeviceElement::Clear();
 }
@@ -758,13 +762,26 @@ const list<RteDeviceProperty*>& RteEffectiveProperties::GetProperties(const stri
 }
 
 
-const RteDevicePropertyMap& RteDeviceItem::GetEffectiveProperties(const string& pName)
+void RteDeviceItem::CollectAllEffectiveProperties()
 {
-  if (m_effectiveProperties.empty()) {
+  if (m_bEffectivePropertiesCollected) {
+    return;
+  }
+  // devices are shared between targets that can be processed concurrently,
+  // properties of parent items are shared between devices
+  static mutex collectMutex;
+  lock_guard<mutex> lock(collectMutex);
+  if (!m_bEffectivePropertiesCollected) {
     for (auto [pn, p] : m_processors) {
       CollectEffectiveProperties(pn);
     }
+    m_bEffectivePropertiesCollected = true;
   }
+}
+
+const RteDevicePropertyMap& RteDeviceItem::GetEffectiveProperties(const string& pName)
+{
+  CollectAllEffectiveProperties();
 
   auto itp = m_effectiveProperties.find(pName);
   if (itp != m_effectiveProperties.end()) {
@@ -777,9 +794,7 @@ const RteDevicePropertyMap& RteDeviceItem::GetEffectiveProperties(const string&
 
 const list<RteDeviceProperty*>& RteDeviceItem::GetEffectiveProperties(const string& tag, const string& pName)
 {
-  if (m_effectiveProperties.empty()) {
-    GetEffectiveProperties(pName);
-  }
+  CollectAllEffectiveProperties();
   auto itp = m_effectiveProperties.find(pName);
   if (itp != m_effectiveProperties.end()) {
     const RteEffectiveProperties& effectiveProps = itp->second;
@@ -70,7 +70,7 @@ RteItem::RteItem(const std::string& tag, RteItem* parent):
 {
 }
 
-RteItem::RteItem(const std::map<std::string, std::string>& attributes, RteItem* parent) :
+RteItem::RteItem(const XmlAttributes& attributes, RteItem* parent) :
   XmlTreeItem<RteItem>(parent, attributes),
   m_bValid(true)
 {
@@ -622,7 +622,7 @@ bool RteItem::MatchComponent(const RteItem& item) const
 }
 
 
-bool RteItem::MatchComponentAttributes(const map<string, string>& attributes, bool bRespectVersion) const
+bool RteItem::MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion) const
 {
   if (attributes.empty()) // no limiting attributes
     return true;
@@ -650,7 +650,7 @@ bool RteItem::MatchComponentAttributes(const map<string, string>& attributes, bo
 }
 
 
-bool RteItem::MatchApiAttributes(const map<string, string>& attributes, bool bRespectVersion) const
+bool RteItem::MatchApiAttributes(const XmlAttributes& attributes, bool bRespectVersion) const
 {
   if (attributes.empty())
     return false;
@@ -675,12 +675,11 @@ bool RteItem::MatchApiAttributes(const map<string, string>& attributes, bool bRe
 }
 
 
-bool RteItem::MatchDeviceAttributes(const map<string, string>& attributes) const
+bool RteItem::MatchDeviceAttributes(const XmlAttributes& attributes) const
 {
   if (attributes.empty())
     return false;
 
-  map<string, string>::const_iterator itm, ita;
   for (auto [a, v] : m_attributes) {
     if (!a.empty() && a[0] == 'D') {
       auto ita = attributes.find(a);
@@ -698,7 +697,7 @@ bool RteItem::MatchDeviceAttributes(const map<string, string>& attributes) const
   return true; // all attributes are found in supplied map
 }
 
-bool RteItem::MatchDevice(const map<string, string>& attributes) const
+bool RteItem::MatchDevice(const XmlAttributes& attributes) const
 {
   if (attributes.empty())
     return false;
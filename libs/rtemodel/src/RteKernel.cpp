@@ -17,6 +17,8 @@
 #include "RteCprjProject.h"
 #include "CprjFile.h"
 #include "RteItemBuilder.h"
+#include "RtePackCache.h"
+#include "RtePackManifest.h"
 
 #include "RteUtils.h"
 #include "RteFsUtils.h"
@@ -26,6 +28,10 @@
 #include "YmlFormatter.h"
 
 #include "CollectionUtils.h"
+#include "ThreadPool.h"
+
+#include <map>
+#include <set>
 
 using namespace std;
 
@@ -45,7 +51,9 @@ static constexpr const char* R824 = "Multiple PDSC files were found";
 RteKernel::RteKernel(RteCallback* rteCallback, RteGlobalModel* globalModel) :
 m_globalModel(globalModel),
 m_bOwnModel(false),
-m_rteCallback(rteCallback)
+m_rteCallback(rteCallback),
+m_jobs(1),
+m_bUsePackCache(false)
 {
   if (!m_globalModel) {
     m_globalModel = new RteGlobalModel();
@@ -299,7 +307,7 @@ RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState)
   const string ext = RteUtils::ExtractFileExtension(pdscFile, true);
   auto rteItemBuilder= CreateUniqueRteItemBuilder(GetGlobalModel(), packState);
   unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree(rteItemBuilder.get(), ext);
-  bool success = xmlTree->AddFileName(pdscFile, true);
+  bool success = ParsePdscFile(xmlTree.get(), rteItemBuilder.get(), pdscFile, packState);
   pack = rteItemBuilder->GetPack();
   if (!success || !pack) {
     GetRteCallback()->Err("R802", R802, pdscFile);
@@ -315,6 +323,19 @@ RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState)
   return pack;
 }
 
+string RteKernel::GetPackCacheDir() const
+{
+  if(!m_packCacheDir.empty()) {
+    return m_packCacheDir;
+  }
+  return GetCmsisPackRoot() + "/.Local/.cache";
+}
+
+string RteKernel::GetPackManifestFile() const
+{
+  return GetPackCacheDir() + "/packs.manifest";
+}
+
 bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<RtePackage*>& packs, RteModel* model, bool bReplace) const
 {
   bool success = true;
@@ -325,22 +346,39 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
     model = GetGlobalModel();
   }
   RtePackRegistry* packRegistry = GetPackRegistry();
-  unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree();
+  // collect files to parse
+  vector<string> filesToParse;
+  map<string, size_t> fileIndexes;
+  for(auto& pdscFile : pdscFiles) {
+    if((bReplace || !packRegistry->GetPack(pdscFile)) && !contains_key(fileIndexes, pdscFile)) {
+      fileIndexes[pdscFile] = filesToParse.size();
+      filesToParse.push_back(pdscFile);
+    }
+  }
+  vector<PdscParseResult> results;
+  ParsePdscFiles(filesToParse, results, model, model->GetPackageState());
+
+  // register packs in the order of supplied files
+  set<string> processedFiles;
   for(auto& pdscFile : pdscFiles) {
-    auto rteItemBuilder = CreateUniqueRteItemBuilder(model, model->GetPackageState());
-    xmlTree->SetXmlItemBuilder(rteItemBuilder.get());
     RtePackage* pack = packRegistry->GetPack(pdscFile);
+    auto it = fileIndexes.find(pdscFile);
+    if(it == fileIndexes.end() || !processedFiles.insert(pdscFile).second) {
+      if(pack) {
+        packs.push_back(pack);
+      }
+      continue;
+    }
     if(bReplace) {
       packRegistry->ErasePack(pdscFile);
-    } else if(pack) {
-      packs.push_back(pack);
-      continue;
     }
-    bool result = xmlTree->AddFileName(pdscFile, true);
-    pack = rteItemBuilder->GetPack();
-    if(!result || !pack) {
+    PdscParseResult& result = results[it->second];
+    pack = result.pack;
+    result.pack = nullptr;
+    if(!result.success || !pack) {
       GetRteCallback()->Err("R802", R802, pdscFile);
-      GetRteCallback()->OutputMessages(xmlTree->GetErrorStrings());
+      GetRteCallback()->OutputMessages(result.errors);
+      delete pack;
       success = false;
     } else {
       if(packRegistry->AddPack(pack, bReplace)) {
@@ -349,11 +387,51 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
         delete pack;
       }
     }
-    GetRteCallback()->PackProcessed(pdscFile, result);
+    GetRteCallback()->PackProcessed(pdscFile, result.success);
   }
   return success;
 }
 
+bool RteKernel::ParsePdscFile(XMLTree* xmlTree, IXmlItemBuilder* builder, const string& pdscFile, PackageState packState) const
+{
+  if(IsUsePackCache() && !GetCmsisPackRoot().empty() && packState != PackageState::PS_GENERATED &&
+    RteUtils::ExtractFileExtension(pdscFile, true) == ".pdsc") {
+    RtePackCache packCache(GetPackCacheDir());
+    return packCache.Parse(xmlTree, builder, pdscFile);
+  }
+  xmlTree->SetXmlItemBuilder(builder);
+  return xmlTree->AddFileName(pdscFile, true);
+}
+
+void RteKernel::ParsePdscFiles(const vector<string>& pdscFiles, vector<PdscParseResult>& results,
+                               RteItem* parent, PackageState packState) const
+{
+  results.clear();
+  results.resize(pdscFiles.size());
+  ThreadPool threadPool(GetJobs());
+  // create one parser per worker in the calling thread: parser initialization is not thread-safe
+  vector<unique_ptr<XMLTree> > xmlTrees;
+  for(size_t i = 0; i < threadPool.GetWorkerCount(pdscFiles.size()); i++) {
+    xmlTrees.push_back(CreateUniqueXmlTree());
+  }
+  threadPool.ForEach(pdscFiles.size(), [&](size_t index, size_t worker) {
+    const string& pdscFile = pdscFiles[index];
+    PdscParseResult& result = results[index];
+    auto rteItemBuilder = CreateUniqueRteItemBuilder(parent, packState);
+    const string ext = RteUtils::ExtractFileExtension(pdscFile, true);
+    unique_ptr<XMLTree> ymlTree;
+    XMLTree* xmlTree = xmlTrees[worker].get();
+    if(ext == ".yml" || ext == ".yaml") {
+      ymlTree = CreateUniqueXmlTree(nullptr, ext);
+      xmlTree = ymlTree.get();
+    }
+    xmlTree->Clear();
+    result.success = ParsePdscFile(xmlTree, rteItemBuilder.get(), pdscFile, packState);
+    result.pack = rteItemBuilder->GetPack();
+    result.errors = xmlTree->GetErrorStrings();
+    xmlTree->SetXmlItemBuilder(nullptr);
+  });
+}
 
 bool RteKernel::LoadRequiredPdscFiles(CprjFile* cprjFile)
 {
@@ -413,12 +491,18 @@ bool RteKernel::GetEffectivePdscFilesAsMap(map<string, string, RtePackageCompara
   if(cmsisPackRoot.empty()) {
     return false;
   }
+  // installed and local packs are taken from the manifest if available
+  unique_ptr<RtePackManifest> manifest = LoadPackManifest();
+
   // Get all installed files
-  RteKernel::GetInstalledPdscFiles(pdscMap);
+  RteKernel::GetInstalledPdscFiles(pdscMap, manifest.get());
 
   // Overwrite entries with local pdsc files if any
   XmlItem emptyAttributes;
-  GetLocalPdscFiles(emptyAttributes, pdscMap);
+  GetLocalPdscFiles(emptyAttributes, pdscMap, manifest.get());
+  if (manifest) {
+    manifest->Save();
+  }
 
   // purge entries if only latest are required
   if(latest) {
@@ -457,15 +541,54 @@ bool RteKernel::LoadAndInsertPacks(std::list<RtePackage*>& packs, std::list<std:
   }
   std::list<RtePackage*> newPacks;
   pdscFiles.unique();
+
+  // parse files not loaded yet
+  RtePackRegistry* packRegistry = GetPackRegistry();
+  vector<string> filesToParse;
+  map<string, size_t> fileIndexes;
+  for (const auto& pdscFile : pdscFiles) {
+    if (!pdscFile.empty() && !packRegistry->GetPack(pdscFile) && !contains_key(fileIndexes, pdscFile)) {
+      fileIndexes[pdscFile] = filesToParse.size();
+      filesToParse.push_back(pdscFile);
+    }
+  }
+  vector<PdscParseResult> results;
+  ParsePdscFiles(filesToParse, results, globalModel, PackageState::PS_UNKNOWN);
+
+  // register packs in the order of supplied files, stop at the first error
+  bool success = true;
   for (const auto& pdscFile : pdscFiles) {
-    RtePackage* pack = LoadPack(pdscFile);
+    RtePackage* pack = packRegistry->GetPack(pdscFile);
+    auto it = fileIndexes.find(pdscFile);
+    if (!pack && it != fileIndexes.end()) {
+      PdscParseResult& result = results[it->second];
+      pack = result.pack;
+      result.pack = nullptr;
+      if (!result.success || !pack) {
+        GetRteCallback()->Err("R802", R802, pdscFile);
+        GetRteCallback()->OutputMessages(result.errors);
+        delete pack;
+        pack = nullptr;
+      } else if (!packRegistry->AddPack(pack)) {
+        delete pack;
+        pack = nullptr;
+      }
+    }
     if (!pack) {
-      return false;
+      success = false;
+      break;
     }
     if(!RtePackage::GetPackFromList(pack->GetID(), packs)){
       newPacks.push_back(pack);
     }
   }
+  // discard packs parsed after an error
+  for (auto& result : results) {
+    delete result.pack;
+  }
+  if (!success) {
+    return false;
+  }
 
   globalModel->InsertPacks(newPacks);
 
@@ -479,9 +602,23 @@ bool RteKernel::LoadAndInsertPacks(std::list<RtePackage*>& packs, std::list<std:
 
 
 void RteKernel::GetInstalledPdscFiles(std::map<std::string, std::string, RtePackageComparator>& pdscMap) const
+{
+  unique_ptr<RtePackManifest> manifest = LoadPackManifest();
+  GetInstalledPdscFiles(pdscMap, manifest.get());
+  if (manifest) {
+    manifest->Save();
+  }
+}
+
+void RteKernel::GetInstalledPdscFiles(std::map<std::string, std::string, RtePackageComparator>& pdscMap,
+                                      RtePackManifest* manifest) const
 {
   list<string> allFiles;
-  RteFsUtils::GetPackageDescriptionFiles(allFiles, GetCmsisPackRoot(), 3);
+  if (manifest) {
+    manifest->GetPackageDescriptionFiles(allFiles, 3);
+  } else {
+    RteFsUtils::GetPackageDescriptionFiles(allFiles, GetCmsisPackRoot(), 3);
+  }
   for(auto& f : allFiles) {
     string id = RtePackage::PackIdFromPath(f);
     pdscMap[id] = f;
@@ -556,38 +693,81 @@ pair<string, string> RteKernel::GetPdscFileFromPath(const XmlItem& attributes, c
 
 bool RteKernel::GetLocalPdscFiles(const XmlItem& attr, std::map<std::string, std::string, RtePackageComparator>& pdscMap) const
 {
-  unique_ptr<XMLTreeElement> pIndex(ParseLocalRepositoryIdx());
-  if(!pIndex) {
-    return false;
+  unique_ptr<RtePackManifest> manifest = LoadPackManifest();
+  bool found = GetLocalPdscFiles(attr, pdscMap, manifest.get());
+  if (manifest) {
+    manifest->Save();
+  }
+  return found;
+}
+
+bool RteKernel::GetLocalPdscFiles(const XmlItem& attr, std::map<std::string, std::string, RtePackageComparator>& pdscMap,
+                                  RtePackManifest* manifest) const
+{
+  vector<RtePackManifest::LocalPdsc> localPdscFiles;
+  if (!manifest || !manifest->GetLocalPdscFiles(localPdscFiles)) {
+    unique_ptr<XMLTreeElement> pIndex(ParseLocalRepositoryIdx());
+    if (!pIndex) {
+      if (manifest) {
+        manifest->SetLocalPdscFiles(localPdscFiles);
+      }
+      return false;
+    }
+    for (auto& item : pIndex->GetChildren()) {
+      string url = RteFsUtils::GetAbsPathFromLocalUrl(item->GetAttribute("url"));
+      if(RteFsUtils::IsRelative(url)) {
+        url = RteFsUtils::MakePathCanonical(item->GetRootFilePath() + url) + '/';
+      }
+      const string& vendor = item->GetAttribute("vendor");
+      const string& name = item->GetAttribute("name");
+      localPdscFiles.push_back({ vendor, name, url + vendor + '.' + name + ".pdsc" });
+    }
+    if (manifest) {
+      manifest->SetLocalPdscFiles(localPdscFiles);
+    }
   }
   const string& name = attr.GetAttribute("name");
   const string& vendor = attr.GetAttribute("vendor");
   const string& versionRange = attr.GetAttribute("version");
   bool found = false;
   // Populate map with items matching name, vendor and version range
-  for (auto& item : pIndex->GetChildren()) {
-    if ((name.empty() || name == item->GetAttribute("name"))
-        && (vendor.empty() || vendor == item->GetAttribute("vendor")))
+  for (auto& localPdsc : localPdscFiles) {
+    if ((name.empty() || name == localPdsc.name)
+        && (vendor.empty() || vendor == localPdsc.vendor))
     {
       // Load the local pack to get its version. The 'version' attribute in the local repository index is ignored.
-      string url = RteFsUtils::GetAbsPathFromLocalUrl(item->GetAttribute("url"));
-      if(RteFsUtils::IsRelative(url)) {
-        url = RteFsUtils::MakePathCanonical(item->GetRootFilePath() + url) + '/';
-      }
-      const string localPdscFile = url + item->GetAttribute("vendor") + '.' + item->GetAttribute("name") + ".pdsc";
-      RtePackage* pack = LoadPack(localPdscFile);
-      if(pack) {
-        const string& version = pack->GetVersionString();
-        if(versionRange.empty() || VersionCmp::RangeCompare(version, versionRange) == 0) {
-          pdscMap[pack->GetID()] = localPdscFile;
-          found = true;
+      string version;
+      string packId = manifest ? manifest->GetPackId(localPdsc.pdscFile, version) : RteUtils::EMPTY_STRING;
+      if (packId.empty()) {
+        RtePackage* pack = LoadPack(localPdsc.pdscFile);
+        if (!pack) {
+          continue;
         }
+        packId = pack->GetID();
+        version = pack->GetVersionString();
+        if (manifest) {
+          manifest->SetPackId(localPdsc.pdscFile, packId, version);
+        }
+      }
+      if(versionRange.empty() || VersionCmp::RangeCompare(version, versionRange) == 0) {
+        pdscMap[packId] = localPdsc.pdscFile;
+        found = true;
       }
     }
   }
   return found;
 }
 
+unique_ptr<RtePackManifest> RteKernel::LoadPackManifest() const
+{
+  if (!IsUsePackCache() || GetCmsisPackRoot().empty()) {
+    return nullptr;
+  }
+  auto manifest = make_unique<RtePackManifest>(GetCmsisPackRoot(), GetPackManifestFile());
+  manifest->Load();
+  return manifest;
+}
+
 
 XMLTreeElement* RteKernel::ParseLocalRepositoryIdx() const
 {
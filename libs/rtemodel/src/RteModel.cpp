@@ -25,6 +25,21 @@
 
 using namespace std;
 
+//////////////////////////////////////////////////////////
+RteDeviceCollection::RteDeviceCollection(bool bUseDeviceTree) :
+  m_deviceTree(new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL)),
+  m_bUseDeviceTree(bUseDeviceTree)
+{
+}
+
+RteDeviceCollection::~RteDeviceCollection()
+{
+  for (auto [_, dv] : m_deviceVendors) {
+    delete dv;
+  }
+  delete m_deviceTree;
+}
+
 //////////////////////////////////////////////////////////
 RteModel::RteModel(RteItem* parent, PackageState packageState) :
   RteItem(parent),
@@ -34,7 +49,7 @@ RteModel::RteModel(RteItem* parent, PackageState packageState) :
   m_bUseDeviceTree(true),
   m_filterContext(NULL)
 {
-  m_deviceTree = new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL);
+  m_devices = make_shared<RteDeviceCollection>(m_bUseDeviceTree);
 }
 
 
@@ -46,7 +61,7 @@ RteModel::RteModel(PackageState packageState) :
   m_bUseDeviceTree(false),
   m_filterContext(NULL)
 {
-  m_deviceTree = new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL);
+  m_devices = make_shared<RteDeviceCollection>(m_bUseDeviceTree);
 }
 
 
@@ -54,7 +69,6 @@ RteModel::~RteModel()
 {
   RteModel::Clear();
   m_filterContext = NULL;
-  delete m_deviceTree;
 }
 
 void RteModel::Clear()
@@ -77,6 +91,10 @@ void RteModel::ClearModel()
   m_packageDuplicates.clear();
   m_packages.clear();
   m_latestPackages.clear();
+  {
+    lock_guard<mutex> lock(m_filteredDevicesMutex);
+    m_filteredDevices.clear();
+  }
 
   m_children.clear(); // clear children here, the packs are deleted by RtePackRegistry
   RteItem::Clear();
@@ -84,12 +102,8 @@ void RteModel::ClearModel()
 
 void RteModel::ClearDevices()
 {
-  for (auto [_, dv] : m_deviceVendors) {
-    delete dv;
-  }
-  m_deviceVendors.clear();
-  m_deviceTree->Clear();
-  m_boards.clear();
+  // the collection can be shared with other filtered models: never clear it in place
+  m_devices = make_shared<RteDeviceCollection>(m_bUseDeviceTree);
 }
 
 
@@ -250,7 +264,7 @@ RteComponent* RteModel::GetComponent(RteComponentInstance* ci, bool matchVersion
 }
 
 
-RteApi* RteModel::GetApi(const map<string, string>& componentAttributes) const
+RteApi* RteModel::GetApi(const XmlAttributes& componentAttributes) const
 {
   RteApi* api = nullptr;
   for (auto [_, a] : m_apiList) {
@@ -446,6 +460,7 @@ bool RteModel::Validate()
 
 RtePackage* RteModel::FilterModel(RteModel* globalModel, RtePackage* devicePackage)
 {
+  shared_ptr<RteDeviceCollection> devices = m_devices; // keep alive to reuse it if the latest packs do not change
   Clear();
 
   // first add all latest packs
@@ -485,10 +500,45 @@ RtePackage* RteModel::FilterModel(RteModel* globalModel, RtePackage* devicePacka
   }
 
   FillComponentList(devicePackage);
-  FillDeviceTree();
+
+  // device information depends only on the latest packs: reuse collection filled for the same packs
+  vector<RtePackage*> latestPacks;
+  latestPacks.reserve(m_latestPackages.size());
+  for (auto [_, pack] : m_latestPackages) {
+    latestPacks.push_back(pack);
+  }
+  m_devices = globalModel->FindFilteredDevices(latestPacks, IsUseDeviceTree());
+  if (!m_devices) {
+    FillDeviceTree();
+    globalModel->CacheFilteredDevices(latestPacks, m_devices);
+  }
   return devicePackage; // now effective
 }
 
+shared_ptr<RteDeviceCollection> RteModel::FindFilteredDevices(const vector<RtePackage*>& latestPacks, bool bUseDeviceTree)
+{
+  lock_guard<mutex> lock(m_filteredDevicesMutex);
+  auto it = m_filteredDevices.find(latestPacks);
+  if (it == m_filteredDevices.end()) {
+    return nullptr;
+  }
+  shared_ptr<RteDeviceCollection> devices = it->second.lock();
+  if (!devices) {
+    m_filteredDevices.erase(it); // no longer used by any filtered model
+    return nullptr;
+  }
+  if (devices->m_bUseDeviceTree != bUseDeviceTree) {
+    return nullptr;
+  }
+  return devices;
+}
+
+void RteModel::CacheFilteredDevices(const vector<RtePackage*>& latestPacks, const shared_ptr<RteDeviceCollection>& devices)
+{
+  lock_guard<mutex> lock(m_filteredDevicesMutex);
+  m_filteredDevices[latestPacks] = devices;
+}
+
 void RteModel::AddItemsFromPack(RtePackage* pack)
 {
   RteItem* taxonomy = pack->GetTaxonomy();
@@ -636,8 +686,8 @@ void RteModel::InsertBundle(RteBundle* b)
 
 RteDeviceVendor* RteModel::FindDeviceVendor(const string& vendor) const
 {
-  auto it = m_deviceVendors.find(vendor);
-  if (it != m_deviceVendors.end())
+  auto it = m_devices->m_deviceVendors.find(vendor);
+  if (it != m_devices->m_deviceVendors.end())
     return it->second;
   return NULL;
 
@@ -651,7 +701,7 @@ RteDeviceVendor* RteModel::EnsureDeviceVendor(const string& vendor)
   if (dv)
     return dv;
   dv = new RteDeviceVendor(vendor);
-  m_deviceVendors[vendor] = dv;
+  m_devices->m_deviceVendors[vendor] = dv;
   return dv;
 }
 
@@ -669,10 +719,10 @@ void RteModel::GetDevices(list<RteDevice*>& devices, const string& namePattern,
 {
   if (namePattern.empty() || namePattern.find_first_of("*?[") != string::npos) {
     if (IsUseDeviceTree()) {
-      m_deviceTree->GetDevices(devices, namePattern, vendor, depth); // pattern match
+      m_devices->m_deviceTree->GetDevices(devices, namePattern, vendor, depth); // pattern match
       return;
     }
-    for (auto [_, dv] : m_deviceVendors) {
+    for (auto [_, dv] : m_devices->m_deviceVendors) {
       dv->GetDevices(devices, namePattern);
     }
     return;
@@ -694,21 +744,21 @@ RteDevice* RteModel::GetDevice(const string& deviceName, const string& vendor) c
 
     }
   } else {
-    for (auto [_, dv] : m_deviceVendors) {
+    for (auto [_, dv] : m_devices->m_deviceVendors) {
       RteDevice* d = dv->GetDevice(deviceName);
       if (d)
         return d;
     }
   }
   if (IsUseDeviceTree())
-    return dynamic_cast<RteDevice*>(m_deviceTree->GetDeviceItem(deviceName, vendor));
+    return dynamic_cast<RteDevice*>(m_devices->m_deviceTree->GetDeviceItem(deviceName, vendor));
   return NULL;
 }
 
 int RteModel::GetDeviceCount() const
 {
   int count = 0;
-  for (auto [_, dv] : m_deviceVendors) {
+  for (auto [_, dv] : m_devices->m_deviceVendors) {
     count += dv->GetCount();
   }
   return count;
@@ -724,11 +774,11 @@ int RteModel::GetDeviceCount(const string& vendor) const
 
 
 RteDeviceItemAggregate* RteModel::GetDeviceAggregate(const string& deviceName, const string& vendor) const {
-  return (m_deviceTree->GetDeviceAggregate(deviceName, vendor));
+  return (m_devices->m_deviceTree->GetDeviceAggregate(deviceName, vendor));
 }
 
 RteDeviceItemAggregate* RteModel::GetDeviceItemAggregate(const string& name, const string& vendor) const {
-  return (m_deviceTree->GetDeviceItemAggregate(name, vendor));
+  return (m_devices->m_deviceTree->GetDeviceItemAggregate(name, vendor));
 }
 
 // fill device and board information
@@ -772,7 +822,7 @@ void RteModel::FillDeviceTree(RtePackage* package)
           continue;
         if (!IsUseDeviceTree()) // additionally add device info as a tree
           continue;
-        m_deviceTree->AddDeviceItem(fam);
+        m_devices->m_deviceTree->AddDeviceItem(fam);
       }
     }
   }
@@ -783,8 +833,8 @@ void RteModel::FillDeviceTree(RtePackage* package)
       if (b == 0)
         continue;
       const string& id = b->GetID();
-      if (m_boards.find(id) == m_boards.end()) {
-        m_boards[id] = b;
+      if (m_devices->m_boards.find(id) == m_devices->m_boards.end()) {
+        m_devices->m_boards[id] = b;
       }
     }
   }
@@ -793,7 +843,7 @@ void RteModel::FillDeviceTree(RtePackage* package)
 
 void RteModel::GetBoardBooks(map<string, string>& books, const string& device, const string& vendor) const
 {
-  if (m_boards.empty())
+  if (GetBoards().empty())
     return;
   RteDevice* d = GetDevice(device, vendor);
   if (!d)
@@ -803,17 +853,20 @@ void RteModel::GetBoardBooks(map<string, string>& books, const string& device, c
   GetBoardBooks(books, ea.GetAttributes());
 }
 
-void RteModel::GetBoardBooks(map<string, string>& books, const map<string, string>& deviceAttributes) const
+void RteModel::GetBoardBooks(map<string, string>& books, const XmlAttributes& deviceAttributes) const
 {
-  if (m_boards.empty())
+  if (GetBoards().empty())
     return;
-  for (auto [_, b] : m_boards) {
-    if (b->HasCompatibleDevice(deviceAttributes)) {
+  XmlItem ea(deviceAttributes);
+  for (auto [_, b] : GetBoards()) {
+    if (b->HasCompatibleDevice(ea)) {
       b->GetBooks(books);
     }
   }
 }
 
+thread_local int RteGlobalModel::theThreadActiveProjectId = -1;
+
 RteGlobalModel::RteGlobalModel() :
   RteModel(NULL, PackageState::PS_INSTALLED),
   m_packRegistry(new RtePackRegistry()),
@@ -837,6 +890,13 @@ void RteGlobalModel::ClearModel()
   ClearProjectTargets();
   RteModel::ClearModel();
   m_packRegistry->Clear();
+  XmlStringPool::Purge(); // release attribute strings of unloaded packs
+}
+
+void RteGlobalModel::ClearKeepPacks()
+{
+  ClearProjects();
+  RteModel::ClearModel();
 }
 
 
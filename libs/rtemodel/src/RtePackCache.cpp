@@ -0,0 +1,553 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackCache.cpp
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "RtePackCache.h"
+
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+#include "RteValueAdjuster.h"
+#include "XMLTree.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <typeinfo>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static constexpr char CACHE_MAGIC[4] = { 'R', 'P', 'D', 'C' };
+static const string CACHE_FILE_EXT = ".bin";
+
+/**
+ * @brief read-only memory mapped file, falls back to reading the file into memory
+*/
+class MappedFile
+{
+public:
+  MappedFile(const string& fileName) : m_data(nullptr), m_size(0), m_mapped(false) {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(fs::path(fileName).wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+      LARGE_INTEGER size;
+      if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+          m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+          m_size = m_data ? static_cast<size_t>(size.QuadPart) : 0;
+          CloseHandle(mapping);
+        }
+      }
+      CloseHandle(file);
+    }
+#else
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd >= 0) {
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+          m_data = static_cast<const char*>(data);
+          m_size = static_cast<size_t>(st.st_size);
+        }
+      }
+      close(fd);
+    }
+#endif
+    m_mapped = m_data != nullptr;
+    if (!m_mapped && RteFsUtils::ReadFile(fileName, m_buffer)) {
+      m_data = m_buffer.data();
+      m_size = m_buffer.size();
+    }
+  }
+
+  ~MappedFile() {
+    if (!m_mapped) {
+      return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    munmap(const_cast<char*>(m_data), m_size);
+#endif
+  }
+
+  const char* GetData() const { return m_data; }
+  size_t GetSize() const { return m_size; }
+
+private:
+  const char* m_data;
+  size_t m_size;
+  bool m_mapped;
+  string m_buffer;
+};
+
+/**
+ * @brief bounds checked reader for cache entries
+*/
+class CacheReader
+{
+public:
+  CacheReader(const char* data, size_t size) : m_pos(data), m_end(data + size) {}
+
+  bool Read(void* value, size_t size) {
+    if (static_cast<size_t>(m_end - m_pos) < size) {
+      return false;
+    }
+    memcpy(value, m_pos, size);
+    m_pos += size;
+    return true;
+  }
+
+  template<typename T> bool Read(T& value) { return Read(&value, sizeof(T)); }
+
+  bool Read(string& value) {
+    uint32_t len = 0;
+    if (!Read(len) || static_cast<size_t>(m_end - m_pos) < len) {
+      return false;
+    }
+    value.assign(m_pos, len);
+    m_pos += len;
+    return true;
+  }
+
+  bool AtEnd() const { return m_pos == m_end; }
+
+private:
+  const char* m_pos;
+  const char* m_end;
+};
+
+/**
+ * @brief appends values to cache entry buffer
+*/
+class CacheWriter
+{
+public:
+  void Write(const void* value, size_t size) { m_buffer.append(static_cast<const char*>(value), size); }
+
+  template<typename T> void Write(const T& value) { Write(&value, sizeof(T)); }
+
+  void Write(const string& value) {
+    Write(static_cast<uint32_t>(value.size()));
+    m_buffer.append(value);
+  }
+
+  const string& GetBuffer() const { return m_buffer; }
+
+private:
+  string m_buffer;
+};
+
+/**
+ * @brief forwards calls to the actual item builder and records the item tree
+*/
+class RtePackCache::Recorder : public IXmlItemBuilder
+{
+public:
+  struct Node {
+    uint32_t tag = 0;
+    int32_t lineNumber = 0;
+    uint32_t childCount = 0;
+    vector<pair<uint32_t, uint32_t> > attributes;
+    vector<pair<uint32_t, uint32_t> > texts; // number of preceding children and text
+  };
+
+  Recorder(IXmlItemBuilder* builder) : m_builder(builder), m_valid(true) {}
+
+  void Clear(bool bDeleteContent = false) override {
+    IXmlItemBuilder::Clear(bDeleteContent);
+    m_builder->Clear(bDeleteContent);
+    m_nodes.clear();
+    m_stack.clear();
+    m_strings.clear();
+    m_stringIndexes.clear();
+    m_valid = true;
+  }
+
+  void SetFileName(const string& fileName) override {
+    IXmlItemBuilder::SetFileName(fileName);
+    m_builder->SetFileName(fileName);
+  }
+
+  bool CreateItem(const string& tag) override {
+    if (!m_stack.empty()) {
+      m_nodes[m_stack.back()].childCount++;
+    }
+    m_stack.push_back(m_nodes.size());
+    m_nodes.emplace_back();
+    m_nodes.back().tag = GetStringIndex(tag);
+    return m_builder->CreateItem(tag);
+  }
+
+  bool HasRoot() const override { return m_builder->HasRoot(); }
+
+  void AddItem() override { m_builder->AddItem(); }
+
+  void AddAttribute(const string& key, const string& value) override {
+    if (!m_stack.empty()) {
+      m_nodes[m_stack.back()].attributes.emplace_back(GetStringIndex(key), GetStringIndex(value));
+    }
+    m_builder->AddAttribute(key, value);
+  }
+
+  void SetText(const string& text) override {
+    if (!m_stack.empty()) {
+      Node& node = m_nodes[m_stack.back()];
+      node.texts.emplace_back(node.childCount, GetStringIndex(text));
+    }
+    m_builder->SetText(text);
+  }
+
+  void PreCreateItem() override { m_builder->PreCreateItem(); }
+
+  void PostCreateItem(bool success) override {
+    if (!m_stack.empty()) {
+      m_stack.pop_back();
+    }
+    if (!success) {
+      m_valid = false;
+    }
+    m_builder->PostCreateItem(success);
+  }
+
+  void SetLineNumber(int lineNumber) override {
+    if (!m_stack.empty()) {
+      m_nodes[m_stack.back()].lineNumber = lineNumber;
+    }
+    m_builder->SetLineNumber(lineNumber);
+  }
+
+  bool IsValid() const { return m_valid && m_stack.empty() && !m_nodes.empty(); }
+  const vector<Node>& GetNodes() const { return m_nodes; }
+  const vector<string>& GetStrings() const { return m_strings; }
+
+private:
+  uint32_t GetStringIndex(const string& s) {
+    auto it = m_stringIndexes.find(s);
+    if (it != m_stringIndexes.end()) {
+      return it->second;
+    }
+    uint32_t index = static_cast<uint32_t>(m_strings.size());
+    m_strings.push_back(s);
+    m_stringIndexes[s] = index;
+    return index;
+  }
+
+  IXmlItemBuilder* m_builder;
+  bool m_valid;
+  vector<Node> m_nodes;
+  vector<size_t> m_stack;
+  vector<string> m_strings;
+  map<string, uint32_t> m_stringIndexes;
+};
+
+static uint64_t HashBuffer(const char* data, size_t size)
+{
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+static string GetAdjusterId(const XmlValueAdjuster* adjuster)
+{
+  if (!adjuster) {
+    return RteUtils::EMPTY_STRING;
+  }
+  // adjusted values are stored: entries are only valid for the same kind of adjuster with the same settings
+  string id = typeid(*adjuster).name();
+  auto rteAdjuster = dynamic_cast<const RteValueAdjuster*>(adjuster);
+  if (rteAdjuster) {
+    id += rteAdjuster->IsConvertPathsToOS() ? ":1" : ":0";
+  }
+  return id;
+}
+
+/**
+ * @brief reads an item with its children, only validates the entry if builder is nullptr
+*/
+static bool ReadNode(CacheReader& reader, IXmlItemBuilder* builder, const vector<string>& strings, unsigned depth)
+{
+  uint32_t tag = 0, attributeCount = 0, textCount = 0, childCount = 0;
+  int32_t lineNumber = 0;
+  if (depth > 1000 || !reader.Read(tag) || !reader.Read(lineNumber) ||
+    !reader.Read(attributeCount) || tag >= strings.size()) {
+    return false;
+  }
+  if (builder) {
+    builder->PreCreateItem();
+    builder->CreateItem(strings[tag]);
+    builder->SetLineNumber(lineNumber);
+  }
+  for (uint32_t i = 0; i < attributeCount; i++) {
+    uint32_t key = 0, value = 0;
+    if (!reader.Read(key) || !reader.Read(value) || key >= strings.size() || value >= strings.size()) {
+      return false;
+    }
+    if (builder) {
+      builder->AddAttribute(strings[key], strings[value]);
+    }
+  }
+  if (!reader.Read(textCount)) {
+    return false;
+  }
+  vector<pair<uint32_t, uint32_t> > texts(textCount);
+  for (auto& [position, text] : texts) {
+    if (!reader.Read(position) || !reader.Read(text) || text >= strings.size()) {
+      return false;
+    }
+  }
+  if (!reader.Read(childCount)) {
+    return false;
+  }
+  if (builder) {
+    builder->AddItem();
+  }
+  // texts and children are replayed in document order as the parser does for mixed content
+  auto itText = texts.begin();
+  for (uint32_t i = 0; i <= childCount; i++) {
+    for (; itText != texts.end() && itText->first == i; itText++) {
+      if (builder) {
+        builder->SetText(strings[itText->second]);
+      }
+    }
+    if (i < childCount && !ReadNode(reader, builder, strings, depth + 1)) {
+      return false;
+    }
+  }
+  if (itText != texts.end()) {
+    return false;
+  }
+  if (builder) {
+    builder->PostCreateItem(true);
+  }
+  return true;
+}
+
+RtePackCache::RtePackCache(const string& cacheDir) :
+  m_cacheDir(cacheDir)
+{
+}
+
+string RtePackCache::GetCacheFile(const string& pdscFile) const
+{
+  stringstream ss;
+  ss << hex << HashBuffer(pdscFile.data(), pdscFile.size());
+  return m_cacheDir + '/' + RteUtils::ExtractFileBaseName(pdscFile) + '.' + ss.str() + CACHE_FILE_EXT;
+}
+
+bool RtePackCache::GetFileKey(const string& fileName, FileKey& key)
+{
+  error_code ec;
+  const fs::path path(fileName);
+  key.size = fs::file_size(path, ec);
+  if (ec) {
+    return false;
+  }
+  auto mtime = fs::last_write_time(path, ec);
+  if (ec) {
+    return false;
+  }
+  key.mtime = static_cast<int64_t>(mtime.time_since_epoch().count());
+  MappedFile file(fileName);
+  if (file.GetSize() != key.size) {
+    return false;
+  }
+  key.hash = HashBuffer(file.GetData(), file.GetSize());
+  return true;
+}
+
+bool RtePackCache::Parse(XMLTree* xmlTree, IXmlItemBuilder* builder, const string& pdscFile) const
+{
+  FileKey key;
+  key.adjuster = GetAdjusterId(xmlTree->GetXmlValueAdjuster());
+  bool bKey = GetFileKey(pdscFile, key);
+  if (bKey && Read(builder, pdscFile, key)) {
+    xmlTree->SetXmlItemBuilder(builder);
+    return true;
+  }
+  Recorder recorder(builder);
+  xmlTree->SetXmlItemBuilder(&recorder);
+  bool success = xmlTree->AddFileName(pdscFile, true);
+  xmlTree->SetXmlItemBuilder(builder);
+  if (success && bKey && recorder.IsValid() && xmlTree->GetErrorStrings().empty()) {
+    Write(pdscFile, key, recorder);
+  }
+  return success;
+}
+
+bool RtePackCache::Read(IXmlItemBuilder* builder, const string& pdscFile, const XmlValueAdjuster* adjuster) const
+{
+  FileKey key;
+  key.adjuster = GetAdjusterId(adjuster);
+  return GetFileKey(pdscFile, key) && Read(builder, pdscFile, key);
+}
+
+bool RtePackCache::Read(IXmlItemBuilder* builder, const string& pdscFile, const FileKey& key) const
+{
+  if (!builder) {
+    return false;
+  }
+  MappedFile file(GetCacheFile(pdscFile));
+  if (!file.GetData()) {
+    return false;
+  }
+  CacheReader reader(file.GetData(), file.GetSize());
+  char magic[sizeof(CACHE_MAGIC)];
+  uint32_t version = 0;
+  FileKey entryKey;
+  string fileName;
+  if (!reader.Read(magic, sizeof(magic)) || memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 ||
+    !reader.Read(version) || version != VERSION ||
+    !reader.Read(entryKey.size) || !reader.Read(entryKey.mtime) || !reader.Read(entryKey.hash) ||
+    entryKey.size != key.size || entryKey.mtime != key.mtime || entryKey.hash != key.hash ||
+    !reader.Read(fileName) || fileName != pdscFile ||
+    !reader.Read(entryKey.adjuster) || entryKey.adjuster != key.adjuster) {
+    return false;
+  }
+  uint32_t stringCount = 0;
+  if (!reader.Read(stringCount) || stringCount > file.GetSize()) {
+    return false;
+  }
+  vector<string> strings(stringCount);
+  for (auto& s : strings) {
+    if (!reader.Read(s)) {
+      return false;
+    }
+  }
+  uint32_t rootCount = 0;
+  if (!reader.Read(rootCount) || rootCount == 0) {
+    return false;
+  }
+  // validate the entry first: items are only created from a complete entry
+  CacheReader validator = reader;
+  for (uint32_t i = 0; i < rootCount; i++) {
+    if (!ReadNode(validator, nullptr, strings, 0)) {
+      return false;
+    }
+  }
+  if (!validator.AtEnd()) {
+    return false;
+  }
+  builder->Clear();
+  builder->SetFileName(pdscFile);
+  for (uint32_t i = 0; i < rootCount; i++) {
+    ReadNode(reader, builder, strings, 0);
+  }
+  return true;
+}
+
+bool RtePackCache::Write(const string& pdscFile, const FileKey& key, const Recorder& recorder) const
+{
+  CacheWriter writer;
+  writer.Write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  writer.Write(VERSION);
+  writer.Write(key.size);
+  writer.Write(key.mtime);
+  writer.Write(key.hash);
+  writer.Write(pdscFile);
+  writer.Write(key.adjuster);
+  const vector<string>& strings = recorder.GetStrings();
+  writer.Write(static_cast<uint32_t>(strings.size()));
+  for (auto& s : strings) {
+    writer.Write(s);
+  }
+  // nodes are recorded in document order: children follow their parent
+  const vector<Recorder::Node>& nodes = recorder.GetNodes();
+  size_t childCount = 0;
+  for (auto& node : nodes) {
+    childCount += node.childCount;
+  }
+  writer.Write(static_cast<uint32_t>(nodes.size() - childCount));
+  for (auto& node : nodes) {
+    writer.Write(node.tag);
+    writer.Write(node.lineNumber);
+    writer.Write(static_cast<uint32_t>(node.attributes.size()));
+    for (auto& [k, v] : node.attributes) {
+      writer.Write(k);
+      writer.Write(v);
+    }
+    writer.Write(static_cast<uint32_t>(node.texts.size()));
+    for (auto& [position, text] : node.texts) {
+      writer.Write(position);
+      writer.Write(text);
+    }
+    writer.Write(node.childCount);
+  }
+
+  // write to a temporary file first: concurrent readers must never see an incomplete entry
+  if (!RteFsUtils::CreateDirectories(m_cacheDir)) {
+    return false;
+  }
+  const string cacheFile = GetCacheFile(pdscFile);
+  stringstream tmpFile;
+  tmpFile << cacheFile << '.' << hex << hash<thread::id>()(this_thread::get_id())
+    << chrono::steady_clock::now().time_since_epoch().count();
+  {
+    ofstream out(tmpFile.str(), ios::binary | ios::trunc);
+    if (!out.is_open()) {
+      return false;
+    }
+    const string& buffer = writer.GetBuffer();
+    out.write(buffer.data(), buffer.size());
+    if (!out.good()) {
+      out.close();
+      RteFsUtils::RemoveFile(tmpFile.str());
+      return false;
+    }
+  }
+  error_code ec;
+  fs::rename(tmpFile.str(), cacheFile, ec);
+  if (ec) {
+    RteFsUtils::RemoveFile(tmpFile.str());
+    return false;
+  }
+  return true;
+}
+
+bool RtePackCache::Clear() const
+{
+  if (!RteFsUtils::Exists(m_cacheDir)) {
+    return true;
+  }
+  bool success = true;
+  error_code ec;
+  for (auto& entry : fs::directory_iterator(m_cacheDir, ec)) {
+    if (entry.path().extension() == CACHE_FILE_EXT && !RteFsUtils::RemoveFile(entry.path().generic_string())) {
+      success = false;
+    }
+  }
+  return success && !ec;
+}
+
+// End of RtePackCache.cpp
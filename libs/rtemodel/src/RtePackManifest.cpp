@@ -0,0 +1,359 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackManifest.cpp
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "RtePackManifest.h"
+
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+static const string MANIFEST_HEADER = "RtePackManifest";
+static const string PDSC_EXT = ".pdsc";
+
+/**
+ * @brief split manifest line into tab separated fields, empty fields are kept
+*/
+static vector<string> SplitFields(const string& line)
+{
+  vector<string> fields;
+  size_t start = 0;
+  for (size_t pos = line.find('\t'); pos != string::npos; pos = line.find('\t', start)) {
+    fields.push_back(line.substr(start, pos - start));
+    start = pos + 1;
+  }
+  fields.push_back(line.substr(start));
+  return fields;
+}
+
+/**
+ * @brief check if a value can be stored in a manifest field
+*/
+static bool IsValidField(const string& value)
+{
+  return value.find_first_of("\t\r\n") == string::npos;
+}
+
+/**
+ * @brief a time stamp within the file system time resolution of now can be followed by an unnoticed modification
+*/
+static bool IsRecent(int64_t mtime)
+{
+  const auto now = fs::file_time_type::clock::now().time_since_epoch();
+  const auto recent = chrono::duration_cast<fs::file_time_type::duration>(chrono::seconds(2));
+  return now.count() - mtime < recent.count();
+}
+
+static bool ParseInt(const string& s, int64_t& value)
+{
+  try {
+    size_t pos = 0;
+    value = stoll(s, &pos);
+    return pos == s.size();
+  } catch (const exception&) {
+    return false;
+  }
+}
+
+RtePackManifest::RtePackManifest(const string& packRoot, const string& manifestFile) :
+  m_packRoot(packRoot),
+  m_manifestFile(manifestFile),
+  m_bModified(false),
+  m_bLocalIndex(false)
+{
+}
+
+string RtePackManifest::GetLocalRepositoryIndex() const
+{
+  return m_packRoot + "/.Local/local_repository.pidx";
+}
+
+bool RtePackManifest::GetFileKey(const string& fileName, FileKey& key)
+{
+  error_code ec;
+  const fs::path path(fileName);
+  key.size = fs::file_size(path, ec);
+  if (ec) {
+    return false;
+  }
+  auto mtime = fs::last_write_time(path, ec);
+  if (ec) {
+    return false;
+  }
+  key.mtime = static_cast<int64_t>(mtime.time_since_epoch().count());
+  return !IsRecent(key.mtime);
+}
+
+bool RtePackManifest::Load()
+{
+  m_dirs.clear();
+  m_bLocalIndex = false;
+  m_localPdscFiles.clear();
+  m_packIds.clear();
+  m_bModified = false;
+
+  string content;
+  if (!RteFsUtils::ReadFile(m_manifestFile, content)) {
+    return false;
+  }
+  istringstream lines(content);
+  string line;
+  if (!getline(lines, line)) {
+    return false;
+  }
+  vector<string> header = SplitFields(line);
+  if (header.size() != 3 || header[0] != MANIFEST_HEADER || header[1] != to_string(VERSION) || header[2] != m_packRoot) {
+    return false;
+  }
+  bool success = true;
+  DirEntry* dir = nullptr;
+  while (success && getline(lines, line)) {
+    vector<string> fields = SplitFields(line);
+    const string& type = fields[0];
+    int64_t mtime = 0;
+    int64_t size = 0;
+    if (type == "D" && fields.size() == 3 && ParseInt(fields[2], mtime)) {
+      dir = &m_dirs[fields[1]];
+      dir->mtime = mtime;
+    } else if (type == "F" && fields.size() == 2 && dir) {
+      dir->files.push_back(fields[1]);
+    } else if (type == "S" && fields.size() == 2 && dir) {
+      dir->dirs.push_back(fields[1]);
+    } else if (type == "X" && fields.size() == 3 && ParseInt(fields[1], mtime) && ParseInt(fields[2], size)) {
+      m_bLocalIndex = true;
+      m_localIndexKey.mtime = mtime;
+      m_localIndexKey.size = static_cast<uint64_t>(size);
+    } else if (type == "L" && fields.size() == 4 && m_bLocalIndex) {
+      m_localPdscFiles.push_back({ fields[1], fields[2], fields[3] });
+    } else if (type == "P" && fields.size() == 6 && ParseInt(fields[2], mtime) && ParseInt(fields[3], size)) {
+      PackIdEntry& entry = m_packIds[fields[1]];
+      entry.key.mtime = mtime;
+      entry.key.size = static_cast<uint64_t>(size);
+      entry.packId = fields[4];
+      entry.version = fields[5];
+    } else {
+      success = false;
+    }
+  }
+  if (!success) {
+    // corrupted manifest: start from scratch
+    m_dirs.clear();
+    m_bLocalIndex = false;
+    m_localPdscFiles.clear();
+    m_packIds.clear();
+    m_bModified = true;
+  }
+  return success;
+}
+
+bool RtePackManifest::Save()
+{
+  if (!m_bModified) {
+    return true;
+  }
+  stringstream ss;
+  ss << MANIFEST_HEADER << '\t' << VERSION << '\t' << m_packRoot << '\n';
+  for (auto& [relPath, dir] : m_dirs) {
+    ss << "D\t" << relPath << '\t' << dir.mtime << '\n';
+    for (auto& f : dir.files) {
+      ss << "F\t" << f << '\n';
+    }
+    for (auto& d : dir.dirs) {
+      ss << "S\t" << d << '\n';
+    }
+  }
+  if (m_bLocalIndex) {
+    ss << "X\t" << m_localIndexKey.mtime << '\t' << m_localIndexKey.size << '\n';
+    for (auto& localPdsc : m_localPdscFiles) {
+      ss << "L\t" << localPdsc.vendor << '\t' << localPdsc.name << '\t' << localPdsc.pdscFile << '\n';
+    }
+  }
+  for (auto& [pdscFile, entry] : m_packIds) {
+    ss << "P\t" << pdscFile << '\t' << entry.key.mtime << '\t' << entry.key.size << '\t'
+      << entry.packId << '\t' << entry.version << '\n';
+  }
+
+  // write to a temporary file first: concurrent readers must never see an incomplete manifest
+  const string manifestDir = RteUtils::ExtractFilePath(m_manifestFile, false);
+  if (!RteFsUtils::CreateDirectories(manifestDir)) {
+    return false;
+  }
+  stringstream tmpFile;
+  tmpFile << m_manifestFile << '.' << hex << hash<thread::id>()(this_thread::get_id())
+    << chrono::steady_clock::now().time_since_epoch().count();
+  {
+    ofstream out(tmpFile.str(), ios::binary | ios::trunc);
+    if (!out.is_open()) {
+      return false;
+    }
+    const string buffer = ss.str();
+    out.write(buffer.data(), buffer.size());
+    if (!out.good()) {
+      out.close();
+      RteFsUtils::RemoveFile(tmpFile.str());
+      return false;
+    }
+  }
+  error_code ec;
+  fs::rename(tmpFile.str(), m_manifestFile, ec);
+  if (ec) {
+    RteFsUtils::RemoveFile(tmpFile.str());
+    return false;
+  }
+  m_bModified = false;
+  return true;
+}
+
+void RtePackManifest::GetPackageDescriptionFiles(list<string>& files, int depth)
+{
+  map<string, DirEntry> scanned;
+  ScanDirectory(files, RteUtils::EMPTY_STRING, depth, scanned);
+  if (scanned != m_dirs) {
+    m_dirs.swap(scanned);
+    m_bModified = true;
+  }
+}
+
+void RtePackManifest::ScanDirectory(list<string>& files, const string& relPath, int depth,
+                                    map<string, DirEntry>& scanned)
+{
+  error_code ec;
+  const fs::path folder = relPath.empty() ? RteFsUtils::AbsolutePath(m_packRoot) : RteFsUtils::AbsolutePath(m_packRoot) / relPath;
+  if (!fs::is_directory(folder, ec)) {
+    return;
+  }
+  // a directory is only listed if entries have been added, removed or renamed since the last scan
+  const int64_t mtime = static_cast<int64_t>(fs::last_write_time(folder, ec).time_since_epoch().count());
+  auto it = m_dirs.find(relPath);
+  DirEntry& dir = scanned[relPath];
+  if (!ec && it != m_dirs.end() && it->second.mtime == mtime) {
+    dir = it->second;
+  } else {
+    dir.mtime = !ec && !IsRecent(mtime) ? mtime : 0;
+    for (auto& entry : fs::directory_iterator(folder, ec)) {
+      error_code entryEc;
+      const string filename = entry.path().filename().generic_string();
+      if (entry.is_regular_file(entryEc)) {
+        auto pos = filename.rfind(PDSC_EXT);
+        if (pos != string::npos && pos == (filename.size() - PDSC_EXT.size()) && IsValidField(filename)) {
+          dir.files.push_back(filename);
+        }
+      } else if (entry.is_directory(entryEc) && filename.find('.') != 0 && IsValidField(filename)) { // ignore .web, .download directories
+        dir.dirs.push_back(filename);
+      }
+    }
+  }
+  for (auto& f : dir.files) {
+    files.push_back((folder / f).generic_string()); // insert full absolute path
+  }
+  if (depth <= 0 || dir.dirs.empty() || !dir.files.empty()) {
+    return; // max depth is reached or pdsc file is found: subdirectories cannot contain other pdsc files
+  }
+  for (auto& d : dir.dirs) {
+    ScanDirectory(files, relPath.empty() ? d : relPath + '/' + d, depth - 1, scanned);
+  }
+}
+
+bool RtePackManifest::GetLocalPdscFiles(vector<LocalPdsc>& localPdscFiles) const
+{
+  FileKey key;
+  if (!m_bLocalIndex || !GetFileKey(GetLocalRepositoryIndex(), key) || !(key == m_localIndexKey)) {
+    return false;
+  }
+  localPdscFiles = m_localPdscFiles;
+  return true;
+}
+
+void RtePackManifest::SetLocalPdscFiles(const vector<LocalPdsc>& localPdscFiles)
+{
+  FileKey key;
+  bool bValid = GetFileKey(GetLocalRepositoryIndex(), key);
+  for (auto& localPdsc : localPdscFiles) {
+    bValid &= IsValidField(localPdsc.vendor) && IsValidField(localPdsc.name) && IsValidField(localPdsc.pdscFile);
+  }
+  if (!bValid) {
+    if (m_bLocalIndex) {
+      m_bLocalIndex = false;
+      m_localPdscFiles.clear();
+      m_bModified = true;
+    }
+    PrunePackIds();
+    return;
+  }
+  auto isEqual = [](const LocalPdsc& a, const LocalPdsc& b) {
+    return a.vendor == b.vendor && a.name == b.name && a.pdscFile == b.pdscFile;
+  };
+  if (m_bLocalIndex && key == m_localIndexKey &&
+    equal(localPdscFiles.begin(), localPdscFiles.end(), m_localPdscFiles.begin(), m_localPdscFiles.end(), isEqual)) {
+    return;
+  }
+  m_bLocalIndex = true;
+  m_localIndexKey = key;
+  m_localPdscFiles = localPdscFiles;
+  m_bModified = true;
+  PrunePackIds();
+}
+
+void RtePackManifest::PrunePackIds()
+{
+  // pack IDs are only kept for pdsc files listed in the local repository index
+  set<string> listed;
+  for (auto& localPdsc : m_localPdscFiles) {
+    listed.insert(localPdsc.pdscFile);
+  }
+  for (auto it = m_packIds.begin(); it != m_packIds.end();) {
+    if (listed.find(it->first) == listed.end()) {
+      it = m_packIds.erase(it);
+      m_bModified = true;
+    } else {
+      it++;
+    }
+  }
+}
+
+string RtePackManifest::GetPackId(const string& pdscFile, string& version) const
+{
+  auto it = m_packIds.find(pdscFile);
+  FileKey key;
+  if (it == m_packIds.end() || !GetFileKey(pdscFile, key) || !(key == it->second.key)) {
+    return RteUtils::EMPTY_STRING;
+  }
+  version = it->second.version;
+  return it->second.packId;
+}
+
+void RtePackManifest::SetPackId(const string& pdscFile, const string& packId, const string& version)
+{
+  FileKey key;
+  if (!GetFileKey(pdscFile, key) || !IsValidField(pdscFile) || !IsValidField(packId) || !IsValidField(version)) {
+    return;
+  }
+  PackIdEntry& entry = m_packIds[pdscFile];
+  if (entry.key == key && entry.packId == packId && entry.version == version) {
+    return;
+  }
+  entry.key = key;
+  entry.packId = packId;
+  entry.version = version;
+  m_bModified = true;
+}
+
+// End of RtePackManifest.cpp
@@ -67,7 +67,7 @@ RtePackage::RtePackage(RteItem* parent, PackageState ps) :
 {
 }
 
-RtePackage::RtePackage(RteItem* parent, const map<string, string>& attributes) :
+RtePackage::RtePackage(RteItem* parent, const XmlAttributes& attributes) :
   RteRootItem(parent),
   m_packState(PackageState::PS_UNKNOWN),
   m_nDominating(-1),
@@ -491,7 +491,7 @@ RteComponent* RtePackage::FindComponents(const RteItem& item, list<RteComponent*
   return m_components ? m_components->FindComponents(item, components) : nullptr;
 }
 
-RteApi* RtePackage::GetApi(const map<string, string>& componentAttributes) const
+RteApi* RtePackage::GetApi(const XmlAttributes& componentAttributes) const
 {
   if (m_apis) {
     map<string, RteApi*>::const_iterator it;
@@ -315,7 +315,7 @@ RteComponentInstance* RteProject::GetComponentInstance(const string& id) const
 }
 
 
-RteComponentInstance* RteProject::GetApiInstance(const map<string, string>& componentAttributes) const
+RteComponentInstance* RteProject::GetApiInstance(const XmlAttributes& componentAttributes) const
 {
   for (auto [_, ci] : m_components) {
     if (ci && ci->IsApi() && ci->MatchApiAttributes(componentAttributes))
@@ -1546,12 +1546,12 @@ bool RteProject::AddTarget(RteTarget *target) {
   return true;
 }
 
-RteTarget* RteProject::CreateTarget(RteModel* filteredModel, const string& name, const map<string, string>& attributes)
+RteTarget* RteProject::CreateTarget(RteModel* filteredModel, const string& name, const XmlAttributes& attributes)
 {
   return new RteTarget(this, filteredModel, name, attributes);
 }
 
-bool RteProject::AddTarget(const string& name, const map<string, string>& attributes, bool supported, bool bForceFilterComponents)
+bool RteProject::AddTarget(const string& name, const XmlAttributes& attributes, bool supported, bool bForceFilterComponents)
 {
   if (name.empty())
     return false;
@@ -66,10 +66,11 @@ bool RteFileInfo::IsConfig() const
 }
 
 
-RteTarget::RteTarget(RteItem* parent, RteModel* filteredModel, const string& name, const map<string, string>& attributes) :
+RteTarget::RteTarget(RteItem* parent, RteModel* filteredModel, const string& name, const XmlAttributes& attributes) :
   RteItem(parent),
   m_filteredModel(filteredModel),
   m_bTargetSupported(false), // by default not supported
+  m_bComponentIndexValid(false),
   m_effectiveDevicePackage(0),
   m_deviceStartupComponent(0),
   m_device(0),
@@ -154,7 +155,7 @@ std::string RteTarget::ExpandAccessSequences(const std::string& src) const
   attributes.AddAttribute(RteConstants::AS_SOLUTION_DIR, solutionDir);
   attributes.AddAttribute(RteConstants::AS_SOLUTION_DIR_BR, solutionDir);
 
-  return RteUtils::ExpandAccessSequences(src, attributes.GetAttributes());
+  return RteUtils::ExpandAccessSequences(src, StrMap(attributes.GetAttributes()));
 }
 
 void RteTarget::ClearMissingPacks()
@@ -1142,6 +1143,8 @@ void RteTarget::ClearFilteredComponents()
 {
   m_potentialComponents.clear();
   m_filteredComponents.clear();
+  m_componentIndex.Clear();
+  m_bComponentIndexValid = false;
   m_filteredBundles.clear();
   m_filteredApis.clear();
   m_filteredFiles.clear();
@@ -1161,6 +1164,16 @@ RteComponent* RteTarget::GetComponent(const string& id) const
 }
 
 
+const RteComponentIndex& RteTarget::GetComponentIndex()
+{
+  if (!m_bComponentIndexValid) {
+    m_componentIndex.Build(m_filteredComponents);
+    m_bComponentIndexValid = true;
+  }
+  return m_componentIndex;
+}
+
+
 RteComponent* RteTarget::GetPotentialComponent(const string& id) const
 {
   auto it = m_potentialComponents.find(id);
@@ -1180,7 +1193,7 @@ RteComponent* RteTarget::GetLatestPotentialComponent(const string& id) const
   return NULL;
 }
 
-RteApi* RteTarget::GetApi(const map<string, string>& componentAttributes) const
+RteApi* RteTarget::GetApi(const XmlAttributes& componentAttributes) const
 {
   RteProject* p = GetProject();
   if (p) {
@@ -1245,6 +1258,7 @@ void RteTarget::AddFilteredComponent(RteComponent* c)
     3. Component from device pack
     4. Component with higher pack version number
   */
+  m_bComponentIndexValid = false;
   string id = c->GetComponentID(true);
   RtePackage* pack = c->GetPackage();
   RteComponent* inserted = GetComponent(id);
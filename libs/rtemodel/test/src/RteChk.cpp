@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
 */
@@ -16,10 +16,24 @@
 #include "RteFsUtils.h"
 
 #include "ErrLog.h"
+#include "XmlAttributes.h"
 
 #include <time.h>
 #include <map>
 #include <algorithm>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <fstream>
+#include <unistd.h>
+#endif
 using namespace std;
 
 static clock_t clockInMsec() {
@@ -30,6 +44,26 @@ static clock_t clockInMsec() {
   return (t / CLOCK_PER_MSEC);
 }
 
+// resident memory of the process in bytes, 0 if not available
+static size_t residentMemory() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+    return pmc.WorkingSetSize;
+#elif defined(__APPLE__)
+  mach_task_basic_info info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+    return info.resident_size;
+#else
+  size_t pages = 0, resident = 0;
+  ifstream statm("/proc/self/statm");
+  if (statm >> pages >> resident)
+    return resident * sysconf(_SC_PAGESIZE);
+#endif
+  return 0;
+}
+
 class RteXmlParser : public XMLTreeSlim
 {
 public:
@@ -112,6 +146,8 @@ unsigned RteChk::CharToFlagValue(char ch)
     return BSP;
   case 'p':
     return PACKS;
+  case 'm':
+    return MEMORY;
   default:
     break;
   };
@@ -135,12 +171,19 @@ int RteChk::ProcessArguments(int argc, char* argv[])
 
   if (m_files.empty() && m_dirs.empty()) {
     m_os << "Usage: " << endl;
-    m_os << "RteChk [-t] [-d] FILE1.pdsc|DIR1 [DIR2 FILE2.pdsc ...]";
+    m_os << "RteChk [-t] [-d] [+m] FILE1.pdsc|DIR1 [DIR2 FILE2.pdsc ...]";
     return -1;
   }
   return 0;
 }
 
+void RteChk::PrintMemoryUsage()
+{
+  m_os << "Memory: " << residentMemory() / 1024 << " KB resident, "
+       << XmlStringPool::GetCount() << " pooled strings ("
+       << XmlStringPool::GetLength() << " chars)" << endl;
+}
+
 void RteChk::AddFileDir(const string& path) {
   error_code ec;
   if (!fs::exists(path, ec))
@@ -230,6 +273,9 @@ int RteChk::RunCheckRte()
     m_os << " (" << t4 - t3 << " ms. Total: " << t4 - t1 << " ms)";
   }
   m_os << endl;
+  if (IsFlagSet(MEMORY)) {
+    PrintMemoryUsage();
+  }
 
   m_rteModel->ClearErrors();
   if (IsFlagSet(VALIDATE)) {
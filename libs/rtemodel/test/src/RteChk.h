@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -43,6 +43,7 @@ public:
   void DumpModel();
 
   void PrintText(const std::string& str);
+  void PrintMemoryUsage();
 
   void DumpConditions(RtePackage* pack);
   void DumpComponents(RtePackage* pack);
@@ -82,6 +83,7 @@ public:
   static const unsigned PACKS = 0x0010;
   static const unsigned DFP = 0x0020;
   static const unsigned BSP = 0x0040;
+  static const unsigned MEMORY = 0x0080;
   static const unsigned ALL = 0xFFFF;
   static const unsigned NONE = 0x0000;
 
@@ -288,4 +288,61 @@ TEST_F(RteConditionTest, MissingIgnoredFulfilledSelectable) {
   EXPECT_EQ(denyExpression.Evaluate(filterContext), RteItem::IGNORED);
   EXPECT_EQ(denyExpression.Evaluate(depSolver), RteItem::IGNORED);
 }
+TEST_F(RteConditionTest, FilterCache) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  RteModel* rteModel = activeTarget->GetFilteredModel();
+  ASSERT_NE(rteModel, nullptr);
+  RtePackageInstanceInfo packInfo(nullptr, "ARM::RteTest@0.1.0");
+  RtePackage* pack = rteModel->GetPackage(packInfo);
+  ASSERT_NE(pack, nullptr);
+  ASSERT_NE(pack->GetConditions(), nullptr);
+
+  // attributes of referenced conditions are collected, component attributes are not
+  RteCondition* conditionalDependency = pack->GetCondition("Conditional Dependency");
+  ASSERT_NE(conditionalDependency, nullptr);
+  EXPECT_EQ(conditionalDependency->GetFilterAttributeNames(), vector<string>({ "Dcore" }));
+  RteCondition* denyDenyDependency = pack->GetCondition("DenyDenyDependency");
+  ASSERT_NE(denyDenyDependency, nullptr);
+  EXPECT_TRUE(denyDenyDependency->GetFilterAttributeNames().empty());
+
+  // results without cache
+  RteCondition::SetUseFilterCache(false);
+  RteCondition::ResetFilterCacheStatistics();
+  map<RteCondition*, RteItem::ConditionResult> expected;
+  RteConditionContext uncachedContext(activeTarget);
+  for (auto child : pack->GetConditions()->GetChildren()) {
+    RteCondition* condition = dynamic_cast<RteCondition*>(child);
+    ASSERT_NE(condition, nullptr);
+    expected[condition] = condition->Evaluate(&uncachedContext);
+  }
+  EXPECT_EQ(RteCondition::GetFilterCacheHits(), 0);
+  EXPECT_EQ(RteCondition::GetFilterCacheMisses(), 0);
+  EXPECT_EQ(expected[conditionalDependency], RteItem::FULFILLED);
+
+  // first context fills the cache, second one with equal target attributes reuses results
+  RteCondition::SetUseFilterCache(true);
+  RteConditionContext firstContext(activeTarget);
+  for (auto& [condition, result] : expected) {
+    EXPECT_EQ(condition->Evaluate(&firstContext), result) << condition->GetName();
+  }
+  const unsigned long long misses = RteCondition::GetFilterCacheMisses();
+  EXPECT_GT(misses, 0);
+  const unsigned long long hits = RteCondition::GetFilterCacheHits();
+  RteConditionContext secondContext(activeTarget);
+  for (auto& [condition, result] : expected) {
+    EXPECT_EQ(condition->Evaluate(&secondContext), result) << condition->GetName();
+  }
+  EXPECT_EQ(RteCondition::GetFilterCacheMisses(), misses);
+  EXPECT_EQ(RteCondition::GetFilterCacheHits(), hits + expected.size());
+
+  // dependency context is never cached
+  RteCondition::ResetFilterCacheStatistics();
+  conditionalDependency->Evaluate(activeTarget->GetDependencySolver());
+  EXPECT_EQ(RteCondition::GetFilterCacheMisses(), 0);
+}
 // end of RteConditionTest.cpp
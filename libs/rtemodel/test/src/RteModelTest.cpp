@@ -8,6 +8,9 @@
 
 #include "RteModel.h"
 #include "RteKernelSlim.h"
+#include "RtePackCache.h"
+#include "RtePackManifest.h"
+#include "RteValueAdjuster.h"
 #include "RteCprjProject.h"
 #include "CprjFile.h"
 
@@ -17,6 +20,7 @@
 #include "XMLTreeSlim.h"
 
 #include "RteFsUtils.h"
+#include "ThreadPool.h"
 
 #include <iostream>
 #include <fstream>
@@ -108,6 +112,155 @@ TEST(RteModelTest, PackRegistryLoadPacks) {
   packs.clear();
 }
 
+TEST(RteModelTest, LoadPacksParallel) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, false);
+  ASSERT_FALSE(files.empty());
+  files.push_back(files.front()); // duplicates are loaded once
+
+  RteModel serialModel(PackageState::PS_INSTALLED);
+  list<RtePackage*> serialPacks;
+  EXPECT_EQ(rteKernel.GetJobs(), 1);
+  EXPECT_TRUE(rteKernel.LoadPacks(files, serialPacks, &serialModel));
+
+  RteKernelSlim parallelKernel;
+  parallelKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  parallelKernel.SetJobs(4);
+  RteModel parallelModel(PackageState::PS_INSTALLED);
+  list<RtePackage*> parallelPacks;
+  EXPECT_TRUE(parallelKernel.LoadPacks(files, parallelPacks, &parallelModel));
+
+  // same packs in the same order
+  ASSERT_EQ(parallelPacks.size(), files.size());
+  ASSERT_EQ(parallelPacks.size(), serialPacks.size());
+  EXPECT_EQ(parallelPacks.front(), parallelPacks.back());
+  auto itSerial = serialPacks.begin();
+  for (auto pack : parallelPacks) {
+    RtePackage* serialPack = *itSerial++;
+    ASSERT_NE(pack, nullptr);
+    ASSERT_NE(serialPack, nullptr);
+    EXPECT_EQ(pack->GetPackageFileName(), serialPack->GetPackageFileName());
+    EXPECT_EQ(pack->GetID(), serialPack->GetID());
+    EXPECT_EQ(pack->GetChildCount(), serialPack->GetChildCount());
+    EXPECT_EQ(pack->GetPackageState(), PackageState::PS_INSTALLED);
+  }
+  EXPECT_EQ(parallelKernel.GetPackRegistry()->GetLoadedPacks().size(),
+            rteKernel.GetPackRegistry()->GetLoadedPacks().size());
+
+  // invalid file is reported, remaining files are loaded
+  parallelPacks.clear();
+  list<string> invalidFiles = { RteModelTestConfig::CMSIS_PACK_ROOT + "/not_existing.pdsc" };
+  EXPECT_FALSE(parallelKernel.LoadPacks(invalidFiles, parallelPacks, &parallelModel));
+  EXPECT_TRUE(parallelPacks.empty());
+}
+
+TEST(RteModelTest, FilterModelSharedDevices) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, false);
+  RteModel* rteModel = rteKernel.GetGlobalModel();
+  ASSERT_NE(rteModel, nullptr);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  rteModel->InsertPacks(packs);
+  RteDevice* device = rteModel->GetDevice("RteTest_ARMCM3", "ARM:82");
+  ASSERT_NE(device, nullptr);
+
+  // models with the same latest packs share device information
+  RteModel filtered1(rteModel);
+  RteModel filtered2(rteModel);
+  filtered1.FilterModel(rteModel, nullptr);
+  filtered2.FilterModel(rteModel, nullptr);
+  EXPECT_EQ(filtered1.GetDeviceTree(), filtered2.GetDeviceTree());
+  EXPECT_EQ(filtered1.GetDevice("RteTest_ARMCM3", "ARM:82"), device);
+  EXPECT_FALSE(filtered1.GetBoards().empty());
+
+  // repeated filtering with unchanged packs keeps device information
+  RteDeviceItemAggregate* deviceTree = filtered1.GetDeviceTree();
+  filtered2.Clear();
+  filtered1.FilterModel(rteModel, nullptr);
+  EXPECT_EQ(filtered1.GetDeviceTree(), deviceTree);
+
+  // different packs: device information is filled separately
+  RtePackageFilter filter;
+  filter.SetUseAllPacks(false);
+  filter.SetSelectedPackages({ device->GetPackageID() });
+  filtered2.SetPackageFilter(filter);
+  filtered2.FilterModel(rteModel, nullptr);
+  EXPECT_NE(filtered2.GetDeviceTree(), deviceTree);
+  EXPECT_EQ(filtered2.GetDevice("RteTest_ARMCM3", "ARM:82"), device);
+  EXPECT_LT(filtered2.GetBoards().size(), filtered1.GetBoards().size());
+
+  // cleared models do not keep device information
+  filtered1.Clear();
+  filtered2.Clear();
+  EXPECT_EQ(filtered1.GetDeviceCount(), 0);
+}
+
+TEST(RteModelTest, ConcurrentTargetFiltering) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, false);
+  RteGlobalModel* rteModel = rteKernel.GetGlobalModel();
+  ASSERT_NE(rteModel, nullptr);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  rteModel->InsertPacks(packs);
+
+  const vector<string> devices = { "RteTest_ARMCM0", "RteTest_ARMCM3", "RteTest_ARMCM4", "RteTest_ARMCM4_FP" };
+  auto createTarget = [&](const string& name) {
+    RteProject* project = rteModel->AddProject(0, new RteProject());
+    project->AddTarget(name, map<string, string>(), true, true);
+    project->SetActiveTarget(name);
+    return project->GetActiveTarget();
+  };
+  auto filterTarget = [&](RteTarget* target, const string& device) {
+    target->SetAttributes({ {"Dname", device}, {"Dvendor", "ARM:82"} });
+    target->UpdateFilterModel();
+    set<string> componentIds;
+    for (auto& [id, c] : target->GetFilteredComponents()) {
+      componentIds.insert(id);
+      if (c->GetAttribute("Cclass") == "RteTest") {
+        target->SelectComponent(c, 1, false);
+      }
+    }
+    // resolve dependencies of selected components
+    target->EvaluateComponentDependencies();
+    componentIds.insert("dependencies:" + to_string(target->GetDependencySolver()->GetConditionResult()));
+    return componentIds;
+  };
+
+  // reference results filtered one after another
+  vector<set<string> > expected;
+  for (size_t i = 0; i < devices.size(); i++) {
+    expected.push_back(filterTarget(createTarget("Reference" + to_string(i)), devices[i]));
+    EXPECT_FALSE(expected.back().empty());
+  }
+
+  // targets share the global model and are filtered concurrently
+  const size_t count = devices.size() * 4;
+  vector<RteTarget*> targets;
+  for (size_t i = 0; i < count; i++) {
+    targets.push_back(createTarget("Target" + to_string(i)));
+  }
+  vector<set<string> > results(count);
+  ThreadPool pool(4);
+  pool.ForEach(count, [&](size_t index, size_t) {
+    results[index] = filterTarget(targets[index], devices[index % devices.size()]);
+  });
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(results[i], expected[i % devices.size()]);
+    EXPECT_EQ(targets[i]->GetDeviceName(), devices[i % devices.size()]);
+  }
+}
+
 TEST(RteModelTest, LoadPacks) {
 
   RteKernelSlim rteKernel;  // here just to instantiate XMLTree parser
@@ -372,6 +525,269 @@ void RteModelPrjTest::GenerateHeadersTest(const string& project, const string& r
   EXPECT_TRUE(timestamprteComp == fs::last_write_time(rteComp, ec));
 }
 
+static string DumpItem(const RteItem* item) {
+  string dump = item->GetTag() + ":" + to_string(item->GetLineNumber()) + ":" + item->GetText() + "\n";
+  for (const auto& [key, value] : item->GetAttributes()) {
+    dump += " " + key + "=" + value + "\n";
+  }
+  for (auto child : item->GetChildren()) {
+    dump += DumpItem(child);
+  }
+  return dump + "/" + item->GetTag() + "\n";
+}
+
+TEST_F(RteModelPrjTest, LoadPacksPackCache) {
+  const string packRoot = RteFsUtils::AbsolutePath(RteModelTestConfig::packsDir).generic_string();
+  list<string> files;
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(packRoot);
+  rteKernel.GetEffectivePdscFiles(files, false);
+  ASSERT_FALSE(files.empty());
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  ASSERT_EQ(packs.size(), files.size());
+
+  // pack cache is disabled by default
+  const string cacheDir = packRoot + "/.Local/.cache";
+  EXPECT_EQ(rteKernel.GetPackCacheDir(), cacheDir);
+  EXPECT_FALSE(rteKernel.IsUsePackCache());
+  EXPECT_FALSE(RteFsUtils::Exists(cacheDir));
+
+  // first run creates cache entries, second run reads them
+  for (int run = 0; run < 2; run++) {
+    RteKernelSlim cachedKernel;
+    cachedKernel.SetCmsisPackRoot(packRoot);
+    cachedKernel.SetUsePackCache(true);
+    cachedKernel.SetJobs(run == 0 ? 1 : 4);
+    list<RtePackage*> cachedPacks;
+    EXPECT_TRUE(cachedKernel.LoadPacks(files, cachedPacks));
+    EXPECT_EQ(RteFsUtils::CountFilesInFolder(cacheDir), (int)files.size());
+    ASSERT_EQ(cachedPacks.size(), packs.size());
+    auto it = packs.begin();
+    for (auto cachedPack : cachedPacks) {
+      RtePackage* pack = *it++;
+      EXPECT_EQ(cachedPack->GetPackageFileName(), pack->GetPackageFileName());
+      EXPECT_EQ(DumpItem(cachedPack), DumpItem(pack));
+    }
+  }
+
+  const string& pdscFile = files.front();
+  RtePackCache packCache(cacheDir);
+  RteValueAdjuster adjuster(false); // as used by RteKernelSlim
+  RteItemBuilder builder;
+  EXPECT_TRUE(packCache.Read(&builder, pdscFile, &adjuster));
+  ASSERT_NE(builder.GetPack(), nullptr);
+  EXPECT_EQ(DumpItem(builder.GetPack()), DumpItem(packs.front()));
+  delete builder.GetPack();
+
+  // entry is only valid for the adjuster it has been created with
+  RteValueAdjuster convertingAdjuster(true);
+  RteItemBuilder builder0;
+  EXPECT_FALSE(packCache.Read(&builder0, pdscFile, &convertingAdjuster));
+  EXPECT_FALSE(packCache.Read(&builder0, pdscFile, nullptr));
+  EXPECT_EQ(builder0.GetPack(), nullptr);
+
+  // modified file invalidates the entry
+  string content;
+  ASSERT_TRUE(RteFsUtils::ReadFile(pdscFile, content));
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(pdscFile, content + "\n"));
+  RteItemBuilder builder1;
+  EXPECT_FALSE(packCache.Read(&builder1, pdscFile, &adjuster));
+  EXPECT_EQ(builder1.GetPack(), nullptr);
+
+  // corrupted entry is ignored and replaced
+  const string cacheFile = packCache.GetCacheFile(pdscFile);
+  ASSERT_TRUE(RteFsUtils::Exists(cacheFile));
+  string entry;
+  ASSERT_TRUE(RteFsUtils::ReadFile(cacheFile, entry));
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(cacheFile, entry.substr(0, entry.size() / 2)));
+  RteKernelSlim cachedKernel;
+  cachedKernel.SetCmsisPackRoot(packRoot);
+  cachedKernel.SetUsePackCache(true);
+  list<RtePackage*> cachedPacks;
+  EXPECT_TRUE(cachedKernel.LoadPacks(files, cachedPacks));
+  ASSERT_EQ(cachedPacks.size(), packs.size());
+  EXPECT_EQ(DumpItem(cachedPacks.front()), DumpItem(packs.front()));
+  RteItemBuilder builder2;
+  EXPECT_TRUE(packCache.Read(&builder2, pdscFile, &adjuster));
+  delete builder2.GetPack();
+
+  EXPECT_TRUE(packCache.Clear());
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(cacheDir), 0);
+
+  // cache directory can be moved out of the pack root
+  const string otherCacheDir = RteFsUtils::AbsolutePath(prjsDir + "/.cache").generic_string();
+  cachedKernel.SetPackCacheDir(otherCacheDir);
+  EXPECT_EQ(cachedKernel.GetPackCacheDir(), otherCacheDir);
+  EXPECT_EQ(cachedKernel.GetPackManifestFile(), otherCacheDir + "/packs.manifest");
+  cachedPacks.clear();
+  EXPECT_TRUE(cachedKernel.LoadPacks(files, cachedPacks, nullptr, true));
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(otherCacheDir), (int)files.size());
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(cacheDir), 0);
+  cachedKernel.SetPackCacheDir(RteUtils::EMPTY_STRING);
+  EXPECT_EQ(cachedKernel.GetPackCacheDir(), cacheDir);
+}
+
+/**
+ * @brief records the builder calls of the parser and of the cache replay
+*/
+class CallLogItemBuilder : public IXmlItemBuilder
+{
+public:
+  bool CreateItem(const string& tag) override { m_log += "CreateItem " + tag + "\n"; m_depth++; return true; }
+  bool HasRoot() const override { return m_depth > 0; }
+  void AddItem() override { m_log += "AddItem\n"; }
+  void AddAttribute(const string& key, const string& value) override { m_log += "AddAttribute " + key + "=" + value + "\n"; }
+  void SetText(const string& text) override { m_log += "SetText " + text + "\n"; }
+  void PreCreateItem() override { m_log += "PreCreateItem\n"; }
+  void PostCreateItem(bool success) override { m_log += "PostCreateItem " + to_string(success) + "\n"; m_depth--; }
+  void SetLineNumber(int lineNumber) override { m_log += "SetLineNumber " + to_string(lineNumber) + "\n"; }
+  const string& GetLog() const { return m_log; }
+
+private:
+  string m_log;
+  int m_depth = 0;
+};
+
+TEST_F(RteModelPrjTest, PackCacheReplayEqualsParse) {
+  const string pdscFile = RteFsUtils::AbsolutePath(prjsDir + "/MixedContent/ARM.MixedContent.pdsc").generic_string();
+  const string cacheDir = RteFsUtils::AbsolutePath(prjsDir + "/MixedContent/.cache").generic_string();
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(pdscFile,
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<package schemaVersion=\"1.7.7\">\n"
+    "  <vendor>ARM</vendor>\n"
+    "  <name>MixedContent</name>\n"
+    "  <description><b>bold</b><i/>text after children</description>\n"
+    "  <components>\n"
+    "    <component Cclass=\"Device\" Cgroup=\"Startup\">\n"
+    "      <files><file category=\"source\" name=\"Source\\startup.c\"/></files>\n"
+    "    </component>\n"
+    "  </components>\n"
+    "</package>\n"));
+
+  // parser without cache
+  RteXmlTreeSlim xmlTree(nullptr);
+  CallLogItemBuilder parsedLog;
+  xmlTree.SetXmlItemBuilder(&parsedLog);
+  ASSERT_TRUE(xmlTree.AddFileName(pdscFile, true));
+  ASSERT_NE(parsedLog.GetLog().find("PostCreateItem 1\nSetText text after children"), string::npos);
+
+  // first call parses and creates the entry, second call replays the entry
+  RtePackCache packCache(cacheDir);
+  for (int run = 0; run < 2; run++) {
+    CallLogItemBuilder cachedLog;
+    xmlTree.Clear();
+    EXPECT_TRUE(packCache.Parse(&xmlTree, &cachedLog, pdscFile));
+    EXPECT_EQ(cachedLog.GetLog(), parsedLog.GetLog());
+  }
+  CallLogItemBuilder replayedLog;
+  EXPECT_TRUE(packCache.Read(&replayedLog, pdscFile, xmlTree.GetXmlValueAdjuster()));
+  EXPECT_EQ(replayedLog.GetLog(), parsedLog.GetLog());
+}
+
+TEST_F(RteModelPrjTest, GetEffectivePdscFilesPackManifest) {
+  const string packRoot = RteFsUtils::AbsolutePath(RteModelTestConfig::packsDir).generic_string();
+  map<string, string, RtePackageComparator> pdscMap;
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(packRoot);
+  EXPECT_TRUE(rteKernel.GetEffectivePdscFilesAsMap(pdscMap, false));
+  ASSERT_FALSE(pdscMap.empty());
+  const string manifestFile = rteKernel.GetPackManifestFile();
+  EXPECT_EQ(manifestFile, packRoot + "/.Local/.cache/packs.manifest");
+  EXPECT_FALSE(RteFsUtils::Exists(manifestFile));
+
+  // entries modified just now are not trusted, move time stamps of copied packs to the past
+  error_code ec;
+  const auto past = fs::file_time_type::clock::now() - chrono::hours(1);
+  for (auto& entry : fs::recursive_directory_iterator(packRoot, ec)) {
+    fs::last_write_time(entry.path(), past, ec);
+  }
+  fs::last_write_time(packRoot, past, ec);
+  for (auto& entry : fs::recursive_directory_iterator(RteModelTestConfig::localPacks, ec)) {
+    fs::last_write_time(entry.path(), past, ec);
+  }
+
+  // first run creates the manifest, second run reads it
+  for (int run = 0; run < 2; run++) {
+    RteKernelSlim cachedKernel;
+    cachedKernel.SetCmsisPackRoot(packRoot);
+    cachedKernel.SetUsePackCache(true);
+    map<string, string, RtePackageComparator> cachedMap;
+    EXPECT_TRUE(cachedKernel.GetEffectivePdscFilesAsMap(cachedMap, false));
+    EXPECT_EQ(cachedMap, pdscMap);
+    EXPECT_TRUE(RteFsUtils::Exists(manifestFile));
+  }
+  RtePackManifest manifest(packRoot, manifestFile);
+  EXPECT_TRUE(manifest.Load());
+  list<string> files;
+  manifest.GetPackageDescriptionFiles(files, 3);
+  EXPECT_FALSE(manifest.IsModified());
+
+  // unchanged directory is taken from the manifest
+  auto installed = find_if(pdscMap.begin(), pdscMap.end(), [&packRoot](const auto& entry) {
+    return entry.second.find(packRoot + '/') == 0;
+  });
+  ASSERT_NE(installed, pdscMap.end());
+  const string& pdscFile = installed->second;
+  const string installedPdsc = RteFsUtils::ParentPath(pdscFile) + "/Installed.Pack.pdsc";
+  const fs::path versionDir = RteFsUtils::ParentPath(installedPdsc);
+  ASSERT_TRUE(RteFsUtils::CopyCheckFile(pdscFile, installedPdsc, false));
+  fs::last_write_time(versionDir, past, ec);
+  files.clear();
+  manifest.GetPackageDescriptionFiles(files, 3);
+  EXPECT_EQ(find(files.begin(), files.end(), installedPdsc), files.end());
+
+  // modified directory is listed again
+  fs::last_write_time(versionDir, past + chrono::minutes(1), ec);
+  files.clear();
+  manifest.GetPackageDescriptionFiles(files, 3);
+  EXPECT_NE(find(files.begin(), files.end(), installedPdsc), files.end());
+  EXPECT_TRUE(manifest.IsModified());
+  EXPECT_TRUE(manifest.Save());
+  EXPECT_FALSE(manifest.IsModified());
+
+  // corrupted manifest is ignored and replaced
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(manifestFile, "RtePackManifest\t1\t" + packRoot + "\nD\tARM"));
+  RteFsUtils::RemoveFile(installedPdsc);
+  RteKernelSlim cachedKernel;
+  cachedKernel.SetCmsisPackRoot(packRoot);
+  cachedKernel.SetUsePackCache(true);
+  map<string, string, RtePackageComparator> cachedMap;
+  EXPECT_TRUE(cachedKernel.GetEffectivePdscFilesAsMap(cachedMap, false));
+  EXPECT_EQ(cachedMap, pdscMap);
+  EXPECT_TRUE(manifest.Load());
+
+  // pack ID of a pack removed from the local repository index is pruned on rescan
+  vector<RtePackManifest::LocalPdsc> localPdscFiles;
+  ASSERT_TRUE(manifest.GetLocalPdscFiles(localPdscFiles));
+  ASSERT_GT(localPdscFiles.size(), 1U);
+  const string removedPdsc = localPdscFiles.front().pdscFile;
+  const string keptPdsc = localPdscFiles.back().pdscFile;
+  string version;
+  EXPECT_FALSE(manifest.GetPackId(removedPdsc, version).empty());
+  const string localIndex = manifest.GetLocalRepositoryIndex();
+  string index;
+  ASSERT_TRUE(RteFsUtils::ReadFile(localIndex, index));
+  const string removedEntry = "<pdsc name=\"" + localPdscFiles.front().name + "\"";
+  const size_t pos = index.find(removedEntry);
+  ASSERT_NE(pos, string::npos);
+  index.erase(pos, index.find('\n', pos) + 1 - pos);
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(localIndex, index));
+  fs::last_write_time(localIndex, past + chrono::minutes(1), ec);
+  RteKernelSlim rescanKernel;
+  rescanKernel.SetCmsisPackRoot(packRoot);
+  rescanKernel.SetUsePackCache(true);
+  cachedMap.clear();
+  EXPECT_TRUE(rescanKernel.GetEffectivePdscFilesAsMap(cachedMap, false));
+  EXPECT_EQ(cachedMap.size(), pdscMap.size() - 1);
+  EXPECT_TRUE(manifest.Load());
+  EXPECT_TRUE(manifest.GetPackId(removedPdsc, version).empty());
+  EXPECT_FALSE(manifest.GetPackId(keptPdsc, version).empty());
+  string content;
+  ASSERT_TRUE(RteFsUtils::ReadFile(manifestFile, content));
+  EXPECT_EQ(content.find(removedPdsc), string::npos);
+}
+
 TEST_F(RteModelPrjTest, LoadCprj) {
 
   RteKernelSlim rteKernel;
@@ -545,6 +961,45 @@ TEST_F(RteModelPrjTest, ExtGenAndAccessSeq) {
   EXPECT_EQ(res, "RteModelTestProjects/RteTestM3/RteTest Test board/");
 }
 
+TEST_F(RteModelPrjTest, ComponentIndex) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  const RteComponentMap& components = activeTarget->GetFilteredComponents();
+  const RteComponentIndex& index = activeTarget->GetComponentIndex();
+  ASSERT_EQ(index.GetCount(), components.size());
+  vector<string> ids;
+  for (auto& [id, c] : components) {
+    ids.push_back(id);
+  }
+
+  // index lookup must give the same result as a substring search in all IDs
+  const vector<string> filters{ "", "RteTest", "ARM::", "::RteTest", "ARM::RteTest:", "Test:Dep", ":Dependency:",
+    "Dependency:Variant", "&", "&Variant", "@0.", "@0.9.9", "e", ":", "::", "Dependency Variant", "RteTest Unknown", "Unknown" };
+  for (auto& filter : filters) {
+    const set<string> words = RteUtils::SplitStringToSet(filter);
+    vector<string> expected;
+    RteUtils::ApplyFilter(ids, words, expected);
+    RteComponentMap result;
+    index.ApplyFilter(words, result);
+    vector<string> resultIds;
+    for (auto& [id, c] : result) {
+      resultIds.push_back(id);
+      EXPECT_EQ(c, components.at(id));
+    }
+    EXPECT_EQ(resultIds, expected) << "filter '" << filter << "'";
+  }
+
+  // index is rebuilt after filtering
+  activeTarget->ClearFilteredComponents();
+  EXPECT_EQ(activeTarget->GetComponentIndex().GetCount(), 0);
+  activeTarget->UpdateFilterModel();
+  EXPECT_EQ(activeTarget->GetComponentIndex().GetCount(), components.size());
+}
+
 TEST_F(RteModelPrjTest, LoadCprjPacReq) {
 
   RteKernelSlim rteKernel;
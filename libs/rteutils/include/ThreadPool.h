@@ -0,0 +1,66 @@
+#ifndef ThreadPool_H
+#define ThreadPool_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file ThreadPool.h
+  * @brief Simple worker pool to process independent work items concurrently
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @brief distributes work items over a number of worker threads.
+ * Work items are identified by their index, callers store results per index
+ * and merge them afterwards in index order to keep the output deterministic.
+*/
+class ThreadPool
+{
+public:
+  /**
+   * @brief constructor
+   * @param jobs maximum number of worker threads, 0 to use number of hardware threads
+  */
+  ThreadPool(unsigned jobs = 0);
+
+  /**
+   * @brief getter for maximum number of worker threads
+   * @return number of worker threads, at least 1
+  */
+  unsigned GetJobs() const { return m_jobs; }
+
+  /**
+   * @brief getter for number of workers used to process given number of items
+   * @param count number of work items
+   * @return number of workers, at least 1
+  */
+  size_t GetWorkerCount(size_t count) const;
+
+  /**
+   * @brief process work items, returns when all items are processed.
+   * Items are processed in the calling thread if only one worker is required.
+   * The first exception thrown by a work item is re-thrown in the calling thread.
+   * @param count number of work items
+   * @param func function to call for each item: func(item index, worker index)
+  */
+  void ForEach(size_t count, const std::function<void(size_t, size_t)>& func) const;
+
+  /**
+   * @brief get number of concurrent threads supported by the hardware
+   * @return number of hardware threads, at least 1
+  */
+  static unsigned GetHardwareJobs();
+
+private:
+  unsigned m_jobs;
+};
+
+#endif // ThreadPool_H
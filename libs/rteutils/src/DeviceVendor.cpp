@@ -6,7 +6,7 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -16,12 +16,17 @@
 
 #include "RteUtils.h"
 
+#include <mutex>
+
 using namespace std;
 
 // static data members
 std::string DeviceVendor::NO_VENDOR("NO_VENDOR:0");
 std::string DeviceVendor::NO_MCU("NO_MCU");
 
+// maps are filled on first use, that can happen in concurrent threads
+static mutex vendorMapsMutex;
+
 map<string, string> DeviceVendor::m_vendorNameToId;
 map<string, string> DeviceVendor::m_vendorIdToName;
 map<string, string> DeviceVendor::m_vendorIdToId;
@@ -48,6 +53,7 @@ bool DeviceVendor::Match(const string& vendor1, const string& vendor2)
 
 const map<string, string>& DeviceVendor::GetVendorIdToIdMap()
 {
+  lock_guard<mutex> lock(vendorMapsMutex);
   if (m_vendorIdToId.empty()) {
     m_vendorIdToId["97"] = "21"; // EnergyMicro -> Silicon Labs
     m_vendorIdToId["100"] = "19"; // Spansion -> Cypress
@@ -69,6 +75,7 @@ const string& DeviceVendor::VendorIDToOfficialID(const string& vendorSuffix)
 
 const map<string, string>& DeviceVendor::GetVendorNameToIdMap()
 {
+  lock_guard<mutex> lock(vendorMapsMutex);
   if (m_vendorNameToId.empty()) {
     m_vendorNameToId["NO_VENDOR"] = "0";
     m_vendorNameToId["3PEAK"] = "177";
@@ -226,6 +233,7 @@ const string& DeviceVendor::VendorNameToID(const string& vendorPrefix)
 
 const map<string, string>& DeviceVendor::GetVendorIdToNameMap()
 {
+  lock_guard<mutex> lock(vendorMapsMutex);
   if (m_vendorIdToName.empty()) {
     m_vendorIdToName["0"] = "NO_VENDOR";
     m_vendorIdToName["177"] = "3PEAK";
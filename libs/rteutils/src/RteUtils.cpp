@@ -18,6 +18,7 @@
 #include <cstring>
 #include <sstream>
 #include <regex>
+#include <unordered_set>
 
 using namespace std;
 
@@ -587,6 +588,7 @@ bool RteUtils::GetAccessSequence(size_t& offset, const string& src, string& sequ
 
 void RteUtils::ApplyFilter(const vector<string>& origin, const set<string>& filter, vector<string>& result) {
   result.clear();
+  unordered_set<string> added; // avoid linear search for duplicates
   for (const auto& item : origin) {
     bool match = true;
     for (const auto& word : filter) {
@@ -598,8 +600,8 @@ void RteUtils::ApplyFilter(const vector<string>& origin, const set<string>& filt
         break;
       }
     }
-    if (match) {
-      CollectionUtils::PushBackUniquely(result, item);
+    if (match && added.insert(item).second) {
+      result.push_back(item);
     }
   }
 }
@@ -0,0 +1,85 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file ThreadPool.cpp
+  * @brief Simple worker pool to process independent work items concurrently
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+ThreadPool::ThreadPool(unsigned jobs) :
+  m_jobs(jobs > 0 ? jobs : GetHardwareJobs())
+{
+}
+
+unsigned ThreadPool::GetHardwareJobs()
+{
+  unsigned jobs = thread::hardware_concurrency();
+  return jobs > 0 ? jobs : 1;
+}
+
+size_t ThreadPool::GetWorkerCount(size_t count) const
+{
+  size_t workers = count < m_jobs ? count : m_jobs;
+  return workers > 0 ? workers : 1;
+}
+
+void ThreadPool::ForEach(size_t count, const function<void(size_t, size_t)>& func) const
+{
+  const size_t workers = GetWorkerCount(count);
+  if (workers <= 1) {
+    for (size_t i = 0; i < count; i++) {
+      func(i, 0);
+    }
+    return;
+  }
+
+  atomic<size_t> next(0);
+  mutex exceptionMutex;
+  exception_ptr firstException;
+  size_t firstExceptionIndex = count;
+
+  auto worker = [&](size_t workerIndex) {
+    for (size_t i = next++; i < count; i = next++) {
+      try {
+        func(i, workerIndex);
+      } catch (...) {
+        lock_guard<mutex> lock(exceptionMutex);
+        if (i < firstExceptionIndex) {
+          firstExceptionIndex = i;
+          firstException = current_exception();
+        }
+      }
+    }
+  };
+
+  vector<thread> threads;
+  threads.reserve(workers - 1);
+  for (size_t w = 1; w < workers; w++) {
+    threads.emplace_back(worker, w);
+  }
+  worker(0); // the calling thread is worker 0
+  for (auto& t : threads) {
+    t.join();
+  }
+  if (firstException) {
+    rethrow_exception(firstException);
+  }
+}
+
+// End of ThreadPool.cpp
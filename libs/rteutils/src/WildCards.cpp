@@ -13,7 +13,206 @@
 /******************************************************************************/
 
 #include "WildCards.h"
+
+#include <bitset>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief wild card pattern compiled once and matched without regular expression.
+ * The pattern is matched with the same result as std::regex_match() with WildCards::ToRegEx(pattern):
+ * '*' and '?' match any character except line terminators, '[]' sets of alphanumeric characters and ranges
+ * are supported. Patterns with other regular expression syntax are matched by a precompiled std::regex.
+*/
+class WildCardPattern
+{
+public:
+  WildCardPattern(const std::string& pattern);
+  bool Match(const std::string& s) const;
+
+private:
+  enum TokenType { LITERAL, ANY, STAR, SET };
+  struct Token {
+    TokenType type;
+    char ch;
+    size_t set; // index in m_sets
+  };
+
+  bool Compile(const std::string& pattern);
+  bool CompileSet(const std::string& pattern, size_t& pos);
+  bool MatchToken(const Token& t, char ch) const;
+
+  std::vector<Token> m_tokens;
+  std::vector<std::bitset<256> > m_sets;
+  std::unique_ptr<std::regex> m_regex; // fallback for patterns with regular expression syntax
+  bool m_bValid;
+};
+
+WildCardPattern::WildCardPattern(const std::string& pattern) :
+  m_bValid(true)
+{
+  if (Compile(pattern)) {
+    return;
+  }
+  m_tokens.clear();
+  m_sets.clear();
+  try {
+    m_regex = std::make_unique<std::regex>(WildCards::ToRegEx(pattern));
+  } catch (const std::regex_error&) {
+    m_bValid = false; // pattern never matches
+  }
+}
+
+bool WildCardPattern::Compile(const std::string& pattern)
+{
+  for (size_t pos = 0; pos < pattern.size(); pos++) {
+    const char ch = pattern[pos];
+    switch (ch) {
+    case '*':
+      if (m_tokens.empty() || m_tokens.back().type != STAR) { // consecutive stars are equivalent to one
+        m_tokens.push_back({ STAR, ch, 0 });
+      }
+      break;
+    case '?':
+      m_tokens.push_back({ ANY, ch, 0 });
+      break;
+    case '[':
+      if (!CompileSet(pattern, pos)) {
+        return false;
+      }
+      break;
+    case ']':
+    case '\\':
+    case '^':
+    case '|':
+    case '\n':
+    case '\r':
+      return false; // regular expression syntax or line terminator
+    default:
+      m_tokens.push_back({ LITERAL, ch, 0 });
+      break;
+    }
+  }
+  return true;
+}
+
+bool WildCardPattern::CompileSet(const std::string& pattern, size_t& pos)
+{
+  auto isSetChar = [](char ch) { return isalnum(static_cast<unsigned char>(ch)) || ch == '_'; };
+  const size_t end = pattern.find(']', pos + 1);
+  if (end == std::string::npos || end == pos + 1) {
+    return false; // incomplete or empty set
+  }
+  std::bitset<256> set;
+  for (size_t i = pos + 1; i < end; i++) {
+    const unsigned char first = static_cast<unsigned char>(pattern[i]);
+    if (!isSetChar(first)) {
+      return false;
+    }
+    if (i + 2 < end && pattern[i + 1] == '-') {
+      const unsigned char last = static_cast<unsigned char>(pattern[i + 2]);
+      if (!isSetChar(last)) {
+        return false;
+      }
+      if (first > last) {
+        m_bValid = false; // invalid range: regular expression error
+      }
+      for (unsigned c = first; c <= last; c++) {
+        set.set(c);
+      }
+      i += 2;
+    } else if (pattern[i + 1] == '-') {
+      return false; // '-' at the end of the set
+    } else {
+      set.set(first);
+    }
+  }
+  m_tokens.push_back({ SET, '[', m_sets.size() });
+  m_sets.push_back(set);
+  pos = end;
+  return true;
+}
+
+bool WildCardPattern::MatchToken(const Token& t, char ch) const
+{
+  switch (t.type) {
+  case LITERAL:
+    return t.ch == ch;
+  case SET:
+    return m_sets[t.set].test(static_cast<unsigned char>(ch));
+  default: // ANY
+    return true;
+  }
+}
+
+bool WildCardPattern::Match(const std::string& s) const
+{
+  if (!m_bValid) {
+    return false;
+  }
+  if (m_regex) {
+    return std::regex_match(s, *m_regex);
+  }
+  if (s.find_first_of("\n\r") != std::string::npos) {
+    return false; // line terminators can only be matched by regular expression patterns
+  }
+  // greedy matching with backtracking to the last star: a later star can absorb
+  // any characters an earlier star would take, so O(n * m) in the worst case
+  const size_t nTokens = m_tokens.size();
+  size_t si = 0;
+  size_t ti = 0;
+  size_t starTi = std::string::npos;
+  size_t starSi = 0;
+  while (si < s.size()) {
+    if (ti < nTokens && m_tokens[ti].type == STAR) {
+      starTi = ti++;
+      starSi = si;
+    } else if (ti < nTokens && MatchToken(m_tokens[ti], s[si])) {
+      ti++;
+      si++;
+    } else if (starTi != std::string::npos) {
+      ti = starTi + 1;
+      si = ++starSi;
+    } else {
+      return false;
+    }
+  }
+  while (ti < nTokens && m_tokens[ti].type == STAR) {
+    ti++;
+  }
+  return ti == nTokens;
+}
+
+/**
+ * @brief get compiled pattern, patterns are compiled once and shared between threads
+*/
+std::shared_ptr<const WildCardPattern> GetPattern(const std::string& pattern)
+{
+  static const size_t MAX_CACHED_PATTERNS = 8192;
+  static std::shared_mutex cacheMutex;
+  static std::unordered_map<std::string, std::shared_ptr<const WildCardPattern> > cache;
+  {
+    std::shared_lock<std::shared_mutex> lock(cacheMutex);
+    auto it = cache.find(pattern);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+  auto compiled = std::make_shared<const WildCardPattern>(pattern);
+  std::unique_lock<std::shared_mutex> lock(cacheMutex);
+  if (cache.size() >= MAX_CACHED_PATTERNS) {
+    cache.clear(); // patterns in use are kept alive by their owners
+  }
+  return cache.emplace(pattern, compiled).first->second;
+}
+
+} // namespace
 
 
 bool WildCards::Match(const std::string& s1, const std::string& s2)
@@ -80,13 +279,7 @@ bool WildCards::IsWildcardPattern(const std::string& s)
 
 bool WildCards::MatchToPattern(const std::string& s, const std::string& pattern)
 {
-  try {
-    std::regex e(ToRegEx(pattern));
-    return std::regex_match(s, e);
-  } catch (const std::regex_error&) {
-    // fall through, return false if regex has an error
-  }
-  return false;
+  return GetPattern(pattern)->Match(s);
 }
 
 // End of WildCards.cpp
@@ -9,6 +9,8 @@
 
 #include "gtest/gtest.h"
 
+#include <regex>
+
 using namespace std;
 
 
@@ -242,6 +244,26 @@ TEST(RteUtilsTest, WildCardMatch) {
   }
 }
 
+TEST(RteUtilsTest, WildCardMatchToPattern) {
+  // compiled patterns must give the same result as regular expressions created by ToRegEx()
+  auto regexMatch = [](const string& s, const string& pattern) {
+    try {
+      return regex_match(s, regex(WildCards::ToRegEx(pattern)));
+    } catch (const regex_error&) {
+      return false;
+    }
+  };
+  const vector<string> patterns{ "", "*", "?", "**?", "a*b*c", "*a?c*", "[abc]*", "[a-c][0-9]?", "[c-a]*", "[]*",
+    "[a-]*", "[^a]*", "[.]", "[*]", "[?]", "a.c", "a+c", "(a)", "${a}", "a|b", "^a", "a\\b", "a]", "[ab", "STM32F10[123]?[CDE]" };
+  const vector<string> strings{ "", "a", "abc", "aXbYc", "zabcz", "b1", "b1x", "a0", "-", ".", "*", "?", "^a", "a\\b",
+    "a]", "${a}", "(a)", "a|b", "a\nc", "a\rc", "\n", "STM32F103ZE", "STM32F104ZE" };
+  for (auto& pattern : patterns) {
+    for (auto& s : strings) {
+      EXPECT_EQ(WildCards::MatchToPattern(s, pattern), regexMatch(s, pattern)) << "'" << s << "' & '" << pattern << "'";
+    }
+  }
+}
+
 TEST(RteUtilsTest, AlnumCmp_Char) {
   EXPECT_EQ( -1, AlnumCmp::Compare(nullptr, "2.1"));
   EXPECT_EQ(  1, AlnumCmp::Compare("10.1", nullptr));
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "ThreadPool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+TEST(ThreadPoolTest, WorkerCount) {
+  EXPECT_GE(ThreadPool::GetHardwareJobs(), 1U);
+  EXPECT_EQ(ThreadPool().GetJobs(), ThreadPool::GetHardwareJobs());
+
+  ThreadPool threadPool(4);
+  EXPECT_EQ(threadPool.GetJobs(), 4U);
+  EXPECT_EQ(threadPool.GetWorkerCount(0), 1U);
+  EXPECT_EQ(threadPool.GetWorkerCount(2), 2U);
+  EXPECT_EQ(threadPool.GetWorkerCount(100), 4U);
+}
+
+TEST(ThreadPoolTest, ForEach) {
+  const size_t count = 1000;
+  for (unsigned jobs : { 1U, 2U, 8U }) {
+    ThreadPool threadPool(jobs);
+    vector<size_t> results(count, 0);
+    atomic<size_t> calls(0);
+    threadPool.ForEach(count, [&](size_t index, size_t worker) {
+      EXPECT_LT(worker, threadPool.GetWorkerCount(count));
+      results[index] = index * 2;
+      calls++;
+    });
+    EXPECT_EQ(calls, count);
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_EQ(results[i], i * 2);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, ForEachException) {
+  ThreadPool threadPool(4);
+  atomic<size_t> calls(0);
+  EXPECT_THROW(threadPool.ForEach(100, [&](size_t index, size_t) {
+    calls++;
+    if (index == 10 || index == 50) {
+      throw runtime_error(to_string(index));
+    }
+  }), runtime_error);
+  // remaining items are processed
+  EXPECT_EQ(calls, 100U);
+
+  try {
+    threadPool.ForEach(100, [&](size_t index, size_t) {
+      if (index == 10 || index == 50) {
+        throw runtime_error(to_string(index));
+      }
+    });
+  } catch (const runtime_error& e) {
+    EXPECT_EQ(string(e.what()), "10");
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "WildCards.h"
+
+#include "benchmark/benchmark.h"
+
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// typical device, processor and variant attribute values matched against pdsc patterns
+static const vector<pair<string, string>> TEST_INPUT = {
+  { "STM32F103ZE", "STM32F10[123]?[CDE]" },
+  { "STM32F407VGTx", "STM32F4*" },
+  { "RteTest_ARMCM3", "RteTest_ARMCM?" },
+  { "Cortex-M33", "Cortex-M3*" },
+  { "ARMCM4_FP", "ARMCM0*" },
+  { "cm0plus", "cm0plus" },
+  { "Compatible", "*Incompatible*" },
+  { "LPC55S69JBD100:cm33_core0", "LPC55S6?J*:cm33_core[01]" },
+};
+
+// implementation before compiled patterns: regular expression constructed for each call
+static bool RegexMatchToPattern(const string& s, const string& pattern)
+{
+  try {
+    regex e(WildCards::ToRegEx(pattern));
+    return regex_match(s, e);
+  } catch (const regex_error&) {
+    // fall through, return false if regex has an error
+  }
+  return false;
+}
+
+static void BM_RegexMatchToPattern(benchmark::State& state)
+{
+  for (auto _ : state) {
+    for (auto& [s, pattern] : TEST_INPUT) {
+      benchmark::DoNotOptimize(RegexMatchToPattern(s, pattern));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * TEST_INPUT.size());
+}
+BENCHMARK(BM_RegexMatchToPattern);
+
+static void BM_MatchToPattern(benchmark::State& state)
+{
+  for (auto _ : state) {
+    for (auto& [s, pattern] : TEST_INPUT) {
+      benchmark::DoNotOptimize(WildCards::MatchToPattern(s, pattern));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * TEST_INPUT.size());
+}
+BENCHMARK(BM_MatchToPattern)->ThreadRange(1, 8);
+
+static void BM_Match(benchmark::State& state)
+{
+  for (auto _ : state) {
+    for (auto& [s, pattern] : TEST_INPUT) {
+      benchmark::DoNotOptimize(WildCards::Match(pattern, s));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * TEST_INPUT.size());
+}
+BENCHMARK(BM_Match);
+
+// end of WildCardsBenchmark.cpp
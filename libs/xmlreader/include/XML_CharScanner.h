@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef XML_CHARSCANNER_H
+#define XML_CHARSCANNER_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief finds the next occurrence of one of a small set of stop characters in a buffer.
+ *        Used by XML_Reader to skip runs of plain characters (text, attribute strings, comments)
+ *        in one step instead of processing them character by character.
+ *        The scan uses SSE2 or AVX2 if supported by compiler and CPU and falls back to a table lookup.
+*/
+class XML_CharScanner {
+public:
+  /**
+   * @brief scan implementations
+  */
+  enum class SimdLevel {
+    NONE,                         // scalar table lookup
+    SSE2,                         // 16 bytes per step
+    AVX2,                         // 32 bytes per step
+  };
+
+  /**
+   * @brief maximum number of stop characters
+  */
+  static constexpr size_t MAX_STOP_CHARS = 8;
+
+  /**
+   * @brief constructor
+   * @param stopChars characters terminating a run, at most MAX_STOP_CHARS, further characters are ignored
+  */
+  explicit XML_CharScanner(const std::string& stopChars);
+
+  /**
+   * @brief get length of the run of characters not contained in the stop set
+   * @param buf buffer to scan
+   * @param len length of buffer
+   * @return index of the first stop character or len if none found
+  */
+  size_t Span(const char* buf, size_t len) const;
+
+  /**
+   * @brief get length of the run of characters not contained in the stop set using a given implementation
+   * @param buf buffer to scan
+   * @param len length of buffer
+   * @param level requested implementation, limited to GetSimdLevel()
+   * @return index of the first stop character or len if none found
+  */
+  size_t Span(const char* buf, size_t len, SimdLevel level) const;
+
+  /**
+   * @brief get best scan implementation supported by this build and CPU
+   * @return SimdLevel
+  */
+  static SimdLevel GetSimdLevel();
+
+private:
+  size_t SpanScalar(const char* buf, size_t len) const;
+  size_t SpanSse2(const char* buf, size_t len) const;
+  size_t SpanAvx2(const char* buf, size_t len) const;
+
+  std::string m_stopChars;
+  bool m_stopTable[256];
+};
+
+#endif // !XML_CHARSCANNER_H
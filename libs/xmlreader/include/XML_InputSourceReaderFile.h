@@ -48,6 +48,13 @@ public:
     return XML_InputSourceReader::ReadLine(buf, maxLen);
   }
 
+  size_t ReadBuffer(const char*& buf) override {
+    if (m_bFile) {
+      return 0;       // file is read in portions via ReadLine()
+    }
+    return XML_InputSourceReader::ReadBuffer(buf);
+  }
+
 protected:
   XmlTypes::Err DoOpen() override {
     if (m_source->xmlString && strlen(m_source->xmlString) > 0) {
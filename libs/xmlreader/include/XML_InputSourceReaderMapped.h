@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef XML_InputSourceReaderMapped_H
+#define XML_InputSourceReaderMapped_H
+
+#include "XML_InputSourceReaderFile.h"
+
+/**
+ * @brief input source reader mapping the whole input file into memory.
+ *        XML_Reader scans the mapped file directly instead of copying it into its stream buffer.
+ *        Falls back to reading the file via XML_InputSourceReaderFile if the file cannot be mapped, e.g. if it is empty.
+ *        Line ends are passed as stored in the file, CR characters are not removed as by text mode streams on Windows.
+*/
+class XML_InputSourceReaderMapped : public XML_InputSourceReaderFile
+{
+public:
+  XML_InputSourceReaderMapped();
+  ~XML_InputSourceReaderMapped() override;
+
+  bool IsValid() const override;
+  void Close() override;
+  size_t ReadLine(char* buf, size_t maxLen) override;
+  size_t ReadBuffer(const char*& buf) override;
+
+  /**
+   * @brief checks if the current input file is mapped into memory
+   * @return true if mapped
+  */
+  bool IsMapped() const {
+    return m_mappedData != nullptr;
+  }
+
+protected:
+  XmlTypes::Err DoOpen() override;
+
+  const char* m_mappedData;
+};
+
+#endif // !XML_InputSourceReaderMapped_H
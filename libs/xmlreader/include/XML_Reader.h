@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+* Copyright (c) 2020-2024 Arm Limited. All rights reserved.
 *
 * SPDX-License-Identifier: Apache-2.0
 */
@@ -8,6 +8,7 @@
 #define XML_READER_H
 
 #include "ErrLog.h"
+#include "XML_CharScanner.h"
 
 #include <cstdint>
 #include <string>
@@ -148,6 +149,13 @@ public:
   */
   virtual size_t ReadLine(char* buf, size_t maxLen);
 
+  /**
+   * @brief provides the remaining input without copying it, used instead of ReadLine() if supported
+   * @param buf returns pointer to the remaining input, valid until the source is closed
+   * @return size of the remaining input, 0 if not supported or end of input
+  */
+  virtual size_t ReadBuffer(const char*& buf);
+
   /**
    * @brief get size of input source (file or buffer)
    * @return size of input source
@@ -183,6 +191,8 @@ protected:
  * Theory of operation:
  * An input file or buffer (e.g. running on WebAssembly) specifies the input buffer.
  * The reader acts as stream reader and buffers portions of the input file.
+ * If the input source provides the whole input (see XML_InputSourceReader::ReadBuffer(), e.g. XML_InputSourceReaderMapped),
+ * the reader scans it directly without copying.
  * Once started, it runs on a "GetNext()" basis, returning the next XML element (see TagType), e.g.:
  * - begin or single tag
  *   -- flag is set if attributes are present
@@ -403,6 +413,14 @@ private:
   */
   size_t GetAttributeLen();
 
+  /**
+   * @brief appends characters from stream buffer to a string up to the next stop character or end of buffer
+   * @param scanner XML_CharScanner defining the stop characters
+   * @param buf string to append characters to
+   * @return number of appended characters
+  */
+  size_t ReadRun(const XML_CharScanner& scanner, std::string& buf);
+
   /**
    * @brief Get next character from stream buffer
    * @param c the next character to be processed after Getc()
@@ -424,6 +442,7 @@ private:
   size_t m_streamBufLen;
   size_t m_streamBufMaxlen;
   char *m_streamBuf;
+  const char *m_readBuf;          // m_streamBuf or buffer provided by input source
 
   XmlTypes::XmlData_t m_xmlData;
   std::list <std::string> m_xmlTagStack;
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "XML_CharScanner.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define XML_SCAN_SSE2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define XML_SCAN_AVX2
+#define XML_SCAN_TARGET_AVX2
+#elif defined(__GNUC__)
+#define XML_SCAN_AVX2
+#define XML_SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+using namespace std;
+
+namespace {
+
+#ifdef XML_SCAN_SSE2
+inline size_t FirstBit(uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+XML_CharScanner::SimdLevel DetectSimdLevel()
+{
+#if defined(XML_SCAN_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  if (osxsave && (_xgetbv(0) & 0x6) == 0x6) {
+    __cpuidex(info, 7, 0);
+    if (info[1] & (1 << 5)) {
+      return XML_CharScanner::SimdLevel::AVX2;
+    }
+  }
+  return XML_CharScanner::SimdLevel::SSE2;
+#elif defined(XML_SCAN_AVX2)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return XML_CharScanner::SimdLevel::AVX2;
+  }
+  return XML_CharScanner::SimdLevel::SSE2;
+#elif defined(XML_SCAN_SSE2)
+  return XML_CharScanner::SimdLevel::SSE2;
+#else
+  return XML_CharScanner::SimdLevel::NONE;
+#endif
+}
+
+} // namespace
+
+XML_CharScanner::XML_CharScanner(const string& stopChars) :
+  m_stopChars(stopChars.substr(0, MAX_STOP_CHARS))
+{
+  memset(m_stopTable, 0, sizeof(m_stopTable));
+  for (char c : m_stopChars) {
+    m_stopTable[static_cast<unsigned char>(c)] = true;
+  }
+}
+
+XML_CharScanner::SimdLevel XML_CharScanner::GetSimdLevel()
+{
+  static const SimdLevel level = DetectSimdLevel();
+  return level;
+}
+
+size_t XML_CharScanner::Span(const char* buf, size_t len) const
+{
+  return Span(buf, len, GetSimdLevel());
+}
+
+size_t XML_CharScanner::Span(const char* buf, size_t len, SimdLevel level) const
+{
+  if (level > GetSimdLevel()) {
+    level = GetSimdLevel();
+  }
+  switch (level) {
+    case SimdLevel::AVX2:
+      return SpanAvx2(buf, len);
+    case SimdLevel::SSE2:
+      return SpanSse2(buf, len);
+    case SimdLevel::NONE:
+    default:
+      return SpanScalar(buf, len);
+  }
+}
+
+size_t XML_CharScanner::SpanScalar(const char* buf, size_t len) const
+{
+  size_t pos = 0;
+  while (pos < len && !m_stopTable[static_cast<unsigned char>(buf[pos])]) {
+    pos++;
+  }
+  return pos;
+}
+
+size_t XML_CharScanner::SpanSse2(const char* buf, size_t len) const
+{
+#ifdef XML_SCAN_SSE2
+  const size_t count = m_stopChars.size();
+  __m128i stop[MAX_STOP_CHARS];
+  for (size_t i = 0; i < count; i++) {
+    stop[i] = _mm_set1_epi8(m_stopChars[i]);
+  }
+
+  size_t pos = 0;
+  for (; pos + 16 <= len; pos += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + pos));
+    __m128i match = _mm_setzero_si128();
+    for (size_t i = 0; i < count; i++) {
+      match = _mm_or_si128(match, _mm_cmpeq_epi8(block, stop[i]));
+    }
+    const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+    if (mask) {
+      return pos + FirstBit(mask);
+    }
+  }
+  return pos + SpanScalar(buf + pos, len - pos);
+#else
+  return SpanScalar(buf, len);
+#endif
+}
+
+#ifdef XML_SCAN_AVX2
+XML_SCAN_TARGET_AVX2
+#endif
+size_t XML_CharScanner::SpanAvx2(const char* buf, size_t len) const
+{
+#ifdef XML_SCAN_AVX2
+  const size_t count = m_stopChars.size();
+  __m256i stop[MAX_STOP_CHARS];
+  for (size_t i = 0; i < count; i++) {
+    stop[i] = _mm256_set1_epi8(m_stopChars[i]);
+  }
+
+  size_t pos = 0;
+  for (; pos + 32 <= len; pos += 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buf + pos));
+    __m256i match = _mm256_setzero_si256();
+    for (size_t i = 0; i < count; i++) {
+      match = _mm256_or_si256(match, _mm256_cmpeq_epi8(block, stop[i]));
+    }
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+    if (mask) {
+      return pos + FirstBit(mask);
+    }
+  }
+  return pos + SpanSse2(buf + pos, len - pos);
+#else
+  return SpanSse2(buf, len);
+#endif
+}
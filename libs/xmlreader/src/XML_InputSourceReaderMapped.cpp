@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "XML_InputSourceReaderMapped.h"
+
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace XmlTypes;
+
+
+XML_InputSourceReaderMapped::XML_InputSourceReaderMapped() :
+  XML_InputSourceReaderFile(),
+  m_mappedData(nullptr)
+{
+}
+
+XML_InputSourceReaderMapped::~XML_InputSourceReaderMapped()
+{
+  XML_InputSourceReaderMapped::Close();
+}
+
+bool XML_InputSourceReaderMapped::IsValid() const
+{
+  return IsMapped() || XML_InputSourceReaderFile::IsValid();
+}
+
+void XML_InputSourceReaderMapped::Close()
+{
+  if (m_mappedData) {
+#ifdef _WIN32
+    UnmapViewOfFile(m_mappedData);
+#else
+    munmap(const_cast<char*>(m_mappedData), m_size);
+#endif
+    m_mappedData = nullptr;
+    m_bFile = false;
+  }
+  XML_InputSourceReaderFile::Close();
+}
+
+size_t XML_InputSourceReaderMapped::ReadLine(char* buf, size_t maxLen)
+{
+  if (!m_mappedData) {
+    return XML_InputSourceReaderFile::ReadLine(buf, maxLen);
+  }
+  if (!buf || !m_source || m_source->seekPos >= m_size) {
+    return 0;
+  }
+  size_t readSize = m_size - m_source->seekPos;
+  if (readSize > maxLen) {
+    readSize = maxLen;
+  }
+  memcpy(buf, m_mappedData + m_source->seekPos, readSize);
+  m_source->seekPos += readSize;
+
+  return readSize;
+}
+
+size_t XML_InputSourceReaderMapped::ReadBuffer(const char*& buf)
+{
+  if (!m_mappedData) {
+    return XML_InputSourceReaderFile::ReadBuffer(buf);
+  }
+  if (!m_source || m_source->seekPos >= m_size) {
+    return 0;
+  }
+  buf = m_mappedData + m_source->seekPos;
+  size_t readSize = m_size - m_source->seekPos;
+  m_source->seekPos = m_size;
+
+  return readSize;
+}
+
+Err XML_InputSourceReaderMapped::DoOpen()
+{
+  if (m_source->xmlString && strlen(m_source->xmlString) > 0) {
+    m_bFile = false;
+    return XML_InputSourceReader::DoOpen();
+  }
+  if (!m_source->fileName.length()) {
+    return Err::ERR_NO_INPUT_FILE;
+  }
+
+  const char* data = nullptr;
+  size_t size = 0;
+#ifdef _WIN32
+  HANDLE file = CreateFileW(filesystem::path(m_source->fileName).wstring().c_str(), GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping) {
+        data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        size = data ? static_cast<size_t>(fileSize.QuadPart) : 0;
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+  }
+#else
+  int fd = open(m_source->fileName.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped != MAP_FAILED) {
+        data = static_cast<const char*>(mapped);
+        size = static_cast<size_t>(st.st_size);
+      }
+    }
+    close(fd);
+  }
+#endif
+  if (!data) {
+    return XML_InputSourceReaderFile::DoOpen();   // not mappable: read via stream
+  }
+
+  m_bFile = true;
+  m_mappedData = data;
+  m_size = size;
+  if (m_source->seekPos > m_size) {
+    return Err::ERR_OPEN_FAILED;
+  }
+
+  return Err::ERR_NOERR;
+}
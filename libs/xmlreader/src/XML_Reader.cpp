@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -34,6 +34,12 @@ const map<const UTFCode, const string> XML_Reader::m_UTFCodeText = {
   { UTFCode::UTF7    ,  "UTF7"                   },
 };
 
+// stop characters for runs processed at once by ReadNext() and ReadNextAttribute(), TAB is converted by Getc()
+static const XML_CharScanner textScanner("<&\r\n\t");
+static const XML_CharScanner attributeScanner(">\n\t");
+static const XML_CharScanner commentScanner("-/>!?\r\n\t");
+static const XML_CharScanner attrStringScanner("\"'&");
+
 
 XML_InputSourceReader::XML_InputSourceReader() :
   m_source(nullptr),
@@ -96,6 +102,19 @@ size_t XML_InputSourceReader::ReadLine(char* buf, size_t maxLen)
   return readSize;
 }
 
+size_t XML_InputSourceReader::ReadBuffer(const char*& buf)
+{
+  if(!m_source || !m_source->xmlString || m_source->seekPos >= m_size) {
+    return 0;
+  }
+
+  buf = m_source->xmlString + m_source->seekPos;
+  size_t readSize = m_size - m_source->seekPos;
+  m_source->seekPos = m_size;
+
+  return readSize;
+}
+
 XML_Reader::XML_Reader(XML_InputSourceReader* inputSourceReader) :
   m_bIsPrevText(false),
   m_bPrevTagIsSingle(false),
@@ -104,10 +123,9 @@ XML_Reader::XML_Reader(XML_InputSourceReader* inputSourceReader) :
   m_streamBufLen(0),
   m_streamBufMaxlen(MBYTE(2)),
   m_streamBuf(nullptr),
+  m_readBuf(nullptr),
   m_InputSourceReader(inputSourceReader)
 {
-  m_streamBuf = new char[m_streamBufMaxlen];
-
   if(!inputSourceReader) {
     m_InputSourceReader = new XML_InputSourceReader();
   }
@@ -184,6 +202,7 @@ Err XML_Reader::Init(const string& fileName, const std::string& xmlString)
   }
 
   m_SourceStack.clear();
+  m_xmlTagStack.clear();
 
   return NextSource(fileName, xmlString);
 }
@@ -300,6 +319,9 @@ Err XML_Reader::Close()
   }
 
   m_InputSourceReader->Close();
+  m_readBuf = nullptr;            // buffer provided by input source is no longer valid
+  m_streamBufLen = 0;
+  m_streamBufPos = 0;
 
   return Err::ERR_NOERR;
 }
@@ -311,19 +333,42 @@ size_t XML_Reader::ReadLine()
     return 0;
   }
 
-  size_t len = m_InputSourceReader->ReadLine(m_streamBuf, m_streamBufMaxlen);
+  const char* buf = nullptr;
+  size_t len = m_InputSourceReader->ReadBuffer(buf);   // whole input if provided by source
   if(len == 0) {
-    return 0;
+    if(!m_streamBuf) {
+      m_streamBuf = new char[m_streamBufMaxlen];
+    }
+    buf = m_streamBuf;
+    len = m_InputSourceReader->ReadLine(m_streamBuf, m_streamBufMaxlen);
+    if(len == 0) {
+      return 0;
+    }
   }
 
   m_xmlData.prevReadPos = m_xmlData.readPos;
   m_xmlData.readPos += len;
+  m_readBuf = buf;
   m_streamBufLen = len;
   m_streamBufPos = 0;
 
   return len;
 }
 
+size_t XML_Reader::ReadRun(const XML_CharScanner& scanner, string& buf)
+{
+  if(m_streamBufPos >= m_streamBufLen) {
+    return 0;
+  }
+
+  const char* run = m_readBuf + m_streamBufPos;
+  size_t len = scanner.Span(run, m_streamBufLen - m_streamBufPos);
+  buf.append(run, len);
+  m_streamBufPos += len;
+
+  return len;
+}
+
 bool XML_Reader::Getc(char& c)
 {
   if(m_streamBufPos >= m_streamBufLen) {
@@ -333,7 +378,7 @@ bool XML_Reader::Getc(char& c)
   }
 
   if(m_streamBufPos < m_streamBufLen) {
-    c = m_streamBuf[m_streamBufPos++];
+    c = m_readBuf[m_streamBufPos++];
   }
 
   if(c == '\t') {
@@ -345,7 +390,7 @@ bool XML_Reader::Getc(char& c)
 
 void XML_Reader::CorrectCnt(int32_t corr)
 {
-  if((m_streamBufPos + corr) < m_streamBufMaxlen) {
+  if((m_streamBufPos + corr) < m_streamBufLen) {
     m_streamBufPos += corr;
   }
 }
@@ -505,6 +550,9 @@ bool XML_Reader::ReadNext()
 
   bool bOk = true;
   do {                    // search for '<'
+    if (ReadRun(textScanner, workBuf)) {
+      c = workBuf.back();
+    }
     c_prev = c;
 
     bOk = Getc(c);
@@ -579,6 +627,14 @@ bool XML_Reader::ReadNext()
 
   if (type != TagType::TAG_TEXT) {
     do {
+      if (type == TagType::TAG_COMMENT && !isAttribute) {
+        const size_t len = ReadRun(commentScanner, workBuf);
+        if (len) {
+          c_prev2 = (len >= 3) ? workBuf[workBuf.length() - 3] : (len == 2) ? c : c_prev;
+          c_prev = (len >= 2) ? workBuf[workBuf.length() - 2] : c;
+          c = workBuf.back();
+        }
+      }
       c_prev2 = c_prev;
       c_prev = c;
 
@@ -643,6 +699,9 @@ bool XML_Reader::ReadNext()
       }
       else if ((c == ' ') && (type != TagType::TAG_DOC_HEADER) && (type != TagType::TAG_COMMENT)) {       // skip Data inside Tag
         do {
+          if (ReadRun(attributeScanner, m_xmlData.attribute)) {
+            c = m_xmlData.attribute.back();
+          }
           c_prev = c;
 
           bOk = Getc(c);
@@ -878,6 +937,16 @@ bool XML_Reader::ReadNextAttribute(bool bInorePrefixes)
   m_xmlData.attrData.clear();
 
   while(m_xmlData.attrReadPos < m_xmlData.attrLen) {
+    if(insideString && !isTag && foundAttrString < 2 && m_xmlData.attrReadPos + 1 < m_xmlData.attrLen) {
+      // copy attribute value up to closing quote or special character, the last character is checked below
+      const char* run = m_xmlData.attribute.c_str() + m_xmlData.attrReadPos;
+      size_t len = attrStringScanner.Span(run, m_xmlData.attrLen - m_xmlData.attrReadPos - 1);
+      if(len) {
+        m_xmlData.attrData.append(run, len);
+        m_xmlData.attrReadPos += len;
+        c = run[len - 1];
+      }
+    }
     cPrev = c;
     c = m_xmlData.attribute[m_xmlData.attrReadPos++];
 
@@ -920,6 +989,9 @@ bool XML_Reader::ReadNextAttribute(bool bInorePrefixes)
 
       do {
         cPrev = c;
+        if (m_xmlData.attrReadPos >= m_xmlData.attrLen) {   // no terminating semicolon
+          break;
+        }
         c = m_xmlData.attribute[m_xmlData.attrReadPos++];
         if (c == ';') {
           break;
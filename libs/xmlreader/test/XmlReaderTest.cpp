@@ -1,11 +1,19 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "gtest/gtest.h"
 #include "XML_Reader.h"
+#include "XML_InputSourceReaderFile.h"
+#include "XML_InputSourceReaderMapped.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
 
 using namespace std;
 
@@ -129,3 +137,101 @@ TEST(XmlReaderTest, ReadAttributes)
   EXPECT_FALSE(reader.HasAttributes());
   EXPECT_FALSE(reader.ReadNextAttribute(true));
 }
+
+TEST(XmlReaderTest, CharScanner)
+{
+  XML_CharScanner scanner("<&\r\n");
+  const string stopChars = "<&\r\n";
+  mt19937 gen(42);
+  uniform_int_distribution<int> dist(0, 255);
+
+  for (size_t len = 0; len < 200; len++) {
+    string buf;
+    for (size_t i = 0; i < len; i++) {
+      char c = (char)dist(gen);
+      if (stopChars.find(c) != string::npos) {
+        c = 'a';                                  // make runs long enough to cross SIMD block boundaries
+      }
+      buf += c;
+    }
+    for (size_t stop = 0; stop <= len; stop++) {
+      string text = buf;
+      if (stop < len) {
+        text[stop] = stopChars[stop % stopChars.length()];
+      }
+      for (auto level : { XML_CharScanner::SimdLevel::NONE, XML_CharScanner::SimdLevel::SSE2, XML_CharScanner::SimdLevel::AVX2 }) {
+        EXPECT_EQ(stop, scanner.Span(text.c_str(), text.length(), level));
+      }
+    }
+  }
+}
+
+static string ReadAllNodes(XML_Reader& reader)
+{
+  ostringstream ss;
+  XmlTypes::XmlNode_t node;
+  while (reader.GetNextNode(node)) {
+    ss << node.lineNo << ":" << (int)node.type << ":" << node.tag << ":" << node.data;
+    while (reader.HasAttributes() && reader.ReadNextAttribute(true)) {
+      ss << " [" << reader.GetAttributeTag() << "=" << reader.GetAttributeData() << "]";
+    }
+    ss << endl;
+  }
+  return ss.str();
+}
+
+TEST(XmlReaderTest, ReadMappedFile)
+{
+  string xmlString = theXmlString +
+    "<!-- comment with -- dashes, <tags/> and a very long line to cross SIMD block boundaries: 0123456789 0123456789 -->\n"
+    "<tabs\ta=\"\tx\ty\"\tb='1 &quot;2&quot; 3'>\ttext\twith\ttabs &#x2b; &unknown;</tabs>\r\n"
+    "<multi a=\"line1\r\nline2\" b=\"\" c='\"' d=\"x &amp\"/>\r\n"
+    "<broken>text</wrong>\n";
+
+  const string fileName = (filesystem::current_path() / "XmlReaderTest_ReadMappedFile.xml").generic_string();
+  {
+    ofstream file(fileName, ios::binary);
+    file << xmlString;
+  }
+
+  // reference: file read in portions by the stream reader
+  XML_Reader streamReader(new XML_InputSourceReaderFile());
+  ASSERT_EQ(XmlTypes::Err::ERR_NOERR, streamReader.Init(fileName, ""));
+  const string expected = ReadAllNodes(streamReader);
+  streamReader.UnInit();
+  EXPECT_NE(string::npos, expected.find("[d=x &]"));
+
+  // the stream reader opens the file in text mode, line endings are translated on Windows
+  auto normalize = [](string text) {
+#ifdef _WIN32
+    text.erase(remove(text.begin(), text.end(), '\r'), text.end());
+#endif
+    return text;
+  };
+
+  // string buffer is scanned as a whole, like the mapped file
+  XML_Reader stringReader(nullptr);
+  ASSERT_EQ(XmlTypes::Err::ERR_NOERR, stringReader.Init("", xmlString));
+  const string stringNodes = ReadAllNodes(stringReader);
+  stringReader.UnInit();
+  EXPECT_NE(string::npos, stringNodes.find("[a=line1\r\nline2]"));
+  EXPECT_EQ(expected, normalize(stringNodes));
+
+  XML_InputSourceReaderMapped* mappedSource = new XML_InputSourceReaderMapped();
+  XML_Reader mappedReader(mappedSource);
+  ASSERT_EQ(XmlTypes::Err::ERR_NOERR, mappedReader.Init(fileName, ""));
+  EXPECT_TRUE(mappedSource->IsMapped());
+  const string mappedNodes = ReadAllNodes(mappedReader);
+  EXPECT_EQ(expected, normalize(mappedNodes));
+  mappedReader.UnInit();
+  EXPECT_FALSE(mappedSource->IsMapped());
+
+  // reader can be reused
+  ASSERT_EQ(XmlTypes::Err::ERR_NOERR, mappedReader.Init(fileName, ""));
+  EXPECT_EQ(mappedNodes, ReadAllNodes(mappedReader));
+  mappedReader.UnInit();
+
+  filesystem::remove(fileName);
+  EXPECT_NE(XmlTypes::Err::ERR_NOERR, mappedReader.Init(fileName, ""));
+  mappedReader.UnInit();
+}
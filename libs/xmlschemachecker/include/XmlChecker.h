@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -19,6 +19,15 @@ public:
      * @return true if validation pass, otherwise false
     */
     static bool Validate(const std::string& xmlfile, const std::string& schemafile);
+
+    /**
+     * @brief Validates xml content with respect to schema given, e.g. of a file read from an archive
+     * @param xmlfile name of the xml file used in messages
+     * @param content xml content to be validated
+     * @param schemafile input schema file for given xml content
+     * @return true if validation pass, otherwise false
+    */
+    static bool ValidateContent(const std::string& xmlfile, const std::string& content, const std::string& schemafile);
 };
 
 #endif //XMLCHECKER_H
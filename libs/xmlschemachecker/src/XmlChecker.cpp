@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,8 +7,19 @@
 #include "XmlChecker.h"
 #include "XmlValidator.h"
 
+static XmlValidator& GetValidator()
+{
+  // one validator per thread: the parser keeps the loaded schema grammar for the following files
+  thread_local XmlValidator validator;
+  return validator;
+}
+
 bool XmlChecker::Validate(const std::string& xmlfile, const std::string& schemafile)
 {
-  XmlValidator validator;
-  return validator.Validate(xmlfile, schemafile);
+  return GetValidator().Validate(xmlfile, schemafile);
+}
+
+bool XmlChecker::ValidateContent(const std::string& xmlfile, const std::string& content, const std::string& schemafile)
+{
+  return GetValidator().Validate(xmlfile, schemafile, &content);
 }
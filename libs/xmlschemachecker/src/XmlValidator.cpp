@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -8,10 +8,11 @@
 #include "XmlValidator.h"
 #include "XmlErrorHandler.h"
 
+#include "xercesc/framework/MemBufInputSource.hpp"
 #include "xercesc/parsers/XercesDOMParser.hpp"
-#include "xercesc/framework/LocalFileInputSource.hpp"
 #include "xercesc/sax/ErrorHandler.hpp"
 #include "xercesc/sax/SAXParseException.hpp"
+#include "xercesc/validators/common/Grammar.hpp"
 
 #include <sstream>
 #include "ErrLog.h"
@@ -19,9 +20,30 @@
 using namespace std;
 using namespace XERCES_CPP_NAMESPACE;
 
+/**
+ * @brief keeps the Xerces platform initialized for the process lifetime,
+ *        XMLPlatformUtils::Initialize() and Terminate() must not be called concurrently
+*/
+class XmlPlatform
+{
+public:
+  static void Initialize() {
+    static XmlPlatform thePlatform;
+  }
+
+private:
+  XmlPlatform() {
+    XMLPlatformUtils::Initialize();
+  }
+
+  ~XmlPlatform() {
+    XMLPlatformUtils::Terminate();
+  }
+};
+
 XmlValidator::XmlValidator()
 {
-  XMLPlatformUtils::Initialize();
+  XmlPlatform::Initialize();
 
   m_domParser = new XercesDOMParser();
   m_errorHandler = new XmlErrorHandler();
@@ -37,22 +59,34 @@ XmlValidator::~XmlValidator()
 {
   delete m_domParser;
   delete m_errorHandler;
-  XMLPlatformUtils::Terminate();
 }
 
 /**
  * @brief Validate the xml file against the specified schema file
  * @param schemaFile the schema file to validate against
  * @param xmlFile the xml file to validate
+ * @param content xml content to validate instead of reading xmlFile, nullptr to read the file
  * @return passed / failed
  */
-bool XmlValidator::Validate(const string& xmlFile, const string& schemaFile)
+bool XmlValidator::Validate(const string& xmlFile, const string& schemaFile, const string* content)
 {
   LogMsg("M084");
 
   try {
+    if (schemaFile != m_grammarFile) {
+      // the grammar is compiled once and reused by the following parses of this parser
+      if (m_domParser->loadGrammar(schemaFile.c_str(), Grammar::SchemaGrammarType, true)) {
+        m_domParser->useCachedGrammarInParse(true);
+        m_grammarFile = schemaFile;
+      }
+    }
     m_domParser->setExternalNoNamespaceSchemaLocation(schemaFile.c_str());
-    m_domParser->parse(xmlFile.c_str());
+    if (content) {
+      MemBufInputSource source(reinterpret_cast<const XMLByte*>(content->data()), content->size(), xmlFile.c_str(), false);
+      m_domParser->parse(source);
+    } else {
+      m_domParser->parse(xmlFile.c_str());
+    }
 
     auto errCnt = m_domParser->getErrorCount();
 
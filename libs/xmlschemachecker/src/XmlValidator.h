@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,6 +10,12 @@
 #include "XmlErrorHandler.h"
 #include "xercesc/parsers/XercesDOMParser.hpp"
 
+#include <string>
+
+/**
+ * @brief validates xml files against a schema, validators can be used concurrently in different threads,
+ *        the schema grammar is loaded once per validator
+*/
 class XmlValidator
 {
 public:
@@ -21,11 +27,12 @@ public:
     XmlValidator& operator=(const XmlValidator&) = delete;
     XmlValidator& operator=(XmlValidator&&) noexcept = delete;
 
-    bool Validate(const std::string& xmlFile, const std::string& schemaFile);
+    bool Validate(const std::string& xmlFile, const std::string& schemaFile, const std::string* content = nullptr);
 
 private:
     xercesc::XercesDOMParser* m_domParser;
     XmlErrorHandler* m_errorHandler;
+    std::string m_grammarFile;
 };
 
 #endif //XMLVALIDATOR_H
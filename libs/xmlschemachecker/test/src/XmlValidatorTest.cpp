@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,8 @@
 
 #include <list>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
@@ -37,3 +39,31 @@ TEST_F(XmlValidatorTests, invalidate_pdsc) {
   // Validate XML file against schema
   EXPECT_FALSE(XmlChecker::Validate(pdscFile, packXsd));
 }
+
+// Test case for files validated one after another with the loaded schema grammar
+TEST_F(XmlValidatorTests, validate_cached_grammar) {
+  string packXsd = string(PACKXSD_FOLDER) + "/PACK.xsd";
+
+  EXPECT_TRUE(XmlChecker::Validate(testDataFolder + "/valid.pdsc", packXsd));
+  EXPECT_FALSE(XmlChecker::Validate(testDataFolder + "/invalid.pdsc", packXsd));
+  EXPECT_TRUE(XmlChecker::Validate(testDataFolder + "/valid.pdsc", packXsd));
+}
+
+// Test case for validators used concurrently in different threads
+TEST_F(XmlValidatorTests, validate_concurrently) {
+  string packXsd = string(PACKXSD_FOLDER) + "/PACK.xsd";
+  vector<char> results(8, 0);
+  vector<thread> threads;
+  for (size_t i = 0; i < results.size(); i++) {
+    threads.emplace_back([&, i]() {
+      string pdscFile = testDataFolder + (i % 2 ? "/invalid.pdsc" : "/valid.pdsc");
+      results[i] = XmlChecker::Validate(pdscFile, packXsd);
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (size_t i = 0; i < results.size(); i++) {
+    EXPECT_EQ(i % 2 == 0, results[i] != 0);
+  }
+}
@@ -0,0 +1,237 @@
+#ifndef XmlAttributes_H
+#define XmlAttributes_H
+/******************************************************************************/
+/*
+  * The classes should be kept semantics-free:
+  * no includes of uVision-specific header files
+  * no special processing based on tag, attribute or value
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief process-wide pool of interned strings used for attribute keys and values.
+ * Each distinct string is stored once and reference counted.
+ * Strings that are no longer referenced are removed in batches, the pool is thread-safe.
+ * The pool is not owned by a model or pack registry: items and their attributes are copied between
+ * models, registries and threads, a per-owner pool would require an owner pointer in every XmlAttributes.
+ * Owners call Purge() when they unload items to return unreferenced strings at once.
+*/
+class XmlStringPool
+{
+public:
+  /**
+   * @brief pooled string
+  */
+  struct Entry
+  {
+    Entry(const std::string& s, size_t shardIndex) : str(s), shard(shardIndex), refs(0) {}
+    const std::string str;
+    const size_t shard;
+    mutable std::atomic<uint32_t> refs;
+  };
+
+  /**
+   * @brief get pooled entry for a string and add a reference to it
+   * @param str string to intern
+   * @return pointer to Entry, never nullptr
+  */
+  static const Entry* Acquire(const std::string& str);
+
+  /**
+   * @brief add a reference to an entry
+   * @param entry pointer to acquired Entry
+  */
+  static void AddRef(const Entry* entry) {
+    entry->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief release a reference to an entry, the entry must not be used afterwards
+   * @param entry pointer to acquired Entry
+  */
+  static void Release(const Entry* entry);
+
+  /**
+   * @brief remove all entries without references
+  */
+  static void Purge();
+
+  /**
+   * @brief get number of strings in the pool
+   * @return number of pooled strings including not yet removed unreferenced ones
+  */
+  static size_t GetCount();
+
+  /**
+   * @brief get number of characters stored in the pool
+   * @return sum of pooled string lengths
+  */
+  static size_t GetLength();
+};
+
+/**
+ * @brief compact collection of attribute key-value pairs with interned keys and values.
+ * Pairs are stored in a vector sorted by key, iteration order is the same as for std::map<std::string, std::string>.
+ * The class provides the subset of the std::map interface used for attributes and converts to and from std::map.
+*/
+class XmlAttributes
+{
+private:
+  /**
+   * @brief pair of interned key and value handles
+  */
+  struct Pair
+  {
+    const XmlStringPool::Entry* key;
+    const XmlStringPool::Entry* value;
+  };
+
+public:
+  /**
+   * @brief key-value pair as returned by iterators
+  */
+  typedef std::pair<const std::string&, const std::string&> value_type;
+
+  /**
+   * @brief read-only iterator
+  */
+  class const_iterator
+  {
+  public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef XmlAttributes::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type reference;
+
+    /**
+     * @brief helper to support it->first and it->second
+    */
+    struct pointer
+    {
+      value_type m_pair;
+      const value_type* operator->() const { return &m_pair; }
+    };
+
+    const_iterator() : m_pos(nullptr) {}
+    value_type operator*() const { return value_type(m_pos->key->str, m_pos->value->str); }
+    pointer operator->() const { return pointer{ **this }; }
+    const_iterator& operator++() { ++m_pos; return *this; }
+    const_iterator operator++(int) { const_iterator it(*this); ++m_pos; return it; }
+    const_iterator& operator--() { --m_pos; return *this; }
+    const_iterator operator--(int) { const_iterator it(*this); --m_pos; return it; }
+    bool operator==(const const_iterator& other) const { return m_pos == other.m_pos; }
+    bool operator!=(const const_iterator& other) const { return m_pos != other.m_pos; }
+
+  private:
+    friend class XmlAttributes;
+    explicit const_iterator(const Pair* pos) : m_pos(pos) {}
+    const Pair* m_pos;
+  };
+  typedef const_iterator iterator;
+
+  /**
+   * @brief default constructor
+  */
+  XmlAttributes() noexcept {}
+
+  /**
+   * @brief construct from std::map
+   * @param attributes map of name to value pairs
+  */
+  XmlAttributes(const std::map<std::string, std::string>& attributes);
+
+  /**
+   * @brief construct from initializer list, e.g. { {"Cclass", "Device"}, {"Cgroup", "Startup"} }
+   * @param attributes list of name to value pairs, later duplicates are ignored
+  */
+  XmlAttributes(std::initializer_list<std::pair<const std::string, std::string> > attributes);
+
+  XmlAttributes(const XmlAttributes& other);
+  XmlAttributes(XmlAttributes&& other) noexcept;
+  XmlAttributes& operator=(const XmlAttributes& other);
+  XmlAttributes& operator=(XmlAttributes&& other) noexcept;
+  ~XmlAttributes();
+
+  /**
+   * @brief convert to std::map
+   * @return map of name to value pairs
+  */
+  explicit operator std::map<std::string, std::string>() const;
+
+  bool empty() const { return m_pairs.empty(); }
+  size_t size() const { return m_pairs.size(); }
+  const_iterator begin() const { return const_iterator(m_pairs.data()); }
+  const_iterator end() const { return const_iterator(m_pairs.data() + m_pairs.size()); }
+
+  /**
+   * @brief find attribute
+   * @param name attribute name
+   * @return iterator to the attribute or end()
+  */
+  const_iterator find(const std::string& name) const;
+
+  /**
+   * @brief count attributes with given name
+   * @param name attribute name
+   * @return 1 if attribute exists, 0 otherwise
+  */
+  size_t count(const std::string& name) const { return find(name) != end() ? 1 : 0; }
+
+  /**
+   * @brief remove all attributes
+  */
+  void clear();
+
+  /**
+   * @brief remove attribute
+   * @param it iterator to the attribute to remove
+   * @return iterator to the following attribute
+  */
+  const_iterator erase(const_iterator it);
+
+  /**
+   * @brief remove attribute
+   * @param name attribute name
+   * @return number of removed attributes: 1 or 0
+  */
+  size_t erase(const std::string& name);
+
+  /**
+   * @brief add or replace attribute
+   * @param name attribute name
+   * @param value attribute value
+   * @return true if attribute is added or its value is changed
+  */
+  bool Set(const std::string& name, const std::string& value);
+
+  /**
+   * @brief release unused capacity
+  */
+  void shrink_to_fit() { m_pairs.shrink_to_fit(); }
+
+  bool operator==(const XmlAttributes& other) const;
+  bool operator!=(const XmlAttributes& other) const { return !(*this == other); }
+
+private:
+  size_t LowerBound(const std::string& name) const;
+
+  std::vector<Pair> m_pairs; // sorted by key
+};
+
+#endif // XmlAttributes_H
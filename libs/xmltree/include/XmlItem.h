@@ -8,12 +8,14 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 /******************************************************************************/
 
+#include "XmlAttributes.h"
+
 #include <string>
 #include <map>
 
@@ -53,7 +55,7 @@ public:
    * @brief parametrized constructor to instantiate with given attributes
    * @param attributes collection as key to value pairs
   */
-  XmlItem(const std::map<std::string, std::string>& attributes) : m_attributes(attributes), m_lineNumber(0) {};
+  XmlItem(const XmlAttributes& attributes) : m_attributes(attributes), m_lineNumber(0) {};
 
   /**
    * @brief virtual destructor
@@ -114,9 +116,9 @@ public:
 
   /**
    * @brief return collection of attributes as a key-value pairs
-   * @return map of name to value pairs
+   * @return XmlAttributes collection of name to value pairs
   */
-  const std::map<std::string, std::string>& GetAttributes() const { return m_attributes; }
+  const XmlAttributes& GetAttributes() const { return m_attributes; }
 
   /**
   * @brief add missing attributes, optionally replace existing
@@ -124,7 +126,7 @@ public:
   * @param replaceExisting true to replace existing attributes
   * @return true if any attribute is set or changed
  */
-  bool AddAttributes(const std::map<std::string, std::string>& attributes, bool replaceExisting);
+  bool AddAttributes(const XmlAttributes& attributes, bool replaceExisting);
 
   /**
    * @brief add a single attribute to the item
@@ -156,7 +158,7 @@ public:
    * @param attributes collection as key to value pairs
    * @return true if any attribute collection has changed
   */
-  bool SetAttributes(const std::map<std::string, std::string>& attributes);
+  bool SetAttributes(const XmlAttributes& attributes);
 
   /**
    * @brief replace instance attributes with the given ones
@@ -419,7 +421,7 @@ public:
  * @param attributes given list of attributes
  * @return true if all given attributes exist in the instance
 */
-  virtual bool EqualAttributes(const std::map<std::string, std::string>& attributes) const;
+  virtual bool EqualAttributes(const XmlAttributes& attributes) const;
   /**
    * @brief check if all attributes of the given instance exist in this instance
    * @param other given instance of XmlItem
@@ -438,7 +440,7 @@ public:
  * @param attributes given list of attributes
  * @return true if given attributes exist in the instance
 */
-  virtual bool CompareAttributes(const std::map<std::string, std::string>& attributes) const;
+  virtual bool CompareAttributes(const XmlAttributes& attributes) const;
   /**
    * @brief check if attributes of the given instance exist in this instance
    * @param other given instance of XmlItem
@@ -494,7 +496,7 @@ protected:
 protected:
   std::string m_tag;  // item tag
   std::string m_text; // item text
-  std::map<std::string, std::string> m_attributes; // attribute key-value pairs
+  XmlAttributes m_attributes; // attribute key-value pairs
 
   int m_lineNumber;  // 1 - based line number in XML file
 
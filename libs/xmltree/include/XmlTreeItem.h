@@ -80,7 +80,7 @@ public:
    * @param parent pointer to parent element
    * @param attributes collection as key to value pairs
   */
-  XmlTreeItem(TITEM* parent, const std::map<std::string, std::string>& attributes) : XmlItem(attributes), m_parent(parent) {}
+  XmlTreeItem(TITEM* parent, const XmlAttributes& attributes) : XmlItem(attributes), m_parent(parent) {}
 
   /**
    * @brief destructor
@@ -506,9 +506,9 @@ public:
    * @brief create new simple child elements (only tag and text) and add them to the children
    * @param elements map of tag to text pairs
   */
-  void CreateSimpleChildElements(const std::map<std::string, std::string>& elements)
+  void CreateSimpleChildElements(const XmlAttributes& elements)
   {
-    for (auto& [tag, text] : elements) {
+    for (const auto& [tag, text] : elements) {
       CreateElement(tag, text);
     }
   }
@@ -36,7 +36,7 @@ void JsonFormatter::FormatXmlElement(ostringstream& outStream, XMLTreeElement* e
   if (outputTag) {
     outStream << indent << "\"" << element->GetTag() << "\": ";
   }
-  const map<string, string> attributes = element->GetAttributes(); // copy of attributes
+  const XmlAttributes attributes = element->GetAttributes(); // copy of attributes
   if (attributes.empty() && !element->HasChildren()) {
     if (!text.empty()) {
       if (!outputTag) {
@@ -0,0 +1,268 @@
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "XmlAttributes.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief part of the pool with own lock to reduce contention while packs are parsed concurrently
+*/
+struct PoolShard
+{
+  mutex lock;
+  unordered_map<string_view, unique_ptr<XmlStringPool::Entry> > entries; // keys refer to Entry::str
+  atomic<size_t> unused = 0; // approximate number of entries without references
+};
+
+constexpr size_t SHARD_COUNT = 64;
+constexpr size_t PURGE_THRESHOLD = 256;
+
+PoolShard* GetShards()
+{
+  // allocated once and never destroyed: static XmlItem objects can release strings at exit
+  static PoolShard* shards = new PoolShard[SHARD_COUNT];
+  return shards;
+}
+
+void PurgeShard(PoolShard& shard)
+{
+  // caller must hold shard lock
+  for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+    if (it->second->refs.load(memory_order_acquire) == 0) {
+      it = shard.entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  shard.unused = 0;
+}
+
+} // namespace
+
+const XmlStringPool::Entry* XmlStringPool::Acquire(const string& str)
+{
+  const size_t shardIndex = hash<string_view>()(str) % SHARD_COUNT;
+  PoolShard& shard = GetShards()[shardIndex];
+  lock_guard<mutex> guard(shard.lock);
+  auto it = shard.entries.find(str);
+  if (it != shard.entries.end()) {
+    it->second->refs.fetch_add(1, memory_order_relaxed);
+    return it->second.get();
+  }
+  unique_ptr<Entry> entry = make_unique<Entry>(str, shardIndex);
+  entry->refs = 1;
+  const Entry* e = entry.get();
+  shard.entries.emplace(string_view(e->str), std::move(entry));
+  return e;
+}
+
+void XmlStringPool::Release(const Entry* entry)
+{
+  PoolShard& shard = GetShards()[entry->shard]; // entry can be removed by another thread after the decrement
+  if (entry->refs.fetch_sub(1, memory_order_acq_rel) != 1) {
+    return;
+  }
+  if (shard.unused.fetch_add(1, memory_order_relaxed) + 1 >= PURGE_THRESHOLD) {
+    lock_guard<mutex> guard(shard.lock);
+    PurgeShard(shard);
+  }
+}
+
+void XmlStringPool::Purge()
+{
+  PoolShard* shards = GetShards();
+  for (size_t i = 0; i < SHARD_COUNT; i++) {
+    lock_guard<mutex> guard(shards[i].lock);
+    PurgeShard(shards[i]);
+  }
+}
+
+size_t XmlStringPool::GetCount()
+{
+  size_t count = 0;
+  PoolShard* shards = GetShards();
+  for (size_t i = 0; i < SHARD_COUNT; i++) {
+    lock_guard<mutex> guard(shards[i].lock);
+    count += shards[i].entries.size();
+  }
+  return count;
+}
+
+size_t XmlStringPool::GetLength()
+{
+  size_t length = 0;
+  PoolShard* shards = GetShards();
+  for (size_t i = 0; i < SHARD_COUNT; i++) {
+    lock_guard<mutex> guard(shards[i].lock);
+    for (auto& [str, _] : shards[i].entries) {
+      length += str.length();
+    }
+  }
+  return length;
+}
+
+
+XmlAttributes::XmlAttributes(const map<string, string>& attributes)
+{
+  m_pairs.reserve(attributes.size());
+  for (auto& [key, value] : attributes) {
+    m_pairs.push_back({ XmlStringPool::Acquire(key), XmlStringPool::Acquire(value) });
+  }
+}
+
+XmlAttributes::XmlAttributes(initializer_list<pair<const string, string> > attributes)
+{
+  m_pairs.reserve(attributes.size());
+  for (auto& [key, value] : attributes) {
+    if (find(key) == end()) {
+      Set(key, value);
+    }
+  }
+}
+
+XmlAttributes::XmlAttributes(const XmlAttributes& other) :
+  m_pairs(other.m_pairs)
+{
+  for (auto& p : m_pairs) {
+    XmlStringPool::AddRef(p.key);
+    XmlStringPool::AddRef(p.value);
+  }
+}
+
+XmlAttributes::XmlAttributes(XmlAttributes&& other) noexcept :
+  m_pairs(std::move(other.m_pairs))
+{
+  other.m_pairs.clear();
+}
+
+XmlAttributes& XmlAttributes::operator=(const XmlAttributes& other)
+{
+  if (this != &other) {
+    XmlAttributes copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+XmlAttributes& XmlAttributes::operator=(XmlAttributes&& other) noexcept
+{
+  if (this != &other) {
+    clear();
+    m_pairs.swap(other.m_pairs);
+  }
+  return *this;
+}
+
+XmlAttributes::~XmlAttributes()
+{
+  clear();
+}
+
+XmlAttributes::operator map<string, string>() const
+{
+  map<string, string> attributes;
+  for (auto& p : m_pairs) {
+    attributes.emplace_hint(attributes.end(), p.key->str, p.value->str);
+  }
+  return attributes;
+}
+
+size_t XmlAttributes::LowerBound(const string& name) const
+{
+  size_t first = 0;
+  size_t count = m_pairs.size();
+  while (count > 0) {
+    const size_t step = count / 2;
+    if (m_pairs[first + step].key->str.compare(name) < 0) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+XmlAttributes::const_iterator XmlAttributes::find(const string& name) const
+{
+  const size_t pos = LowerBound(name);
+  if (pos < m_pairs.size() && m_pairs[pos].key->str == name) {
+    return const_iterator(m_pairs.data() + pos);
+  }
+  return end();
+}
+
+void XmlAttributes::clear()
+{
+  for (auto& p : m_pairs) {
+    XmlStringPool::Release(p.key);
+    XmlStringPool::Release(p.value);
+  }
+  m_pairs.clear();
+}
+
+XmlAttributes::const_iterator XmlAttributes::erase(const_iterator it)
+{
+  const size_t pos = it.m_pos - m_pairs.data();
+  XmlStringPool::Release(m_pairs[pos].key);
+  XmlStringPool::Release(m_pairs[pos].value);
+  m_pairs.erase(m_pairs.begin() + pos);
+  return const_iterator(m_pairs.data() + pos);
+}
+
+size_t XmlAttributes::erase(const string& name)
+{
+  auto it = find(name);
+  if (it == end()) {
+    return 0;
+  }
+  erase(it);
+  return 1;
+}
+
+bool XmlAttributes::Set(const string& name, const string& value)
+{
+  const size_t pos = LowerBound(name);
+  if (pos < m_pairs.size() && m_pairs[pos].key->str == name) {
+    Pair& p = m_pairs[pos];
+    if (p.value->str == value) {
+      return false;
+    }
+    const XmlStringPool::Entry* prev = p.value;
+    p.value = XmlStringPool::Acquire(value);
+    XmlStringPool::Release(prev);
+    return true;
+  }
+  m_pairs.insert(m_pairs.begin() + pos, { XmlStringPool::Acquire(name), XmlStringPool::Acquire(value) });
+  return true;
+}
+
+bool XmlAttributes::operator==(const XmlAttributes& other) const
+{
+  if (m_pairs.size() != other.m_pairs.size()) {
+    return false;
+  }
+  // interned strings are equal if their entries are the same
+  for (size_t i = 0; i < m_pairs.size(); i++) {
+    if (m_pairs[i].key != other.m_pairs[i].key || m_pairs[i].value != other.m_pairs[i].value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// End of XmlAttributes.cpp
@@ -59,7 +59,7 @@ void XmlFormatter::FormatXmlElement(ostringstream& xmlStream, XMLTreeElement* el
   const string& tag = element->GetTag();
   const string& text = element->GetText();
   xmlStream << indent + '<' << tag;
-  map<string, string> attributes = element->GetAttributes();
+  const auto& attributes = element->GetAttributes();
   for (auto attribute : attributes) {
     xmlStream << ' ';
     xmlStream << attribute.first << "=\"" << EscapeSpecialChars(attribute.second) << "\"";
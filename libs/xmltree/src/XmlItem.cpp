@@ -1,6 +1,6 @@
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -27,7 +27,7 @@ void XmlItem::ClearAttributes()
   }
 }
 
-bool XmlItem::AddAttributes(const map<string, string>& attributes, bool replaceExisting)
+bool XmlItem::AddAttributes(const XmlAttributes& attributes, bool replaceExisting)
 {
   if (attributes.empty())
     return false;
@@ -53,7 +53,7 @@ bool XmlItem::AddAttribute(const string& name, const string& value, bool insertE
 {
   if (name.empty())
     return false;
-  map<string, string>::iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end()) {
     if (it->second == value)
       return false;
@@ -63,7 +63,7 @@ bool XmlItem::AddAttribute(const string& name, const string& value, bool insertE
     }
   }
   if (insertEmpty || !value.empty())
-    m_attributes[name] = value;
+    m_attributes.Set(name, value);
   return true;
 }
 
@@ -71,14 +71,16 @@ bool XmlItem::SetAttribute(const char* name, const char* value)
 {
   if (!name)
     return false;
-  map<string, string>::iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end()) {
     if (value && it->second == value)
       return false;
-    m_attributes.erase(it);
+    if (!value) {
+      m_attributes.erase(it);
+    }
   }
   if (value) {
-    m_attributes[name] = value;
+    m_attributes.Set(name, value);
   }
   return true;
 }
@@ -88,7 +90,7 @@ bool XmlItem::SetAttribute(const char* name, long value, int radix)
   return SetAttribute(name, RteUtils::LongToString(value, radix).c_str());
 }
 
-bool XmlItem::SetAttributes(const map<string, string>& attributes)
+bool XmlItem::SetAttributes(const XmlAttributes& attributes)
 {
   if (m_attributes == attributes)
     return false;
@@ -106,12 +108,7 @@ bool XmlItem::SetAttributes(const XmlItem& attributes)
 
 bool XmlItem::RemoveAttribute(const std::string& name)
 {
-  map<string, string>::iterator it = m_attributes.find(name);
-  if (it != m_attributes.end()) {
-    m_attributes.erase(it);
-    return true;
-  }
-  return false;
+  return m_attributes.erase(name) > 0;
 }
 
 bool XmlItem::RemoveAttribute(const char* name)
@@ -148,7 +145,7 @@ const string& XmlItem::GetAttribute(const char* name) const
 
 const string& XmlItem::GetAttribute(const string& name) const
 {
-  map<string, string>::const_iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end())
     return it->second;
   return EMPTY_STRING;
@@ -282,7 +279,6 @@ int XmlItem::GetItemValueAsInt(const std::string& keyOrTag, int defaultValue) co
 string XmlItem::GetAttributesString(bool quote) const
 {
   string s;
-  map<string, string>::const_iterator it;
   for (auto [a, v] : m_attributes) {
     if (!s.empty())
       s += " ";
@@ -304,7 +300,7 @@ string XmlItem::GetAttributesAsXmlString() const
   return GetAttributesString(true);
 }
 
-bool XmlItem::EqualAttributes(const map<string, string>& attributes) const
+bool XmlItem::EqualAttributes(const XmlAttributes& attributes) const
 {
   // all supplied attributes must exist in this ones
   for (auto [a, v] : attributes) {
@@ -335,7 +331,7 @@ bool XmlItem::EqualAttributes(const XmlItem* other) const
 }
 
 
-bool XmlItem::CompareAttributes(const map<string, string>& attributes) const
+bool XmlItem::CompareAttributes(const XmlAttributes& attributes) const
 {
   // all supplied attributes must exist in this ones
   for (auto [a, v] : attributes) {
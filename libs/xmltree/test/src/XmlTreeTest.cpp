@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 #include "gtest/gtest.h"
 
 #include "XMLTree.h"
+#include "XmlAttributes.h"
 #include "RteUtils.h"
 
 TEST(XmlTreeTest, GetAttribute) {
@@ -86,4 +87,65 @@ TEST(XmlTreeTest, GetAttribute) {
   EXPECT_EQ(e1->GetRootFileName(), "e1/foo.bar");
   EXPECT_EQ(e2->GetRootFileName(), "e1/foo.bar");
 }
+TEST(XmlTreeTest, Attributes) {
+
+  XmlAttributes attributes = { {"b", "2"}, {"a", "1"}, {"c", "3"}, {"a", "ignored"} };
+  EXPECT_EQ(attributes.size(), 3);
+  std::string keys;
+  for (const auto& [key, value] : attributes) {
+    keys += key + "=" + value + " ";
+  }
+  EXPECT_EQ(keys, "a=1 b=2 c=3 ");
+
+  EXPECT_TRUE(attributes.find("d") == attributes.end());
+  auto it = attributes.find("b");
+  ASSERT_TRUE(it != attributes.end());
+  EXPECT_EQ(it->second, "2");
+  EXPECT_EQ(attributes.count("c"), 1);
+
+  EXPECT_TRUE(attributes.Set("d", "4"));
+  EXPECT_TRUE(attributes.Set("b", "22"));
+  EXPECT_FALSE(attributes.Set("b", "22"));
+  EXPECT_EQ(attributes.find("b")->second, "22");
+  EXPECT_EQ(attributes.erase("a"), 1);
+  EXPECT_EQ(attributes.erase("a"), 0);
+  it = attributes.erase(attributes.find("c"));
+  EXPECT_EQ(it->first, "d");
+
+  std::map<std::string, std::string> m(attributes);
+  std::map<std::string, std::string> expected = { {"b", "22"}, {"d", "4"} };
+  EXPECT_EQ(m, expected);
+
+  XmlAttributes copy(m);
+  EXPECT_TRUE(copy == attributes);
+  copy.Set("b", "2");
+  EXPECT_TRUE(copy != attributes);
+  XmlAttributes moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.find("b")->second, "2");
+  moved = attributes;
+  EXPECT_TRUE(moved == attributes);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_TRUE(moved.begin() == moved.end());
+}
+
+TEST(XmlTreeTest, StringPool) {
+
+  const std::string value = "XmlTreeTest_StringPool_unique_value";
+  XmlStringPool::Purge();
+  const size_t count = XmlStringPool::GetCount();
+  {
+    XMLTreeElement e1, e2;
+    e1.AddAttribute("XmlTreeTest_StringPool_key", value);
+    e2.AddAttribute("XmlTreeTest_StringPool_key", value);
+    // equal strings are stored once
+    EXPECT_EQ(&e1.GetAttribute("XmlTreeTest_StringPool_key"), &e2.GetAttribute("XmlTreeTest_StringPool_key"));
+    EXPECT_EQ(XmlStringPool::GetCount(), count + 2);
+    e1.SetAttribute("XmlTreeTest_StringPool_key", "other");
+    EXPECT_EQ(e2.GetAttribute("XmlTreeTest_StringPool_key"), value);
+  }
+  XmlStringPool::Purge();
+  EXPECT_EQ(XmlStringPool::GetCount(), count);
+}
 // end of XmlTreeTest.cpp
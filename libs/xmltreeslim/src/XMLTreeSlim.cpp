@@ -9,7 +9,7 @@
 #include "XMLTreeSlim.h"
 #include "XmlTreeSlimInterface.h"
 
-#include "XML_InputSourceReaderFile.h"
+#include "XML_InputSourceReaderMapped.h"
 #include "ErrLog.h"
 
 XMLTreeSlim::XMLTreeSlim(IXmlItemBuilder* itemBuilder, bool bRedirectErrLog, bool bIgnoreAttributePrefixes) :
@@ -24,7 +24,7 @@ XMLTreeSlim::XMLTreeSlim(IXmlItemBuilder* itemBuilder, bool bRedirectErrLog, boo
 XMLTreeParserInterface* XMLTreeSlim::CreateParserInterface()
 {
   return new XMLTreeSlimInterface(this, m_bRedirectErrLog, m_bIgnoreAttributePrefixes,
-    new XML_InputSourceReaderFile());
+    new XML_InputSourceReaderMapped());
 }
 
 // End of XMLTreeSlim.cpp
@@ -108,6 +108,7 @@ bool XMLTreeSlimInterface::Parse(const std::string& fileName, const std::string&
   m_errorStrings.clear();
   m_nErrors = 0;
   m_nWarnings = 0;
+  recursion = 0; // state of a previous, failed parse must not affect this one
 
   ErrLog::Get()->SetFileName(fileName);
   IErrConsumer* prevConsumer = ErrLog::Get()->GetErrConsumer();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,8 @@
 
 #include "ISchemaChecker.h"
 
+#include "yaml-cpp/yaml.h"
+
 class YmlSchemaChecker : public ISchemaChecker{
 public:
 
@@ -19,6 +21,29 @@ public:
    * @return true if validation pass, otherwise false
   */
   bool ValidateFile(const std::string& file, const std::string& schemaFile) override;
+
+  /**
+   * @brief Validates the YAML data file with respect to schema given and provides the loaded data
+   * @param file input YAML file to be validated
+   * @param schemaFile input schema file defines the structure of YAML
+   * @param data YAML data loaded from file, can be used further without reading the file again, not set for json files
+   * @return true if validation pass, otherwise false
+  */
+  bool ValidateFile(const std::string& file, const std::string& schemaFile, YAML::Node& data);
+
+  /**
+   * @brief Validates already loaded YAML data with respect to schema given, the file is not read again
+   * @param data YAML data loaded from file
+   * @param file input YAML file the data is loaded from, used for error reporting
+   * @param schemaFile input schema file defines the structure of YAML
+   * @return true if validation pass, otherwise false
+  */
+  bool ValidateData(const YAML::Node& data, const std::string& file, const std::string& schemaFile);
+
+  /**
+   * @brief Clears compiled schemas, they are cached for the process lifetime
+  */
+  static void ClearSchemaCache();
 };
 
 #endif // YML_SCHEMACHECKER_H
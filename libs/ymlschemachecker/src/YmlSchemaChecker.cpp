@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -8,9 +8,25 @@
 #include "YmlSchemaValidator.h"
 
 bool YmlSchemaChecker::ValidateFile(const std::string& file, const std::string& schemaFile)
+{
+  YAML::Node data;
+  return ValidateFile(file, schemaFile, data);
+}
+
+bool YmlSchemaChecker::ValidateFile(const std::string& file, const std::string& schemaFile, YAML::Node& data)
 {
   YmlSchemaValidator validator(file, schemaFile);
-  return validator.Validate(m_errors);
+  return validator.Validate(m_errors, data);
 }
-// end of YmlSchemaChecker.cpp
 
+bool YmlSchemaChecker::ValidateData(const YAML::Node& data, const std::string& file, const std::string& schemaFile)
+{
+  YmlSchemaValidator validator(file, schemaFile);
+  return validator.Validate(data, m_errors);
+}
+
+void YmlSchemaChecker::ClearSchemaCache()
+{
+  YmlSchemaValidator::ClearSchemaCache();
+}
+// end of YmlSchemaChecker.cpp
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -13,10 +13,10 @@
 
 using namespace std;
 
-YmlSchemaErrorHandler::YmlSchemaErrorHandler(const std::string& filePath) :
-  m_yamlFile(filePath)
+YmlSchemaErrorHandler::YmlSchemaErrorHandler(const std::string& filePath, const YAML::Node& yamlData) :
+  m_yamlFile(filePath),
+  m_yamlData(yamlData)
 {
-  m_yamlData = YAML::LoadFile(m_yamlFile);
   m_errList.clear();
 }
 
@@ -34,18 +34,29 @@ void YmlSchemaErrorHandler::error(const nlohmann::json::json_pointer& ptr,
     schemaNodesStr = schemaNodesStr.substr(1, schemaNodesStr.size());
     RteUtils::SplitString(segments, schemaNodesStr, '/');
   }
+  // navigate with const access only: the data is shared with the caller and must not be modified
   std::vector<YAML::Node> nodes;
   nodes.push_back(m_yamlData);
   for (auto& segment : segments) {
-    nodes.push_back(nodes.back()[segment]);
+    const YAML::Node& node = nodes.back();
+    const YAML::Node child = node.IsSequence() ? node[RteUtils::StringToULL(segment)] :
+      node.IsMap() ? node[segment] : YAML::Node(YAML::NodeType::Undefined);
+    if (!child.IsDefined()) {
+      // location is unknown
+      m_errList.push_back(RteError(m_yamlFile, message, 0, 0));
+      return;
+    }
+    nodes.push_back(child);
   }
   auto mark = nodes.back().Mark();
   if (nodes.size() > 1) {
     auto parent = *prev(prev(nodes.end()));
-    for (const auto& item : parent) {
-      if (!item.first.Mark().is_null() && item.first.as<string>() == segments.back()) {
-        mark = item.first.Mark();
-        break;
+    if (parent.IsMap()) {
+      for (const auto& item : parent) {
+        if (!item.first.Mark().is_null() && item.first.as<string>() == segments.back()) {
+          mark = item.first.Mark();
+          break;
+        }
       }
     }
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -18,7 +18,7 @@ using nlohmann::json;
 class YmlSchemaErrorHandler : public nlohmann::json_schema::basic_error_handler
 {
 public:
-  YmlSchemaErrorHandler(const std::string& filePath);
+  YmlSchemaErrorHandler(const std::string& filePath, const YAML::Node& yamlData);
   ~YmlSchemaErrorHandler();
 
   /**
@@ -38,7 +38,7 @@ public:
 
 private:
   std::string  m_yamlFile;
-  YAML::Node m_yamlData;
+  const YAML::Node m_yamlData;
   std::list<RteError> m_errList;
 
   /**
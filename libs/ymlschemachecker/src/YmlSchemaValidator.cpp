@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -8,11 +8,30 @@
 #include "YmlSchemaErrorHandler.h"
 #include "RteUtils.h"
 
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 using nlohmann::json_schema::json_validator;
 
+namespace {
+
+/**
+ * @brief compiled schema cached for the process lifetime
+*/
+struct CachedSchema
+{
+  std::filesystem::file_time_type writeTime;
+  std::shared_ptr<const json_validator> validator;
+};
+
+std::mutex schemaCacheMutex;
+std::map<std::string, CachedSchema> schemaCache; // key: schema file path
+
+} // namespace
+
 YmlSchemaValidator::YmlSchemaValidator(
   const std::string& dataFilePath,
   const std::string& schemaFilePath):
@@ -24,7 +43,7 @@ YmlSchemaValidator::YmlSchemaValidator(
 YmlSchemaValidator::~YmlSchemaValidator()
 {}
 
-json YmlSchemaValidator::ReadData() {
+json YmlSchemaValidator::ReadData(YAML::Node& yamlData) {
   json data;
 
   std::string extn = RteUtils::ExtractFileExtension(m_dataFile, false);
@@ -44,15 +63,14 @@ json YmlSchemaValidator::ReadData() {
     file.close();
   }
   else if (extn == "yml" || extn == "yaml") {
-    YAML::Node yamldata;
     try {
-      yamldata = YAML::LoadFile(m_dataFile);
+      yamlData = YAML::LoadFile(m_dataFile);
     }
     catch (YAML::Exception& e) {
       throw RteError(m_dataFile, "schema check failed, verify syntax", e.mark.line + 1, e.mark.column + 1);
     }
 
-    data = YamlToJson(yamldata);
+    data = YamlToJson(yamlData);
   }
 
   return data;
@@ -153,56 +171,100 @@ nlohmann::json YmlSchemaValidator::ParseScalar(const YAML::Node& node) {
   return nullptr;
 }
 
-bool YmlSchemaValidator::Validate(std::list<RteError>& errList) {
-  json data, schema;
+bool YmlSchemaValidator::Validate(std::list<RteError>& errList, YAML::Node& yamlData) {
+  json data;
 
-  // 1) Read the data and schema for the document you want to validate
+  // 1) Read the data for the document you want to validate
   try {
-    data = ReadData();
-    schema = ReadSchema();
+    data = ReadData(yamlData);
   }
   catch (const RteError& err) {
     errList.push_back(err);
     return false;
   }
-  // 2) create the validator
-  nlohmann::json_schema::schema_loader loader =
-    std::bind(&YmlSchemaValidator::Loader, this, std::placeholders::_1, std::placeholders::_2);
-  json_validator validator(loader, nlohmann::json_schema::default_string_format_check);
+  return Validate(data, yamlData, errList);
+}
 
-  try {
-    // insert this schema as the root to the validator
-    // this resolves remote-schemas, sub-schemas and references via the given loader-function
-    validator.set_root_schema(schema);
-  }
-  catch (const std::exception& e) {
-    errList.push_back(RteError(m_schemaFile, e.what(), 0, 0));
+bool YmlSchemaValidator::Validate(const YAML::Node& yamlData, std::list<RteError>& errList) {
+  return Validate(YamlToJson(yamlData), yamlData, errList);
+}
+
+bool YmlSchemaValidator::Validate(const json& data, const YAML::Node& yamlData, std::list<RteError>& errList) {
+  // 2) get the compiled schema
+  auto validator = GetValidator(errList);
+  if (!validator) {
     return false;
   }
 
   // 3) do the actual validation of the data
-  YmlSchemaErrorHandler handler(m_dataFile);
-  validator.validate(data, handler);
+  YmlSchemaErrorHandler handler(m_dataFile, yamlData);
+  validator->validate(data, handler);
 
   errList = handler.GetAllErrors();
   return (errList.size() == 0) ? true : false;
 }
 
-void YmlSchemaValidator::Loader(const json_uri& uri, json& schema)
-{
-  std::string filename = RteUtils::ExtractFilePath(m_schemaFile, true) + uri.path();
-  std::ifstream lf(filename);
-  if (!lf.good()) {
-    throw RteError(filename, "could not open " + uri.url(), 0, 0);
+std::shared_ptr<const json_validator> YmlSchemaValidator::GetValidator(std::list<RteError>& errList) {
+  // schema is compiled once and reused as long as the schema file is not modified
+  std::error_code ec;
+  const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(m_schemaFile, ec);
+  {
+    std::lock_guard<std::mutex> lock(schemaCacheMutex);
+    auto it = schemaCache.find(m_schemaFile);
+    if (!ec && it != schemaCache.end() && it->second.writeTime == writeTime) {
+      return it->second.validator;
+    }
   }
 
+  json schema;
   try {
-    lf >> schema;
+    schema = ReadSchema();
   }
-  catch (const std::exception& e) {
+  catch (const RteError& err) {
+    errList.push_back(err);
+    return nullptr;
+  }
+
+  // referenced schemas are loaded relative to the schema file
+  const std::string schemaDir = RteUtils::ExtractFilePath(m_schemaFile, true);
+  nlohmann::json_schema::schema_loader loader = [schemaDir](const json_uri& uri, json& refSchema) {
+    std::string filename = schemaDir + uri.path();
+    std::ifstream lf(filename);
+    if (!lf.good()) {
+      throw RteError(filename, "could not open " + uri.url(), 0, 0);
+    }
+
+    try {
+      lf >> refSchema;
+    }
+    catch (const std::exception& e) {
+      lf.close();
+      throw RteError(filename, e.what(), 0, 0);
+    }
     lf.close();
-    throw RteError(filename, e.what(), 0, 0);
+  };
+  auto validator = std::make_shared<json_validator>(loader, nlohmann::json_schema::default_string_format_check);
+
+  try {
+    // insert this schema as the root to the validator
+    // this resolves remote-schemas, sub-schemas and references via the given loader-function
+    validator->set_root_schema(schema);
+  }
+  catch (const std::exception& e) {
+    errList.push_back(RteError(m_schemaFile, e.what(), 0, 0));
+    return nullptr;
   }
-  lf.close();
+
+  if (!ec) {
+    std::lock_guard<std::mutex> lock(schemaCacheMutex);
+    schemaCache[m_schemaFile] = { writeTime, validator };
+  }
+  return validator;
+}
+
+void YmlSchemaValidator::ClearSchemaCache()
+{
+  std::lock_guard<std::mutex> lock(schemaCacheMutex);
+  schemaCache.clear();
 }
 // end of YmlSchemaValidator.cpp
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -12,6 +12,7 @@
 #include "yaml-cpp/yaml.h"
 #include <nlohmann/json-schema.hpp>
 
+#include <memory>
 #include <string>
 
 using nlohmann::json;
@@ -26,15 +27,30 @@ public:
   /**
    * @brief Validate yaml data with json schema provided
    * @param errList list of errors found
+   * @param yamlData yaml data loaded from the data file
    * @return true if the validation pass, otherwise false
   */
-  bool Validate(std::list<RteError>& errList);
+  bool Validate(std::list<RteError>& errList, YAML::Node& yamlData);
+
+  /**
+   * @brief Validate yaml data already loaded from the data file with json schema provided
+   * @param yamlData yaml data loaded from the data file
+   * @param errList list of errors found
+   * @return true if the validation pass, otherwise false
+  */
+  bool Validate(const YAML::Node& yamlData, std::list<RteError>& errList);
+
+  /**
+   * @brief clear compiled schemas cached for the process lifetime
+  */
+  static void ClearSchemaCache();
 
 private:
-  json ReadData();
+  json ReadData(YAML::Node& yamlData);
   json ReadSchema();
 
-  void Loader(const json_uri& uri, json& schema);
+  bool Validate(const json& data, const YAML::Node& yamlData, std::list<RteError>& errList);
+  std::shared_ptr<const nlohmann::json_schema::json_validator> GetValidator(std::list<RteError>& errList);
 
   nlohmann::json YamlToJson(const YAML::Node& root);
   nlohmann::json ParseScalar(const YAML::Node& node);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -197,4 +197,47 @@ TEST_F(YmlSchemaChkTests, Schema_Invalid) {
     EXPECT_TRUE(errList.end() != errItr);
   }
 }
+TEST_F(YmlSchemaChkTests, Validate_Loaded_Data) {
+  string datafile = testinput_folder + "/sample-data/clayer.yaml";
+  string schemafile = testinput_folder + "/clayer.schema.json";
+
+  // file is loaded once and provided to the caller
+  YmlSchemaChecker ymlSchemaChecker;
+  YAML::Node data;
+  EXPECT_FALSE(ymlSchemaChecker.ValidateFile(datafile, schemafile, data));
+  EXPECT_TRUE(data.IsMap());
+  const auto errList = ymlSchemaChecker.GetErrors();
+  ASSERT_EQ(errList.size(), 4);
+
+  // validation of loaded data uses cached schema and reports the same errors
+  ymlSchemaChecker.ClearErrors();
+  EXPECT_FALSE(ymlSchemaChecker.ValidateData(data, datafile, schemafile));
+  auto& dataErrList = ymlSchemaChecker.GetErrors();
+  ASSERT_EQ(dataErrList.size(), errList.size());
+  auto errItr = errList.begin();
+  for (auto& err : dataErrList) {
+    EXPECT_EQ(err.m_file, errItr->m_file);
+    EXPECT_EQ(err.m_line, errItr->m_line);
+    EXPECT_EQ(err.m_col, errItr->m_col);
+    errItr++;
+  }
+
+  // same result after the schema is compiled again
+  YmlSchemaChecker::ClearSchemaCache();
+  ymlSchemaChecker.ClearErrors();
+  EXPECT_FALSE(ymlSchemaChecker.ValidateData(data, datafile, schemafile));
+  EXPECT_EQ(ymlSchemaChecker.GetErrors().size(), errList.size());
+}
+
+TEST_F(YmlSchemaChkTests, Validate_Json_Data) {
+  string datafile = testinput_folder + "/sample-data/cproject.json";
+  string schemafile = testinput_folder + "/cproject.schema.json";
+
+  // json data is read by the json parser only, no yaml data is returned
+  YmlSchemaChecker ymlSchemaChecker;
+  YAML::Node data;
+  EXPECT_TRUE(ymlSchemaChecker.ValidateFile(datafile, schemafile, data));
+  EXPECT_EQ(ymlSchemaChecker.GetErrors().size(), 0);
+  EXPECT_TRUE(data.IsNull());
+}
 // end of YmlSchemaChkTests.cpp
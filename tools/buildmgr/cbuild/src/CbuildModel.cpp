@@ -196,22 +196,21 @@ bool CbuildModel::GenerateFixedCprj(const string& update) {
   if (!elements) {
     return false;
   }
-  map<string, string> createdAttributes = elements->created->GetAttributes();
-  createdAttributes["timestamp"] = cprj.GetTimestamp();
-  createdAttributes["tool"] = cprj.GetTool();
+  XmlAttributes createdAttributes = elements->created->GetAttributes();
+  createdAttributes.Set("timestamp", cprj.GetTimestamp());
+  createdAttributes.Set("tool", cprj.GetTool());
   elements->created->SetAttributes(createdAttributes);
 
   // Compare pack attributes
   for (auto cprjPack : elements->packages->GetChildren()) {
-    map<string, string> cprjPackAttributes = cprjPack->GetAttributes();
     for (auto pack : packs) {
-      map<string, string> packAttributes = pack.second->GetAttributes();
-      if ((cprjPackAttributes["name"] == packAttributes["name"]) &&
-          (cprjPackAttributes["vendor"] == packAttributes["vendor"]) &&
-          (VersionCmp::RangeCompare(packAttributes["version"], cprjPack->GetAttribute("version")) == 0)) {
+      if ((cprjPack->GetAttribute("name") == pack.second->GetAttribute("name")) &&
+          (cprjPack->GetAttribute("vendor") == pack.second->GetAttribute("vendor")) &&
+          (VersionCmp::RangeCompare(pack.second->GetAttribute("version"), cprjPack->GetAttribute("version")) == 0)) {
         // Set fixed CPRJ pack version
         const string& version = pack.second->GetVersionString();
-        cprjPackAttributes["version"] = version + ':' + version;
+        XmlAttributes cprjPackAttributes = cprjPack->GetAttributes();
+        cprjPackAttributes.Set("version", version + ':' + version);
         cprjPack->SetAttributes(cprjPackAttributes);
       }
     }
@@ -231,42 +230,40 @@ bool CbuildModel::GenerateFixedCprj(const string& update) {
       if ((m_cprjTarget->IsComponentUsed(component)) && (!component->IsGenerated())) {
 
         // Iterate over CPRJ components
-        map<string, string> componentAttributes = component->GetAttributes();
         for (auto cprjComponent : cprjComponents) {
 
           // Compare component attributes: Cclass and Cgroup are required, Csub and Cvendor are optional fields
-          map<string, string> cprjComponentAttributes = cprjComponent->GetAttributes();
-          const bool csub = cprjComponentAttributes.find("Csub") != cprjComponentAttributes.end();
-          const bool cvendor = cprjComponentAttributes.find("Cvendor") != cprjComponentAttributes.end();
-          if ((componentAttributes["Cclass" ] == cprjComponentAttributes["Cclass" ]) &&
-              (componentAttributes["Cgroup" ] == cprjComponentAttributes["Cgroup" ]) &&
-              (!csub    || (componentAttributes["Csub"   ] == cprjComponentAttributes["Csub"   ])) &&
-              (!cvendor || (componentAttributes["Cvendor"] == cprjComponentAttributes["Cvendor"]))) {
+          const bool csub = cprjComponent->HasAttribute("Csub");
+          const bool cvendor = cprjComponent->HasAttribute("Cvendor");
+          if ((component->GetAttribute("Cclass" ) == cprjComponent->GetAttribute("Cclass" )) &&
+              (component->GetAttribute("Cgroup" ) == cprjComponent->GetAttribute("Cgroup" )) &&
+              (!csub    || (component->GetAttribute("Csub"   ) == cprjComponent->GetAttribute("Csub"   ))) &&
+              (!cvendor || (component->GetAttribute("Cvendor") == cprjComponent->GetAttribute("Cvendor")))) {
 
             // Set fixed CPRJ Component Version
-            cprjComponentAttributes["Cversion"] = componentAttributes["Cversion"];
+            XmlAttributes cprjComponentAttributes = cprjComponent->GetAttributes();
+            cprjComponentAttributes.Set("Cversion", component->GetAttribute("Cversion"));
             cprjComponent->SetAttributes(cprjComponentAttributes);
 
             for (auto configFile : configFiles) {
               if (configFile.second->GetComponent(m_targetName)->Compare(component)) {
-                map<string, string> fileAttributes = configFile.second->GetFile(m_targetName)->GetAttributes();
-                fileAttributes["name"] = RteUtils::BackSlashesToSlashes(fileAttributes["name"]);
+                RteItem* rteFile = configFile.second->GetFile(m_targetName);
+                const string fileName = RteUtils::BackSlashesToSlashes(rteFile->GetAttribute("name"));
 
                 // Iterate over component files
                 bool found = false;
                 for (auto file : cprjComponent->GetChildren()) {
-                  map<string, string> cprjFileAttributes = file->GetAttributes();
-                  if (fileAttributes["name"] == cprjFileAttributes["name"]) {
+                  if (fileName == file->GetAttribute("name")) {
                     found = true;
                   }
                 }
                 if (!found) {
                   // Create missing CPRJ config file entry
                   map<string, string> cprjFileAttributes;
-                  cprjFileAttributes["category"] = fileAttributes["category"];
-                  cprjFileAttributes["attr"] = fileAttributes["attr"];
-                  cprjFileAttributes["name"] = fileAttributes["name"];
-                  cprjFileAttributes["version"] = fileAttributes["version"];
+                  cprjFileAttributes["category"] = rteFile->GetAttribute("category");
+                  cprjFileAttributes["attr"] = rteFile->GetAttribute("attr");
+                  cprjFileAttributes["name"] = fileName;
+                  cprjFileAttributes["version"] = rteFile->GetAttribute("version");
                   XMLTreeElement* fileElement = cprjComponent->CreateElement("file");
                   fileElement->SetAttributes(cprjFileAttributes);
                 }
@@ -42,7 +42,7 @@ bool CbuildProject::CreateTarget(const string& targetName, const CprjFile *cprj,
   }
 
   // update attributes: toolchain and Dcore
-  map<string, string> attributes = target->GetAttributes();
+  map<string, string> attributes(target->GetAttributes());
   SetToolchain(toolchain, attributes);
   if (!AddAdditionalAttributes(attributes, targetName))
     return false;
@@ -27,6 +27,7 @@ public:
   bool AddPdsc(const std::string& pdscFile, bool bSkipCheckForOtherPdsc = false, bool validatePdsc = false);
   bool AddRefPdsc(const std::set<std::string>& pdscRefFiles);
   bool SetPackXsd(const std::string& packXsdFile);
+  void SetJobs(unsigned jobs);
   bool ReadAllPdsc();
   bool PrintPdscFiles(std::list<std::string>& pdscFiles);
 
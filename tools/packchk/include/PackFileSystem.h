@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PACKFILESYSTEM_H
+#define PACKFILESYSTEM_H
+
+#include <list>
+#include <string>
+
+/**
+ * @brief file access of the pack checks. A *.pack archive can be mounted at its own path,
+ *        e.g. '/path/Vendor.Pack.1.0.0.pack/Vendor.Pack.pdsc' then refers to an entry of the archive.
+ *        Paths below the mounted archive are answered from the archive index, other paths from the file system.
+ *        File system directories are enumerated once into a cached index and canonical paths are memoized,
+ *        the pack is not expected to change while it is checked.
+*/
+class PackFileSystem
+{
+private:
+  PackFileSystem() {};
+
+public:
+  /**
+   * @brief check if a file is a pack archive by its extension
+   * @param fileName file name
+   * @return true if file has extension '.pack'
+  */
+  static bool IsPackArchive(const std::string& fileName);
+
+  /**
+   * @brief mount a pack archive, replaces a previously mounted archive
+   * @param archiveFile absolute path of the archive
+   * @return true if the archive is opened
+  */
+  static bool Mount(const std::string& archiveFile);
+
+  /**
+   * @brief unmount the pack archive, clears the cache
+  */
+  static void Unmount();
+
+  /**
+   * @brief clear cached directory indexes and canonical paths, e.g. after files have been changed
+  */
+  static void ClearCache();
+
+  /**
+   * @brief check if a path refers to the mounted archive
+   * @param path absolute path
+   * @return true if path is the archive root or below
+  */
+  static bool IsInArchive(const std::string& path);
+
+  /**
+   * @brief check if a file or directory exists
+   * @param path absolute path
+   * @return true if exists
+  */
+  static bool Exists(const std::string& path);
+
+  /**
+   * @brief check if a path is a directory
+   * @param path absolute path
+   * @return true if path is a directory
+  */
+  static bool IsDirectory(const std::string& path);
+
+  /**
+   * @brief find a file or directory by case-insensitive name
+   * @param dir directory to search in
+   * @param name name to search for
+   * @param exactName returns the name as written on the file system or in the archive
+   * @return true if found
+  */
+  static bool FindExactName(const std::string& dir, const std::string& name, std::string& exactName);
+
+  /**
+   * @brief read a file
+   * @param path absolute path
+   * @param content returns file content
+   * @return true if the file is read
+  */
+  static bool ReadFile(const std::string& path, std::string& content);
+
+  /**
+   * @brief make path canonical, paths in the archive are normalized lexically
+   * @param path path to be canonicalized
+   * @return canonicalized path
+  */
+  static std::string MakePathCanonical(const std::string& path);
+
+  /**
+   * @brief search for *.pdsc files, subdirectories are only searched if a directory contains no *.pdsc file
+   * @param files list to receive absolute paths of found files
+   * @param path directory to search in
+   * @param depth maximum depth of subdirectories to search
+  */
+  static void GetPackageDescriptionFiles(std::list<std::string>& files, const std::string& path, int depth);
+};
+
+#endif // PACKFILESYSTEM_H
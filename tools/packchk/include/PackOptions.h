@@ -36,6 +36,8 @@ public:
   bool GetIgnoreOtherPdscFiles();
   bool SetDisableValidation(bool bDisable);
   bool GetDisableValidation();
+  bool SetJobs(unsigned jobs);
+  unsigned GetJobs();
   bool AddRefPdscFile(const std::string& filename);
   bool HaltProgramExecution();
   bool SetAllowSuppresssError(bool bAllow);
@@ -60,6 +62,7 @@ private:
   bool m_bIgnoreOtherPdscFiles;
   bool m_bDisableValidation;
   PedanticLevel m_pedanticLevel;
+  unsigned m_jobs;
 
   std::string m_urlRef;    // package URL reference, check the URL of the PDSC against this value. if not std::set it is compared against the Keil Pack Server URL
   std::string m_packNamePath;
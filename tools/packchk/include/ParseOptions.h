@@ -41,6 +41,7 @@ protected:
   bool SetIgnoreOtherPdscFiles(bool bIgnore);
   bool SetAllowSuppresssError(bool bAllow = true);
   bool SetDisableValidation(bool bDisable);
+  bool SetJobs(unsigned jobs);
 
 private:
   CPackOptions& m_packOptions;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -13,6 +13,12 @@
 #include "XMLTreeSlim.h"
 #include "ErrLog.h"
 
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 class RteModelReaderErrorVistior : public RteVisitor
 {
@@ -40,14 +46,22 @@ public:
   RteModelReader(RteGlobalModel& m_rteModel);
   ~RteModelReader();
 
-  bool AddFile(const std::string& fileName);
+  bool AddFile(const std::string& fileName, bool validate = false);
   bool ReadAll();
+  void SetJobs(unsigned jobs) { m_jobs = jobs; }
+  void SetSchemaFile(const std::string& schemaFile) { m_schemaFile = schemaFile; }
 
 private:
+  bool ParseAll(std::list<RtePackage*>& packs, std::vector<std::unique_ptr<ErrLogCapture> >& captures);
+
   RteGlobalModel& m_rteModel;
   RteItemBuilder m_rteItemBuilder;
   XMLTreeSlim m_xmlTree;
   ValueAdjuster m_valueAdjuster;
+  unsigned m_jobs;
+  std::string m_schemaFile;
+  std::set<std::string> m_validateFiles;
+  std::map<std::string, std::string> m_contents;   // content of files read from a pack archive
 };
 
 #endif // RTEMODELREADER_H
@@ -10,9 +10,12 @@
 #include "Validate.h"
 #include "PackChk.h"
 #include "GatherCompilers.h"
+#include "ErrLog.h"
 
 #include <list>
+#include <memory>
 #include <set>
+#include <vector>
 
 #define REGEX_NOTFOUND   0
 #define REGEX_FOUND      1
@@ -21,6 +24,21 @@
 class ValidateSemantic : public Validate
 {
 public:
+  // one combination of device processor, TrustZone mode and compiler, checked by a worker thread
+  struct DeviceDependencyCheck {
+    RteDeviceItem* device = nullptr;
+    std::string processorName;
+    std::string mcuDispName;
+    std::string trustZoneMode;
+    const compiler_s* compiler = nullptr;
+    int lineNo = 0;
+
+    std::unique_ptr<ErrLogCapture> capture;   // messages to print in the order of the combinations
+    std::string fileName;                     // file name set for the last checked startup component
+    bool bStartupFound = false;
+    bool bOk = true;
+  };
+
   ValidateSemantic(RteGlobalModel& rteModel, CPackOptions& packOptions);
   ~ValidateSemantic();
 
@@ -42,7 +60,11 @@ public:
   bool CheckDependencyResult(RteTarget* target, RteComponent* component, std::string mcuVendor, std::string mcuDispName, compiler_s compiler);
   bool ExcludeSysHeaderDirectories(const std::string& systemHeader, const std::string& rteFolder);
   bool FindFileFromList(const std::string& systemHeader, const std::set<RteFile*>& targFiles);
-  bool CheckDeviceDependencies(RteDeviceItem* device, RteProject* rteProject);
+  bool CheckDeviceDependencies(RteDeviceItem* device, std::vector<DeviceDependencyCheck>::const_iterator& check);
+  bool CheckStartupComponents(DeviceDependencyCheck& check, RteProject* rteProject);
+  bool RunDeviceDependencyChecks(std::vector<DeviceDependencyCheck>& checks);
+  void AddDeviceDependencyChecks(RteDeviceItem* device, std::vector<DeviceDependencyCheck>& checks);
+  std::list<std::string> GetTrustZoneModes(RteDeviceProperty* processor);
   bool HasExternalGenerator(RteComponentAggregate* aggregate);
   bool FileIsHeader(const std::string& name);
   bool CheckDeviceAttributes(RteDeviceItem *device);
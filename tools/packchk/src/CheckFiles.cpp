@@ -7,6 +7,7 @@
 
 #include "CrossPlatform.h"
 #include "ErrLog.h"
+#include "PackFileSystem.h"
 #include "RteUtils.h"
 #include "RteFsUtils.h"
 
@@ -429,7 +430,7 @@ bool CheckFiles::CheckFileExists(const string& fileName, int lineNo, bool associ
   }
 
   bool ok = true;
-  if(!RteFsUtils::Exists(checkPath)) {
+  if(!PackFileSystem::Exists(checkPath)) {
     if(associated) {
       LogMsg("M322", PATH(checkPath), lineNo);
     }
@@ -448,7 +449,7 @@ bool CheckFiles::CheckFileExists(const string& fileName, int lineNo, bool associ
 
 
 /**
- * @brief searches the filesystem for the exact name of a file object (case sensitive name)
+ * @brief searches the filesystem or pack archive for the exact name of a file object (case sensitive name)
  * @param path the path to search in
  * @param fileNameIn filename as written in PDSC
  * @param fileNameOut filename as written on filesystem
@@ -456,17 +457,7 @@ bool CheckFiles::CheckFileExists(const string& fileName, int lineNo, bool associ
 */
 bool CheckFiles::FindGetExactFileSystemName(const std::string& path, const std::string& fileNameIn, string& fileNameOut)
 {
-  error_code ec;
-  for (auto& item : fs::directory_iterator(path, ec)) {
-    const string fn = item.path().generic_string();
-    const string fsFn = RteUtils::ExtractFileName(fn);
-    if(!AlnumCmp::CompareLen(fileNameIn, fsFn, false)) {
-      fileNameOut = fsFn;
-      return true;
-    }
-  }
-
-  return false;
+  return PackFileSystem::FindExactName(path, fileNameIn, fileNameOut);
 }
 
 
@@ -483,12 +474,12 @@ bool CheckFiles::CheckFileIsInPack(const string& fileName, int lineNo)
   }
 
   string fullFileName = GetFullFilename(fileName);
-  string absPath = RteFsUtils::MakePathCanonical(fullFileName);
+  string absPath = PackFileSystem::MakePathCanonical(fullFileName);
   if(absPath.empty()) {
     return true;
   }
 
-  const auto& packPath = RteFsUtils::MakePathCanonical(GetPackagePath());
+  const auto& packPath = PackFileSystem::MakePathCanonical(GetPackagePath());
   if(absPath.find(packPath, 0) != 0) {
     LogMsg("M313", PATH(fileName), lineNo);
     return false;
@@ -858,7 +849,7 @@ bool CheckFiles::CheckFileExtension(RteItem* item)
   string checkPath = GetFullFilename(name);
 
   if(category == "include") {
-    if(!RteFsUtils::IsDirectory(checkPath)) {
+    if(!PackFileSystem::IsDirectory(checkPath)) {
       LogMsg("M339", PATH(name), lineNo);
       ok = false;
     }
@@ -868,7 +859,7 @@ bool CheckFiles::CheckFileExtension(RteItem* item)
     }
   }
   else {
-    if(RteFsUtils::IsDirectory(checkPath)) {
+    if(PackFileSystem::IsDirectory(checkPath)) {
       LogMsg("M356", PATH(name), lineNo);
       ok = false;
     }
@@ -926,13 +917,13 @@ bool CheckFiles::GatherIncPathVsAttrConfig(RteItem* item)
   }
 
   if(category == RteFile::Category::HEADER) {
-    const auto incPath = file->GetIncludePath();
+    const auto incPath = PackFileSystem::MakePathCanonical(file->GetIncludePath());
     m_includePaths[incPath] = file;
     return true;
   }
 
   if(category == RteFile::Category::INCLUDE) {
-    const auto incPath = file->GetOriginalAbsolutePath();
+    const auto incPath = PackFileSystem::MakePathCanonical(file->GetOriginalAbsolutePath());
     m_includePaths[incPath] = file;
     return true;
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,8 +7,8 @@
 #include "CreateModel.h"
 
 #include "ErrLog.h"
+#include "PackFileSystem.h"
 #include "RteFsUtils.h"
-#include "XmlChecker.h"
 
 #include <list>
 #include <string>
@@ -47,7 +47,7 @@ bool CreateModel::CheckForOtherPdscFiles(const string& pdscFullPath)
 
   // Search for PDSC files
   string path = RteUtils::ExtractFilePath(pdscFullPath, 0);
-  RteFsUtils::GetPackageDescriptionFiles(pdscFiles, path, 1024);
+  PackFileSystem::GetPackageDescriptionFiles(pdscFiles, path, 1024);
 
   // Multiple PDSC file found in package?
   if(pdscFiles.size() > 1) {
@@ -100,11 +100,11 @@ bool CreateModel::AddPdsc(const string& pdscFile, bool bSkipCheckForOtherPdsc /*
 
   LogMsg("M051", PATH(pdscFile));
 
-  if(!RteFsUtils::Exists(pdscFile)) {
+  if(!PackFileSystem::Exists(pdscFile)) {
     LogMsg("M204", PATH(pdscFile));
     return false;
   }
-  if(RteFsUtils::IsDirectory(pdscFile)) {
+  if(PackFileSystem::IsDirectory(pdscFile)) {
     LogMsg("M202", PATH(pdscFile));
     return false;
   }
@@ -116,13 +116,8 @@ bool CreateModel::AddPdsc(const string& pdscFile, bool bSkipCheckForOtherPdsc /*
     }
   }
 
-  if(m_validatePdsc && validatePdsc) {
-    if(!XmlChecker::Validate(pdscFile, m_schemaFile)) {
-      ; // continue checking
-    }
-  }
-
-  if(!m_reader.AddFile(pdscFile)) {
+  // schema validation runs while reading the file, errors do not stop checking
+  if(!m_reader.AddFile(pdscFile, m_validatePdsc && validatePdsc)) {
     LogMsg("M201", PATH(pdscFile));
     return false;
   }
@@ -162,9 +157,19 @@ bool CreateModel::SetPackXsd(const std::string& packXsdFile)
   }
 
   m_schemaFile = RteFsUtils::AbsolutePath(packXsdFile).generic_string();;
+  m_reader.SetSchemaFile(m_schemaFile);
   return true;
 }
 
+/**
+ * @brief set number of parallel jobs to read PDSC files
+ * @param jobs number of jobs, 0 for number of hardware threads
+ */
+void CreateModel::SetJobs(unsigned jobs)
+{
+  m_reader.SetJobs(jobs);
+}
+
 /**
  * @brief start reading all PDSC files
  * @return passed / failed
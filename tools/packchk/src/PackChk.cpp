@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -8,6 +8,7 @@
 #include "ValidateSemantic.h"
 #include "ValidateSyntax.h"
 #include "CreateModel.h"
+#include "PackFileSystem.h"
 
 #include "RteUtils.h"
 #include "RteFsUtils.h"
@@ -31,6 +32,7 @@ PackChk::PackChk()
 */
 PackChk::~PackChk()
 {
+  PackFileSystem::Unmount();
 }
 
 /**
@@ -91,6 +93,7 @@ bool PackChk::CheckPackage()
 {
   LogMsg("M061");
   CreateModel createModel(m_rteModel);
+  createModel.SetJobs(m_packOptions.GetJobs());
 
   // Validate all PDSC files against Pack.xsd
   if(!m_packOptions.GetDisableValidation()) {
@@ -100,7 +103,23 @@ bool PackChk::CheckPackage()
   }
 
   // Add PDSC files to check (currently limited to one)
-  const string& pdscFile = m_packOptions.GetPdscFullpath();
+  string pdscFile = m_packOptions.GetPdscFullpath();
+
+  // Check a pack archive without extracting it: its PDSC file is searched in the archive
+  if(PackFileSystem::IsPackArchive(pdscFile)) {
+    if(!PackFileSystem::Mount(pdscFile)) {
+      LogMsg("M220", PATH(pdscFile));
+      return false;
+    }
+    list<string> pdscFiles;
+    PackFileSystem::GetPackageDescriptionFiles(pdscFiles, pdscFile, 1024);
+    if(pdscFiles.empty()) {
+      LogMsg("M221", PATH(pdscFile));
+      return false;
+    }
+    pdscFile = pdscFiles.front();
+  }
+
   if(!createModel.AddPdsc(pdscFile, m_packOptions.GetIgnoreOtherPdscFiles(), true)) {
     return false;
   }
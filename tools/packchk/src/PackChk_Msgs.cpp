@@ -38,7 +38,7 @@ const MsgTable PackChk::msgTable = {
   { "M069", { MsgLevel::LEVEL_INFO,     CRLF_B, "Checking Component 'Cclass=%CCLASS%, Cgroup=%CGROUP%, Csub=%CSUB%, Cversion=%CVER%' Dependencies." } },
   { "M070", { MsgLevel::LEVEL_INFO,     CRLF_B, "Checking Memory '%NAME%' for device '%NAME2%'" } },
   { "M071", { MsgLevel::LEVEL_INFO,     CRLF_B, "Searching for memory for device '%NAME%'" } },
-  { "M072", { MsgLevel::LEVEL_INFO,     CRLF_B, "" } },
+  { "M072", { MsgLevel::LEVEL_PROGRESS, CRLF_B, "Condition filter cache: %HITS% hits, %MISSES% misses" } },
   { "M073", { MsgLevel::LEVEL_INFO,     CRLF_B, "File open failed: '%PATH%'" } },
   { "M074", { MsgLevel::LEVEL_PROGRESS, CRLF_B, "Checking if File is in Pack: '%PATH%'" } },
   { "M075", { MsgLevel::LEVEL_PROGRESS, CRLF_B, "Reading PDSC File: %TIME%ms. Passed" } },
@@ -103,6 +103,8 @@ const MsgTable PackChk::msgTable = {
   { "M217", { MsgLevel::LEVEL_ERROR,    CRLF_B, ""} },
   { "M218", { MsgLevel::LEVEL_ERROR,    CRLF_B, "Unable to find PACK.xsd schema file. Searched in '%MSG%' relative to '%PATH%'.\n  Alternatively use --xsd to specify the location of the schema file. "} },
   { "M219", { MsgLevel::LEVEL_ERROR,    CRLF_B, "Unable to find specified schema file '%PATH%'"} },
+  { "M220", { MsgLevel::LEVEL_ERROR,    CRLF_B, "Cannot open pack archive '%PATH%'"} },
+  { "M221", { MsgLevel::LEVEL_ERROR,    CRLF_B, "No PDSC file found in pack archive '%PATH%'"} },
 
 // 300... Validation Errors
   { "M300", { MsgLevel::LEVEL_WARNING,  CRLF_B, "%TAG% must use '%URL%'" } },
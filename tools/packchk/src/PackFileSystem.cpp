@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "PackFileSystem.h"
+
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+#include "RteZipArchive.h"
+
+#include <cctype>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+static unique_ptr<RteZipArchive> theArchive;   // mounted pack archive
+
+// names of a file system directory
+struct DirectoryIndex {
+  unordered_set<string> names;                    // exact names
+  unordered_map<string, string> upperCaseNames;   // upper case name -> exact name, first in directory order
+};
+
+// file system cache, guarded by theCacheMutex: checks may run concurrently
+static mutex theCacheMutex;
+static unordered_map<string, shared_ptr<const DirectoryIndex> > theDirectoryIndexes;   // directory -> index
+static unordered_map<string, string> theCanonicalPaths;                                // path -> canonical path
+
+/**
+ * @brief convert a name to upper case for case-insensitive comparison
+ * @param name name to convert
+ * @return upper case name
+*/
+static string ToUpperCase(const string& name)
+{
+  string upperCase = name;
+  for(char& c : upperCase) {
+    c = (char)toupper((unsigned char)c);
+  }
+  return upperCase;
+}
+
+/**
+ * @brief get the index of a file system directory, the directory is enumerated on first access
+ * @param dir directory path
+ * @param refresh true to enumerate the directory again
+ * @return directory index, empty if the directory cannot be read
+*/
+static shared_ptr<const DirectoryIndex> GetDirectoryIndex(const string& dir, bool refresh = false)
+{
+  if(!refresh) {
+    lock_guard<mutex> lock(theCacheMutex);
+    auto it = theDirectoryIndexes.find(dir);
+    if(it != theDirectoryIndexes.end()) {
+      return it->second;
+    }
+  }
+
+  auto index = make_shared<DirectoryIndex>();
+  error_code ec;
+  for(auto& item : fs::directory_iterator(dir, ec)) {
+    const string name = item.path().filename().generic_string();
+    index->names.insert(name);
+    index->upperCaseNames.emplace(ToUpperCase(name), name);
+  }
+
+  lock_guard<mutex> lock(theCacheMutex);
+  theDirectoryIndexes[dir] = index;
+  return index;
+}
+
+/**
+ * @brief get the archive entry a path refers to
+ * @param path absolute path
+ * @param entryPath returns path relative to archive root
+ * @return true if path is the archive root or below
+*/
+static bool GetEntryPath(const string& path, string& entryPath)
+{
+  if(!theArchive) {
+    return false;
+  }
+  const string& root = theArchive->GetFileName();
+  const string p = RteUtils::BackSlashesToSlashes(path);
+  if(p.compare(0, root.size(), root) != 0) {
+    return false;
+  }
+  if(p.size() == root.size()) {
+    entryPath.clear();
+    return true;
+  }
+  if(p[root.size()] != '/') {
+    return false;
+  }
+  entryPath = p.substr(root.size() + 1);
+  return true;
+}
+
+/**
+ * @brief search for *.pdsc files in an archive directory, see PackFileSystem::GetPackageDescriptionFiles()
+*/
+static void GetArchivePdscFiles(list<string>& files, const string& dir, int depth)
+{
+  vector<string> names;
+  if(!theArchive->List(dir, names)) {
+    return;
+  }
+
+  bool bFound = false;
+  vector<string> dirs;
+  for(const string& name : names) {
+    const string entryPath = dir.empty() ? name : dir + "/" + name;
+    if(theArchive->IsRegularFile(entryPath)) {
+      if(RteUtils::EqualNoCase(RteUtils::ExtractFileExtension(name), "pdsc")) {
+        files.push_back(theArchive->GetFileName() + "/" + entryPath);
+        bFound = true;
+      }
+    }
+    else if(depth > 0 && name.find('.') != 0) {   // ignore .web, .download directories
+      dirs.push_back(entryPath);
+    }
+  }
+  if(bFound || depth <= 0) {
+    return;
+  }
+
+  for(const string& subDir : dirs) {
+    GetArchivePdscFiles(files, subDir, depth - 1);
+  }
+}
+
+bool PackFileSystem::IsPackArchive(const string& fileName)
+{
+  return RteUtils::EqualNoCase(RteUtils::ExtractFileExtension(fileName), "pack");
+}
+
+bool PackFileSystem::Mount(const string& archiveFile)
+{
+  Unmount();
+  unique_ptr<RteZipArchive> archive = make_unique<RteZipArchive>();
+  if(!archive->Open(RteFsUtils::AbsolutePath(archiveFile).generic_string())) {
+    return false;
+  }
+  theArchive = std::move(archive);
+  return true;
+}
+
+void PackFileSystem::Unmount()
+{
+  theArchive.reset();
+  ClearCache();
+}
+
+void PackFileSystem::ClearCache()
+{
+  lock_guard<mutex> lock(theCacheMutex);
+  theDirectoryIndexes.clear();
+  theCanonicalPaths.clear();
+}
+
+bool PackFileSystem::IsInArchive(const string& path)
+{
+  string entryPath;
+  return GetEntryPath(path, entryPath);
+}
+
+bool PackFileSystem::Exists(const string& path)
+{
+  string entryPath;
+  if(GetEntryPath(path, entryPath)) {
+    return theArchive->Exists(entryPath);
+  }
+
+  // look up the name in the index of its directory, the file system is only asked for names not found there
+  const string p = RteUtils::BackSlashesToSlashes(path);
+  const string name = RteUtils::ExtractFileName(p);
+  if(!name.empty() && name != "." && name != "..") {
+    if(GetDirectoryIndex(RteUtils::ExtractFilePath(p, false))->names.count(name)) {
+      return true;
+    }
+  }
+  return RteFsUtils::Exists(path);
+}
+
+bool PackFileSystem::IsDirectory(const string& path)
+{
+  string entryPath;
+  if(GetEntryPath(path, entryPath)) {
+    return theArchive->IsDirectory(entryPath);
+  }
+  return RteFsUtils::IsDirectory(path);
+}
+
+bool PackFileSystem::FindExactName(const string& dir, const string& name, string& exactName)
+{
+  string entryPath;
+  if(GetEntryPath(dir, entryPath)) {
+    string exactPath;
+    if(!theArchive->GetExactPath(entryPath + "/" + name, exactPath)) {
+      return false;
+    }
+    exactName = RteUtils::ExtractFileName(exactPath);
+    return true;
+  }
+
+  // a name not found in the cached index is searched again: the directory could have been changed
+  const string upperCaseName = ToUpperCase(name);
+  for(bool refresh : { false, true }) {
+    auto index = GetDirectoryIndex(dir, refresh);
+    auto it = index->upperCaseNames.find(upperCaseName);
+    if(it != index->upperCaseNames.end()) {
+      exactName = it->second;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool PackFileSystem::ReadFile(const string& path, string& content)
+{
+  string entryPath;
+  if(GetEntryPath(path, entryPath)) {
+    return theArchive->ReadFile(entryPath, content);
+  }
+  return RteFsUtils::ReadFile(path, content);
+}
+
+string PackFileSystem::MakePathCanonical(const string& path)
+{
+  string entryPath;
+  if(GetEntryPath(path, entryPath)) {
+    string normalized;
+    if(!RteZipArchive::NormalizePath(entryPath, normalized)) {
+      return fs::path(RteUtils::BackSlashesToSlashes(path)).lexically_normal().generic_string();   // outside of the archive
+    }
+    return normalized.empty() ? theArchive->GetFileName() : theArchive->GetFileName() + "/" + normalized;
+  }
+
+  {
+    lock_guard<mutex> lock(theCacheMutex);
+    auto it = theCanonicalPaths.find(path);
+    if(it != theCanonicalPaths.end()) {
+      return it->second;
+    }
+  }
+  const string canonical = RteFsUtils::MakePathCanonical(path);
+  lock_guard<mutex> lock(theCacheMutex);
+  theCanonicalPaths[path] = canonical;
+  return canonical;
+}
+
+void PackFileSystem::GetPackageDescriptionFiles(list<string>& files, const string& path, int depth)
+{
+  string entryPath;
+  if(GetEntryPath(path, entryPath)) {
+    string normalized;
+    if(RteZipArchive::NormalizePath(entryPath, normalized)) {
+      GetArchivePdscFiles(files, normalized, depth);
+    }
+    return;
+  }
+  RteFsUtils::GetPackageDescriptionFiles(files, path, depth);
+}
@@ -21,7 +21,8 @@ using namespace std;
 CPackOptions::CPackOptions() :
   m_bIgnoreOtherPdscFiles(false),
   m_bDisableValidation(false),
-  m_pedanticLevel(PedanticLevel::NONE)
+  m_pedanticLevel(PedanticLevel::NONE),
+  m_jobs(0)
 {
 }
 
@@ -334,6 +335,27 @@ bool CPackOptions::SetDisableValidation(bool bDisable)
   return true;
 }
 
+/**
+ * @brief set number of parallel jobs to read PDSC files and check devices
+ * @param jobs number of jobs, 0 for number of hardware threads
+ * @return passed / failed
+ */
+bool CPackOptions::SetJobs(unsigned jobs)
+{
+  m_jobs = jobs;
+
+  return true;
+}
+
+/**
+ * @brief returns number of parallel jobs to read PDSC files and check devices
+ * @return number of jobs, 0 for number of hardware threads
+*/
+unsigned CPackOptions::GetJobs()
+{
+  return m_jobs;
+}
+
 /**
  * @brief returns the program version string
  * @return string version
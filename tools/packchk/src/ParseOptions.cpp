@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+* Copyright (c) 2020-2025 Arm Limited. All rights reserved.
 *
 * SPDX-License-Identifier: Apache-2.0
 */
@@ -185,6 +185,16 @@ bool ParseOptions::SetDisableValidation(bool bDisable)
   return m_packOptions.SetDisableValidation(bDisable);
 }
 
+/**
+ * @brief option "j,jobs"
+ * @param jobs number of parallel jobs
+ * @return passed / failed
+*/
+bool ParseOptions::SetJobs(unsigned jobs)
+{
+  return m_packOptions.SetJobs(jobs);
+}
+
 /**
  * @brief parses all options
  * @param argc command line
@@ -203,9 +213,9 @@ ParseOptions::Result ParseOptions::Parse(int argc, const char* argv[])
     options
       .set_width(80)
       .custom_help("[-V] [--version] [-h] [--help]\n          [OPTIONS...]")
-      .positional_help("<PDSC file>")
+      .positional_help("<PDSC or pack file>")
       .add_options("packchk", {
-        {"input", "Input PDSC", cxxopts::value<std::string>()->default_value("")},
+        {"input", "Input PDSC or pack file", cxxopts::value<std::string>()->default_value("")},
         {"i,include", "PDSC file(s) as dependency reference", cxxopts::value<std::vector<std::string>>()},
         {"b,log", "Log file", cxxopts::value<string>()},
         {"x,diag-suppress", "Suppress Messages", cxxopts::value<std::vector<std::string>>()},
@@ -214,6 +224,7 @@ ParseOptions::Result ParseOptions::Parse(int argc, const char* argv[])
         {"w,warning", "Warning level [0|1|2|3|all]", cxxopts::value<string>()->default_value("all")},  /* -w0 .. -w3, -wall */
         {"u,url", "Verifies that the specified URL matches with the <url> element in the *.PDSC file", cxxopts::value<string>()->default_value("")},
         {"n,name", "Text file for pack file name", cxxopts::value<string>()->default_value("")},
+        {"j,jobs", "Number of parallel jobs to read PDSC files and check devices, 0 for number of hardware threads", cxxopts::value<unsigned>()->default_value("0")},
         {"V,version", "Print version"},
         {"h,help", "Print usage"},
         {"disable-validation", "Disable the pdsc validation against the PACK.xsd.", cxxopts::value<bool>()->default_value("false")},
@@ -308,6 +319,11 @@ ParseOptions::Result ParseOptions::Parse(int argc, const char* argv[])
         bOk = false;
       }
     }
+    if(parseResult.count("jobs")) {
+      if(!SetJobs(parseResult["jobs"].as<unsigned>())) {
+        bOk = false;
+      }
+    }
     if(parseResult.count("ignore-other-pdsc")) {
       if(!SetIgnoreOtherPdscFiles(parseResult["ignore-other-pdsc"].as<bool>())) {
         bOk = false;
@@ -1,15 +1,23 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 #include "RteModelReader.h"
 
 #include "CrossPlatformUtils.h"
+#include "PackFileSystem.h"
 #include "RteUtils.h"
+#include "ThreadPool.h"
 #include "XMLTreeSlim.h"
+#include "XmlChecker.h"
 #include "ErrLog.h"
 
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
 using namespace std;
 
 /**
@@ -85,7 +93,8 @@ string ValueAdjuster::AdjustPath(const string& fileName, int lineNo)
 RteModelReader::RteModelReader(RteGlobalModel& rteModel) :
   m_rteModel(rteModel),
   m_rteItemBuilder(&rteModel),
-  m_xmlTree(&m_rteItemBuilder)
+  m_xmlTree(&m_rteItemBuilder),
+  m_jobs(1)
 {
   m_xmlTree.SetXmlValueAdjuster(&m_valueAdjuster);
   m_xmlTree.Init();
@@ -99,17 +108,93 @@ RteModelReader::~RteModelReader()
 }
 
 /**
- * @brief adds a file to XmlReader
+ * @brief adds a file to XmlReader, a file inside a mounted pack archive is read into memory
  * @param fileName
+ * @param validate validate the file against the schema file while reading
  * @return
 */
-bool RteModelReader::AddFile(const string& fileName)
+bool RteModelReader::AddFile(const string& fileName, bool validate /* = false */)
 {
   if(fileName.empty()) {
     return false;
   }
 
-  return m_xmlTree.AddFileName(fileName);
+  if(PackFileSystem::IsInArchive(fileName)) {
+    string content;
+    if(!PackFileSystem::ReadFile(fileName, content)) {
+      return false;
+    }
+    m_contents[fileName] = std::move(content);
+  }
+
+  if(!m_xmlTree.AddFileName(fileName)) {
+    return false;
+  }
+  if(validate) {
+    m_validateFiles.insert(fileName);
+  }
+  return true;
+}
+
+/**
+ * @brief parse all added xml files, concurrently if more than one job is set.
+ *        Messages are collected per file, unless files are parsed sequentially from disk without validation.
+ * @param packs list to receive created packs
+ * @param captures receives the messages per file in the order files were added
+ * @return passed / failed
+*/
+bool RteModelReader::ParseAll(list<RtePackage*>& packs, vector<unique_ptr<ErrLogCapture> >& captures)
+{
+  const list<string>& fileNameList = m_xmlTree.GetFileNames();
+  const vector<string> fileNames(fileNameList.begin(), fileNameList.end());
+  ThreadPool threadPool(m_jobs);
+  const size_t workerCount = threadPool.GetWorkerCount(fileNames.size());
+  if(workerCount <= 1 && m_validateFiles.empty() && m_contents.empty()) {
+    bool bOk = m_xmlTree.ParseAll();
+    packs = m_rteItemBuilder.GetPacks();
+    return bOk;
+  }
+
+  // parser objects are created here: their initialization is not thread-safe
+  vector<unique_ptr<ValueAdjuster> > valueAdjusters;
+  vector<unique_ptr<XMLTreeSlim> > xmlTrees;
+  for(size_t i = 0; i < workerCount; i++) {
+    valueAdjusters.push_back(make_unique<ValueAdjuster>());
+    xmlTrees.push_back(make_unique<XMLTreeSlim>());
+    xmlTrees.back()->SetXmlValueAdjuster(valueAdjusters.back().get());
+    xmlTrees.back()->Init();
+  }
+
+  vector<unique_ptr<RteItemBuilder> > itemBuilders(fileNames.size());
+  captures.resize(fileNames.size());
+  vector<char> results(fileNames.size(), 0);
+  threadPool.ForEach(fileNames.size(), [&](size_t index, size_t worker) {
+    XMLTreeSlim* xmlTree = xmlTrees[worker].get();
+    itemBuilders[index] = make_unique<RteItemBuilder>(&m_rteModel);
+    captures[index] = make_unique<ErrLogCapture>();
+    captures[index]->Start();
+    xmlTree->Clear();
+    xmlTree->SetXmlItemBuilder(itemBuilders[index].get());
+    auto content = m_contents.find(fileNames[index]);
+    if(content != m_contents.end()) {
+      results[index] = xmlTree->Parse(fileNames[index], content->second);
+    }
+    else {
+      results[index] = xmlTree->AddFileName(fileNames[index], true);
+    }
+    xmlTree->SetXmlItemBuilder(nullptr);
+    captures[index]->Stop();
+  });
+
+  bool bOk = true;
+  for(size_t i = 0; i < fileNames.size(); i++) {
+    if(!results[i]) {
+      bOk = false;
+    }
+    const list<RtePackage*>& filePacks = itemBuilders[i]->GetPacks();
+    packs.insert(packs.end(), filePacks.begin(), filePacks.end());
+  }
+  return bOk;
 }
 
 /**
@@ -118,10 +203,58 @@ bool RteModelReader::AddFile(const string& fileName)
 */
 bool RteModelReader::ReadAll()
 {
+  // ----------------------  Validate XML  ----------------------
+  // runs in the background while the files are read
+  map<string, unique_ptr<ErrLogCapture> > validations;
+  for(const string& fileName : m_validateFiles) {
+    validations[fileName] = make_unique<ErrLogCapture>();
+  }
+  thread validator;
+  if(!validations.empty()) {
+    validator = thread([this, &validations]() {
+      for(auto& [fileName, capture] : validations) {
+        capture->Start();
+        auto content = m_contents.find(fileName);
+        if(content != m_contents.end()) {
+          XmlChecker::ValidateContent(fileName, content->second, m_schemaFile);
+        }
+        else {
+          XmlChecker::Validate(fileName, m_schemaFile);
+        }
+        capture->Stop();
+      }
+    });
+  }
+
   // ----------------------  Read XML  ----------------------
   uint32_t t1 = CrossPlatformUtils::ClockInMsec();
-  bool bOk = m_xmlTree.ParseAll();
+  list<RtePackage*> packs;
+  vector<unique_ptr<ErrLogCapture> > captures;
+  bool bOk = ParseAll(packs, captures);
   uint32_t t2 = CrossPlatformUtils::ClockInMsec() - t1;
+
+  // print messages per file, validation and parser messages ordered by line
+  if(validator.joinable()) {
+    validator.join();
+  }
+  const list<string>& fileNames = m_xmlTree.GetFileNames();
+  auto fileName = fileNames.begin();
+  for(size_t i = 0; i < captures.size() && fileName != fileNames.end(); i++, fileName++) {
+    auto it = validations.find(*fileName);
+    if(it == validations.end()) {
+      captures[i]->Replay();
+      continue;
+    }
+    it->second->Merge(*captures[i]);
+    it->second->Replay();
+    validations.erase(it);
+  }
+  // files not parsed, e.g. when parsing stopped at an error
+  for(auto& [validateFile, capture] : validations) {
+    capture->Replay();
+  }
+  m_validateFiles.clear();
+  m_contents.clear();
   LogMsg("M075", TIME(t2));
 
   if(!bOk) {
@@ -131,7 +264,7 @@ bool RteModelReader::ReadAll()
 
   // ----------------------  Construct Model  ----------------------
   t1 = CrossPlatformUtils::ClockInMsec();
-  m_rteModel.InsertPacks(m_rteItemBuilder.GetPacks());
+  m_rteModel.InsertPacks(packs);
   t2 = CrossPlatformUtils::ClockInMsec() - t1;
   LogMsg("M076", TIME(t2));
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,7 +10,9 @@
 #include "RteModel.h"
 #include "RteProject.h"
 #include "RteFsUtils.h"
+#include "PackFileSystem.h"
 #include "ErrLog.h"
+#include "ThreadPool.h"
 
 using namespace std;
 
@@ -37,6 +39,8 @@ ValidateSemantic::~ValidateSemantic()
 */
 bool ValidateSemantic::Check()
 {
+  RteCondition::ResetFilterCacheStatistics();
+
   for(auto packItem : GetModel().GetChildren()) {
     RtePackage* pKg = dynamic_cast<RtePackage*>(packItem);
     if(!pKg) {
@@ -58,6 +62,10 @@ bool ValidateSemantic::Check()
 
   TestComponentDependencies();
 
+  // conditions are filtered for many devices sharing the same attributes
+  LogMsg("M072", VAL("HITS", to_string(RteCondition::GetFilterCacheHits())),
+    VAL("MISSES", to_string(RteCondition::GetFilterCacheMisses())));
+
   return true;
 }
 
@@ -153,7 +161,7 @@ const map<RteItem::ConditionResult, string> conditionResultTxt = {
  */
 bool ValidateSemantic::OutputDepResults(const RteDependencyResult& dependencyResult, bool inRecursion /*= 0*/)
 {
-  static int recursionCnt = 0;
+  static thread_local int recursionCnt = 0;
   if(!inRecursion) {
     recursionCnt = 0;
   }
@@ -560,34 +568,40 @@ bool ValidateSemantic::CheckDeviceAttributes(RteDeviceItem *device)
 }
 
 /**
- * @brief Check device dependencies. Tests if all dependencies are solved and a minimum
- *        on support files and configuration has been defined
+ * @brief get TrustZone modes to check for a processor
+ * @param processor RteDeviceProperty processor to run on
+ * @return list of modes, an empty string if the processor has no TrustZone
+ */
+list<string> ValidateSemantic::GetTrustZoneModes(RteDeviceProperty* processor)
+{
+  list<string> trustZoneList;
+  auto trustZone = processor->GetAttribute("Dtz");
+  if(trustZone.empty()) {
+    trustZoneList.push_back("");
+  }
+  else {
+    trustZoneList.push_back("TZ-disabled");
+    trustZoneList.push_back("Secure");
+    trustZoneList.push_back("Non-secure");
+  }
+
+  return trustZoneList;
+}
+
+/**
+ * @brief add all processor, TrustZone mode and compiler combinations of a device to the list of checks
  * @param device RteDeviceItem to run on
- * @param rteProject  RteProject to run on
- * @return passed / failed
+ * @param checks list to add the combinations to, in the order their messages are printed
  */
-bool ValidateSemantic::CheckDeviceDependencies(RteDeviceItem *device, RteProject* rteProject)
+void ValidateSemantic::AddDeviceDependencyChecks(RteDeviceItem* device, vector<DeviceDependencyCheck>& checks)
 {
   if(!device) {
-    return false;
+    return;
   }
 
   const string& mcuName = device->GetName();
-  const string& mcuVendor = device->GetEffectiveAttribute("Dvendor");
-  int lineNo = device->GetLineNumber();
-
-  CheckForUnsupportedChars(mcuName, "Dname", lineNo);
-
-  XmlItem deviceStartup;
-  deviceStartup.SetAttribute("Cclass", "Device");
-  deviceStartup.SetAttribute("Cgroup", "Startup");
-
-  bool bOk = true;
   for(auto &[processorName, processor] : device->GetProcessors()) {
     const string& Pname = processor->GetEffectiveAttribute("Pname");
-    lineNo = processor->GetLineNumber();
-
-    CheckDeviceDescription(device, processor);
 
     string mcuDispName = mcuName;
     if(!processorName.empty()) {
@@ -595,209 +609,314 @@ bool ValidateSemantic::CheckDeviceDependencies(RteDeviceItem *device, RteProject
       mcuDispName += Pname;
     }
 
-    list<string> trustZoneList;
-    auto trustZone = processor->GetAttribute("Dtz");
-    if(trustZone.empty()) {
-      trustZoneList.push_back("");
+    for(auto& trustZoneMode : GetTrustZoneModes(processor)) {
+      for(auto &[compilerKey, compiler] : m_compilers) {
+        checks.emplace_back();
+        DeviceDependencyCheck& check = checks.back();
+        check.device = device;
+        check.processorName = processorName;
+        check.mcuDispName = mcuDispName;
+        check.trustZoneMode = trustZoneMode;
+        check.compiler = &compiler;
+        check.lineNo = processor->GetLineNumber();
+      }
     }
-    else {
-      trustZoneList.push_back("TZ-disabled");
-      trustZoneList.push_back("Secure");
-      trustZoneList.push_back("Non-secure");
+  }
+}
+
+/**
+ * @brief run device dependency checks concurrently. Every worker filters its own
+ *        RteProject, messages are captured per check and printed by CheckDeviceDependencies()
+ * @param checks list of combinations to check
+ * @return passed / failed
+ */
+bool ValidateSemantic::RunDeviceDependencyChecks(vector<DeviceDependencyCheck>& checks)
+{
+  RteGlobalModel& model = GetModel();
+  ThreadPool threadPool(GetOptions().GetJobs());
+  const size_t workerCount = threadPool.GetWorkerCount(checks.size());
+
+  // projects are created here: adding projects to the model is not thread-safe
+  vector<RteProject*> rteProjects;
+  for(size_t i = 0; i < workerCount; i++) {
+    RteProject* rteProject = model.AddProject((int)i + 1);
+    if(!rteProject) {
+      return false;
     }
+    rteProjects.push_back(rteProject);
+  }
 
-    for(auto trustZoneMode : trustZoneList) {
-      RteItem filter;
-      device->GetEffectiveFilterAttributes(processorName, filter);
-      filter.AddAttribute("Dname", mcuName);
+  threadPool.ForEach(checks.size(), [&](size_t index, size_t worker) {
+    DeviceDependencyCheck& check = checks[index];
+    check.capture = make_unique<ErrLogCapture>();
+    check.capture->Start();
+    CheckStartupComponents(check, rteProjects[worker]);
+    check.capture->Stop();
+  });
 
-      for(auto &[compilerKey, compiler] : m_compilers) {
-        filter.AddAttribute("Tcompiler", compiler.tcompiler);
-        filter.AddAttribute("Toptions", compiler.toptions);
+  for(size_t i = 0; i < workerCount; i++) {
+    model.DeleteProject((int)i + 1);
+  }
 
-        if(!trustZoneMode.empty()) {
-          filter.AddAttribute("Dsecure", trustZoneMode);
-        }
+  return true;
+}
 
-        rteProject->Clear();
-        rteProject->AddTarget("Test", filter.GetAttributes(), true, true);
-        rteProject->SetActiveTarget("Test");
-        RteTarget* target = rteProject->GetActiveTarget();
-        rteProject->FilterComponents();
+/**
+ * @brief check startup components of one device, processor, TrustZone mode and compiler combination.
+ *        Can be called concurrently for different projects.
+ * @param check combination to check, receives the result
+ * @param rteProject RteProject to run on, used by the calling thread only
+ * @return passed / failed
+ */
+bool ValidateSemantic::CheckStartupComponents(DeviceDependencyCheck& check, RteProject* rteProject)
+{
+  RteDeviceItem* device = check.device;
+  const string& mcuVendor = device->GetEffectiveAttribute("Dvendor");
+  const string& mcuDispName = check.mcuDispName;
+  const compiler_s& compiler = *check.compiler;
+  int lineNo = check.lineNo;
 
-        set<RteComponentAggregate*> startupComponents;
-        target->GetComponentAggregates(deviceStartup, startupComponents);
-        if(startupComponents.empty()) {
-          LogMsg("M350", COMP("Startup"), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
-          continue;  // error: no startup component found
-        }
+  XmlItem deviceStartup;
+  deviceStartup.SetAttribute("Cclass", "Device");
+  deviceStartup.SetAttribute("Cgroup", "Startup");
 
-        for(auto aggregate : startupComponents) {
-          ErrLog::Get()->SetFileName(aggregate->GetPackage()->GetPackageFileName());
-          string targetPath = RteUtils::ExtractFilePath(aggregate->GetPackage()->GetPackageFileName(), false);
+  RteItem filter;
+  device->GetEffectiveFilterAttributes(check.processorName, filter);
+  filter.AddAttribute("Dname", device->GetName());
+  filter.AddAttribute("Tcompiler", compiler.tcompiler);
+  filter.AddAttribute("Toptions", compiler.toptions);
+  if(!check.trustZoneMode.empty()) {
+    filter.AddAttribute("Dsecure", check.trustZoneMode);
+  }
 
-          for(auto &[componentKey, componentMap] : aggregate->GetAllComponents()) {
-            int foundSystemC = 0, foundStartup = 0;
-            bool bFoundSystemH = false;
-            int lineSystem = 0, lineStartup = 0;
+  rteProject->Clear();
+  // only filtering and dependency results are needed: do not write RTE headers and config files,
+  // the projects of all workers would write to the same RTE/_Test folder concurrently
+  rteProject->SetAttribute("update-rte-files", "0");
+  rteProject->AddTarget("Test", filter.GetAttributes(), true, true);
+  rteProject->SetActiveTarget("Test");
+  RteTarget* target = rteProject->GetActiveTarget();
+  rteProject->FilterComponents();
+
+  set<RteComponentAggregate*> startupComponents;
+  target->GetComponentAggregates(deviceStartup, startupComponents);
+  check.bStartupFound = !startupComponents.empty();
+  if(!check.bStartupFound) {
+    return true;  // error: no startup component found, reported by CheckDeviceDependencies()
+  }
 
-            for(auto& [key, component] : componentMap) {
-              string compId = component->GetComponentID(true);
-              LogMsg("M091", COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
+  bool bOk = true;
+  for(auto aggregate : startupComponents) {
+    check.fileName = aggregate->GetPackage()->GetPackageFileName();
+    ErrLog::Get()->SetFileName(check.fileName);
+    string targetPath = RteUtils::ExtractFilePath(aggregate->GetPackage()->GetPackageFileName(), false);
 
-              UpdateRte(target, rteProject, component);
-              int lineNo = component->GetLineNumber();
+    for(auto &[componentKey, componentMap] : aggregate->GetAllComponents()) {
+      int foundSystemC = 0, foundStartup = 0;
+      bool bFoundSystemH = false;
+      int lineSystem = 0, lineStartup = 0;
 
-              CheckDependencyResult(target, component, mcuVendor, mcuDispName, compiler);
+      for(auto& [key, component] : componentMap) {
+        string compId = component->GetComponentID(true);
+        LogMsg("M091", COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
 
-              const set<RteFile*>& targFiles = target->GetFilteredFiles(component);
-              if(targFiles.empty()) {
-                LogMsg("M352", COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
-                continue;
-              }
+        UpdateRte(target, rteProject, component);
+        int lineNo = component->GetLineNumber();
+
+        CheckDependencyResult(target, component, mcuVendor, mcuDispName, compiler);
+
+        const set<RteFile*>& targFiles = target->GetFilteredFiles(component);
+        if(targFiles.empty()) {
+          LogMsg("M352", COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
+          continue;
+        }
+
+        const string& deviceHeaderfile = target->GetDeviceHeader();
+        if(deviceHeaderfile.empty()) {
+          LogMsg("M353", VAL("FILECAT", "Device Header-file"), COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
+          bOk = false;
+        }
+
+        const set<string>& incPaths = target->GetIncludePaths();
+        if(incPaths.empty()) {
+          LogMsg("M355", VAL("FILECAT", "Include"), COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
+          bOk = false;
+        }
+
+        for(auto file : targFiles) {
+          const string& category = file->GetAttribute("category");
 
-              const string& deviceHeaderfile = target->GetDeviceHeader();
-              if(deviceHeaderfile.empty()) {
-                LogMsg("M353", VAL("FILECAT", "Device Header-file"), COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
-                bOk = false;
+          if(category == "source" || category == "sourceAsm" || category == "sourceC") {
+            string fileName = RteUtils::BackSlashesToSlashes(RteUtils::ExtractFileName(file->GetName()));
+            if(fileName.empty()) {
+              continue;
+            }
+            const string& attribute = file->GetAttribute("attr");
+
+            if(attribute == "config" && FileIsHeader(fileName)) {
+              const string& fullFileName = targetPath + "/" + file->GetName();
+              const string hPath = RteUtils::ExtractFilePath(fullFileName, false);
+              const auto incPathFound = incPaths.find(hPath);
+              if(incPathFound != incPaths.end()) {
+                LogMsg("M357", NAME(file->GetName()), file->GetLineNumber());
               }
+            }
 
-              const set<string>& incPaths = target->GetIncludePaths();
-              if(incPaths.empty()) {
-                LogMsg("M355", VAL("FILECAT", "Include"), COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
-                bOk = false;
+            if(FindName(fileName, "system_", ".c")) {
+              foundSystemC++;
+              lineSystem = file->GetLineNumber();
+              if(attribute != "config") {
+                LogMsg("M377", NAME(fileName), TYP(category), lineNo);
               }
 
-              for(auto file : targFiles) {
-                const string& category = file->GetAttribute("category");
+              string systemHeader = RteUtils::ExtractFileBaseName(fileName);
+              systemHeader += ".h";
 
-                if(category == "source" || category == "sourceAsm" || category == "sourceC") {
-                  string fileName = RteUtils::BackSlashesToSlashes(RteUtils::ExtractFileName(file->GetName()));
-                  if(fileName.empty()) {
+              bFoundSystemH = FindFileFromList(systemHeader, targFiles);
+              if(!bFoundSystemH) {
+                string incPathsMsg;
+                int    incPathsCnt = 0;
+                for(auto& incPath : incPaths) {
+                  systemHeader = RteUtils::BackSlashesToSlashes(incPath);
+                  if(ExcludeSysHeaderDirectories(systemHeader, rteProject->GetRteFolder())) {
                     continue;
                   }
-                  const string& attribute = file->GetAttribute("attr");
-
-                  if(attribute == "config" && FileIsHeader(fileName)) {
-                    const string& fullFileName = targetPath + "/" + file->GetName();
-                    const string hPath = RteUtils::ExtractFilePath(fullFileName, false);
-                    const auto incPathFound = incPaths.find(hPath);
-                    if(incPathFound != incPaths.end()) {
-                      LogMsg("M357", NAME(file->GetName()), file->GetLineNumber());
-                    }
-                  }
 
-                  if(FindName(fileName, "system_", ".c")) {
-                    foundSystemC++;
-                    lineSystem = file->GetLineNumber();
-                    if(attribute != "config") {
-                      LogMsg("M377", NAME(fileName), TYP(category), lineNo);
-                    }
+                  incPathsMsg += "\n  ";
+                  incPathsMsg += to_string((unsigned long long) ++incPathsCnt);
+                  incPathsMsg += ": ";
+                  incPathsMsg += systemHeader;
 
-                    string systemHeader = RteUtils::ExtractFileBaseName(fileName);
-                    systemHeader += ".h";
-
-                    bFoundSystemH = FindFileFromList(systemHeader, targFiles);
-                    if(!bFoundSystemH) {
-                      string incPathsMsg;
-                      int    incPathsCnt = 0;
-                      for(auto& incPath : incPaths) {
-                        systemHeader = RteUtils::BackSlashesToSlashes(incPath);
-                        if(ExcludeSysHeaderDirectories(systemHeader, rteProject->GetRteFolder())) {
-                          continue;
-                        }
-
-                        incPathsMsg += "\n  ";
-                        incPathsMsg += to_string((unsigned long long) ++incPathsCnt);
-                        incPathsMsg += ": ";
-                        incPathsMsg += systemHeader;
-
-                        systemHeader += "/";
-                        systemHeader += RteUtils::ExtractFileBaseName(fileName);
-                        systemHeader += ".h";
-
-                        string sysHeader = RteUtils::ExtractFileName(systemHeader);
-                        for (auto f : targFiles) {
-                          if(RteUtils::ExtractFileName(f->GetName()) == sysHeader) {
-                            systemHeader = f->GetOriginalAbsolutePath();
-                            break;
-                          }
-                        }
-
-                        if(RteFsUtils::Exists(systemHeader)) {
-                          bFoundSystemH = true;
-                        }
-                      }
-
-                      if(!bFoundSystemH) {
-                        systemHeader  = RteUtils::ExtractFileBaseName(fileName);
-                        systemHeader += ".h";
-                        if(incPathsMsg.empty()) {
-                          incPathsMsg  = "\n  ";
-                          incPathsMsg += to_string((unsigned long long) ++incPathsCnt);
-                          incPathsMsg += ": ";
-                          incPathsMsg += "<not found any include path>";
-                        }
-                        LogMsg("M358", VAL("HFILE", RteUtils::ExtractFileName(systemHeader)), VAL("CFILE", fileName), COMP("Startup"), VAL("COMPID", compId),
-                               VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), PATH(incPathsMsg), lineNo);
-                        bOk = false;
-                      }
+                  systemHeader += "/";
+                  systemHeader += RteUtils::ExtractFileBaseName(fileName);
+                  systemHeader += ".h";
+
+                  string sysHeader = RteUtils::ExtractFileName(systemHeader);
+                  for (auto f : targFiles) {
+                    if(RteUtils::ExtractFileName(f->GetName()) == sysHeader) {
+                      systemHeader = f->GetOriginalAbsolutePath();
+                      break;
                     }
                   }
 
-                  if(fileName.find("startup_", 0) != string::npos) {
-                    foundStartup++;
-                    lineStartup = file->GetLineNumber();
-
-                    if(attribute != "config") {
-                      LogMsg("M377", NAME(fileName), TYP(category), lineNo);
-                    }
+                  if(PackFileSystem::Exists(systemHeader)) {
+                    bFoundSystemH = true;
                   }
                 }
 
-                if(category == "header") {
-                  string fileName = RteUtils::BackSlashesToSlashes(RteUtils::ExtractFileName(file->GetName()));
-                  if(fileName.empty()) {
-                    continue;
-                  }
-                  const string& attribute = file->GetAttribute("attr");
-
-                  if(attribute == "config") {
-                    const string& fullFileName = targetPath + "/" + file->GetName();
-                    const string hPath = RteUtils::ExtractFilePath(fullFileName, false);
-                    const auto incPathFound = incPaths.find(hPath);
-                    if(incPathFound != incPaths.end()) {
-                      LogMsg("M357", NAME(file->GetName()), file->GetLineNumber());
-                    }
+                if(!bFoundSystemH) {
+                  systemHeader  = RteUtils::ExtractFileBaseName(fileName);
+                  systemHeader += ".h";
+                  if(incPathsMsg.empty()) {
+                    incPathsMsg  = "\n  ";
+                    incPathsMsg += to_string((unsigned long long) ++incPathsCnt);
+                    incPathsMsg += ": ";
+                    incPathsMsg += "<not found any include path>";
                   }
+                  LogMsg("M358", VAL("HFILE", RteUtils::ExtractFileName(systemHeader)), VAL("CFILE", fileName), COMP("Startup"), VAL("COMPID", compId),
+                         VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), PATH(incPathsMsg), lineNo);
+                  bOk = false;
                 }
               }
             }
 
-            if(foundSystemC != 1 || foundStartup != 1) {    // ignore if generator="..."
-              if(HasExternalGenerator(aggregate)) {
-                continue;
+            if(fileName.find("startup_", 0) != string::npos) {
+              foundStartup++;
+              lineStartup = file->GetLineNumber();
+
+              if(attribute != "config") {
+                LogMsg("M377", NAME(fileName), TYP(category), lineNo);
               }
             }
+          }
 
-            if(foundSystemC != 1) {
-              LogMsg(foundSystemC ? "M354" : "M353",
-                     VAL("FILECAT", "system_*"), COMP("Startup"), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions),
-                     foundSystemC ? lineSystem : lineNo);
-              bOk = false;
+          if(category == "header") {
+            string fileName = RteUtils::BackSlashesToSlashes(RteUtils::ExtractFileName(file->GetName()));
+            if(fileName.empty()) {
+              continue;
             }
-
-            if(foundStartup != 1) {
-              LogMsg(foundStartup ? "M354" : "M353",
-                     VAL("FILECAT", "startup_*"), COMP("Startup"), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions),
-                     foundStartup ? lineStartup : lineNo);
-              bOk = false;
+            const string& attribute = file->GetAttribute("attr");
+
+            if(attribute == "config") {
+              const string& fullFileName = targetPath + "/" + file->GetName();
+              const string hPath = RteUtils::ExtractFilePath(fullFileName, false);
+              const auto incPathFound = incPaths.find(hPath);
+              if(incPathFound != incPaths.end()) {
+                LogMsg("M357", NAME(file->GetName()), file->GetLineNumber());
+              }
             }
           }
         }
+      }
 
+      if(foundSystemC != 1 || foundStartup != 1) {    // ignore if generator="..."
+        if(HasExternalGenerator(aggregate)) {
+          continue;
+        }
+      }
+
+      if(foundSystemC != 1) {
+        LogMsg(foundSystemC ? "M354" : "M353",
+               VAL("FILECAT", "system_*"), COMP("Startup"), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions),
+               foundSystemC ? lineSystem : lineNo);
+        bOk = false;
+      }
+
+      if(foundStartup != 1) {
+        LogMsg(foundStartup ? "M354" : "M353",
+               VAL("FILECAT", "startup_*"), COMP("Startup"), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions),
+               foundStartup ? lineStartup : lineNo);
+        bOk = false;
+      }
+    }
+  }
+
+  check.bOk = bOk;
+  return bOk;
+}
+
+/**
+ * @brief Check device dependencies. Tests if all dependencies are solved and a minimum
+ *        on support files and configuration has been defined. Prints the results of
+ *        the combinations checked by RunDeviceDependencyChecks() in their original order.
+ * @param device RteDeviceItem to run on
+ * @param check iterator to the first combination of the device, moved past the last one
+ * @return passed / failed
+ */
+bool ValidateSemantic::CheckDeviceDependencies(RteDeviceItem *device, vector<DeviceDependencyCheck>::const_iterator& check)
+{
+  if(!device) {
+    return false;
+  }
+
+  const string& mcuName = device->GetName();
+  const string& mcuVendor = device->GetEffectiveAttribute("Dvendor");
+  int lineNo = device->GetLineNumber();
+
+  CheckForUnsupportedChars(mcuName, "Dname", lineNo);
+
+  bool bOk = true;
+  for(auto &[processorName, processor] : device->GetProcessors()) {
+    lineNo = processor->GetLineNumber();
+
+    CheckDeviceDescription(device, processor);
+
+    const size_t trustZoneCount = GetTrustZoneModes(processor).size();
+    for(size_t tz = 0; tz < trustZoneCount; tz++) {
+      for(auto &[compilerKey, compiler] : m_compilers) {
+        const DeviceDependencyCheck& result = *check++;
+        if(!result.bStartupFound) {
+          LogMsg("M350", COMP("Startup"), VENDOR(mcuVendor), MCU(result.mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
+          continue;  // error: no startup component found
+        }
+
+        // messages of the startup components, printed as if checked sequentially
+        result.capture->Replay();
+        ErrLog::Get()->SetFileName(result.fileName);
+        if(!result.bOk) {
+          bOk = false;
+        }
       }
-      filter.RemoveAttribute("Tcompiler");
 
       if(bOk) {
         LogMsg("M010");
@@ -844,24 +963,31 @@ bool ValidateSemantic::HasExternalGenerator(RteComponentAggregate* aggregate)
  */
 bool ValidateSemantic::TestMcuDependencies(RtePackage* pKg)
 {
-  RteGlobalModel& model = GetModel();
-  RteProject* rteProject = model.AddProject(1);
-  if(!rteProject || !pKg) {
+  if(!pKg) {
     return false;
   }
 
-  model.GetLatestPackage("ARM.CMSIS");
+  GetModel().GetLatestPackage("ARM.CMSIS");
 
   list<RteDeviceItem*> devices;
   pKg->GetEffectiveDeviceItems(devices);
+
+  // filtering components is the expensive part: run all combinations of all devices in parallel first
+  vector<DeviceDependencyCheck> checks;
+  for(auto device : devices) {
+    AddDeviceDependencyChecks(device, checks);
+  }
+  if(!RunDeviceDependencyChecks(checks)) {
+    return false;
+  }
+
+  vector<DeviceDependencyCheck>::const_iterator check = checks.begin();
   for(auto device : devices) {
-    CheckDeviceDependencies(device, rteProject);
+    CheckDeviceDependencies(device, check);
     CheckMemories(device);
     CheckDeviceAttributes(device);
   }
 
-  model.DeleteProject(1);
-
   return true;
 }
 
@@ -8,6 +8,7 @@
 #include "PackChk.h"
 #include "ErrLog.h"
 
+#include <algorithm>
 #include <fstream>
 
 using namespace std;
@@ -184,6 +185,89 @@ TEST_F(PackChkIntegTests, CheckComponentDependency) {
   }
 }
 
+// Validate that reading PDSC files in parallel reports the same messages
+TEST_F(PackChkIntegTests, CheckParallelJobs) {
+  const char* argv[9];
+
+  const string& pdscFile = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTest/0.1.0/ARM.RteTest.pdsc";
+  const string& refFile1 = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTest_DFP/0.1.1/ARM.RteTest_DFP.pdsc";
+  const string& refFile2 = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTestRequired/1.0.0/ARM.RteTestRequired.pdsc";
+  ASSERT_TRUE(RteFsUtils::Exists(pdscFile));
+  ASSERT_TRUE(RteFsUtils::Exists(refFile1));
+  ASSERT_TRUE(RteFsUtils::Exists(refFile2));
+
+  argv[0] = (char*)"";
+  argv[1] = (char*)pdscFile.c_str();
+  argv[2] = (char*)"-i";
+  argv[3] = (char*)refFile1.c_str();
+  argv[4] = (char*)"-i";
+  argv[5] = (char*)refFile2.c_str();
+  argv[6] = (char*)"--disable-validation";
+  argv[7] = (char*)"-j";
+
+  auto getMessages = [&](const char* jobs, int& result) {
+    argv[8] = (char*)jobs;
+    PackChk packChk;
+    result = packChk.Check(9, argv, nullptr);
+    list<string> msgs;
+    for (const string& msg : ErrLog::Get()->GetLogMessages()) {
+      // skip timing information
+      if (msg.find("M072") == string::npos && msg.find("M075") == string::npos && msg.find("M076") == string::npos && msg.find("M077") == string::npos) {
+        msgs.push_back(msg);
+      }
+    }
+    ErrLog::Get()->Destroy();
+    return msgs;
+  };
+
+  int serialResult = -1, parallelResult = -1;
+  const list<string> serialMsgs = getMessages("1", serialResult);
+  const list<string> parallelMsgs = getMessages("4", parallelResult);
+  EXPECT_EQ(serialResult, parallelResult);
+  EXPECT_FALSE(serialMsgs.empty());
+  EXPECT_EQ(serialMsgs, parallelMsgs);
+}
+
+// Validate that checking device dependencies in parallel reports the same messages in the same order
+TEST_F(PackChkIntegTests, CheckParallelDeviceDependencies) {
+  const char* argv[5];
+
+  const string& pdscFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/ProcessorFeatures/TestVendor.ProcessorFeatures.pdsc";
+  ASSERT_TRUE(RteFsUtils::Exists(pdscFile));
+
+  argv[0] = (char*)"";
+  argv[1] = (char*)pdscFile.c_str();
+  argv[2] = (char*)"--disable-validation";
+  argv[3] = (char*)"-j";
+
+  auto getMessages = [&](const char* jobs, int& result) {
+    argv[4] = (char*)jobs;
+    PackChk packChk;
+    result = packChk.Check(5, argv, nullptr);
+    list<string> msgs;
+    for (const string& msg : ErrLog::Get()->GetLogMessages()) {
+      // skip timing information
+      if (msg.find("M072") == string::npos && msg.find("M075") == string::npos && msg.find("M076") == string::npos && msg.find("M077") == string::npos) {
+        msgs.push_back(msg);
+      }
+    }
+    ErrLog::Get()->Destroy();
+    return msgs;
+  };
+
+  int serialResult = -1, parallelResult = -1;
+  const list<string> serialMsgs = getMessages("1", serialResult);
+  const list<string> parallelMsgs = getMessages("4", parallelResult);
+  EXPECT_EQ(serialResult, parallelResult);
+  EXPECT_TRUE(find_if(serialMsgs.begin(), serialMsgs.end(),
+    [](const string& msg) { return msg.find("M358") != string::npos; }) != serialMsgs.end());
+  EXPECT_EQ(serialMsgs, parallelMsgs);
+}
+
 // Check generation of pack file name
 TEST_F(PackChkIntegTests, WritePackFileName) {
   const char* argv[4];
@@ -451,6 +535,74 @@ TEST_F(PackChkIntegTests, CheckPackLicense) {
   }
 }
 
+// Validate that a pack archive is checked without extracting it and reports the same messages as its content
+TEST_F(PackChkIntegTests, CheckPackArchive) {
+  const char* argv[3];
+
+  const string& packDir = PackChkIntegTestEnv::localtestdata_dir + "/TestLicense";
+  const string& packFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/PackArchive/TestVendor.TestPackLicense.0.0.1.pack";
+  ASSERT_TRUE(RteFsUtils::Exists(packDir));
+  ASSERT_TRUE(RteFsUtils::Exists(packFile));
+
+  argv[0] = (char*)"";
+  argv[2] = (char*)"--disable-validation";
+
+  auto getMessages = [&](const string& inputFile, const string& root, int& result) {
+    argv[1] = (char*)inputFile.c_str();
+    PackChk packChk;
+    result = packChk.Check(3, argv, nullptr);
+    list<string> msgs;
+    for (string msg : ErrLog::Get()->GetLogMessages()) {
+      // skip timing information
+      if (msg.find("M072") == string::npos && msg.find("M075") == string::npos && msg.find("M076") == string::npos && msg.find("M077") == string::npos) {
+        RteUtils::ReplaceAll(msg, root, "<root>");
+        msgs.push_back(msg);
+      }
+    }
+    ErrLog::Get()->Destroy();
+    return msgs;
+  };
+
+  int dirResult = -1, archiveResult = -1;
+  const list<string> dirMsgs = getMessages(packDir + "/TestVendor.TestPackLicense.pdsc", packDir, dirResult);
+  const list<string> archiveMsgs = getMessages(packFile, packFile, archiveResult);
+  EXPECT_EQ(1, archiveResult);
+  EXPECT_EQ(dirResult, archiveResult);
+  EXPECT_FALSE(archiveMsgs.empty());
+  EXPECT_EQ(dirMsgs, archiveMsgs);
+}
+
+// Validate that an invalid pack archive is reported
+TEST_F(PackChkIntegTests, CheckPackArchive_Invalid) {
+  const char* argv[3];
+
+  // GIVEN a pack archive that is not a ZIP archive
+  const string& pdscFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/TestLicense/TestVendor.TestPackLicense.pdsc";
+  const string& invalidPackFile = PackChkIntegTestEnv::testoutput_dir + "/Invalid.pack";
+  ASSERT_TRUE(RteFsUtils::CopyCheckFile(pdscFile, invalidPackFile, false));
+
+  argv[0] = (char*)"";
+  argv[1] = (char*)invalidPackFile.c_str();
+  argv[2] = (char*)"--disable-validation";
+
+  PackChk packChk;
+  EXPECT_EQ(1, packChk.Check(3, argv, nullptr));
+
+  auto errMsgs = ErrLog::Get()->GetLogMessages();
+  int M220_foundCnt = 0;
+  for (const string& msg : errMsgs) {
+    if (msg.find("M220") != string::npos) {
+      M220_foundCnt++;
+    }
+  }
+
+  if (M220_foundCnt != 1) {
+    FAIL() << "error: missing error M220";
+  }
+}
+
 // Validate CPU feature SON
 TEST_F(PackChkIntegTests, CheckFeatureSON) {
   const char* argv[3];
@@ -942,6 +1094,54 @@ TEST_F(PackChkIntegTests, CheckSchemaValidation) {
   }
 }
 
+// Validate that schema and parser messages of a file are reported in phase 1 ordered by line
+TEST_F(PackChkIntegTests, CheckSchemaMessageOrder) {
+  const char* argv[2];
+
+  const string& pdscFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/SchemaMessageOrder/TestVendor.SchemaMessageOrder.pdsc";
+  ASSERT_TRUE(RteFsUtils::Exists(pdscFile));
+
+  argv[0] = (char*)"";
+  argv[1] = (char*)pdscFile.c_str();
+
+  PackChk packChk;
+  EXPECT_EQ(1, packChk.Check(2, argv, nullptr));
+
+  // messages are logged in parts: "*** ERROR Mxxx:", file name, " (Line n) ", text
+  string msgId;
+  int lastLine = 0;
+  int M511_foundCnt = 0;
+  int M417_foundCnt = 0;
+  for (const string& msg : ErrLog::Get()->GetLogMessages()) {
+    if (msg.find("Phase2") != string::npos) {
+      break;
+    }
+    if (msg.find("*** ") != string::npos) {
+      msgId = msg;
+      continue;
+    }
+    const size_t pos = msg.find("(Line ");
+    if (pos == string::npos) {
+      continue;
+    }
+    const int line = stoi(msg.substr(pos + 6));
+    EXPECT_LE(lastLine, line) << msgId << msg;
+    lastLine = line;
+
+    if (msgId.find("M511") != string::npos) {
+      M511_foundCnt++;
+    }
+    else if (msgId.find("M417") != string::npos) {
+      EXPECT_LT(0, M511_foundCnt) << "schema error in line 6 must precede parser error in line 12";
+      M417_foundCnt++;
+    }
+  }
+
+  EXPECT_LT(0, M511_foundCnt);
+  EXPECT_EQ(1, M417_foundCnt);
+}
+
 // Validate mounted and compatible board devices
 TEST_F(PackChkIntegTests, CheckBoardMountedCompatibleDevices) {
   const char* argv[5];
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "CheckFiles.h"
+#include "PackChk.h"
+#include "PackFileSystem.h"
+
+#include "AlnumCmp.h"
+#include "ErrLog.h"
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// synthetic pack: a DFP like tree of directories with many files each, referenced as written in a PDSC
+static const int DIRECTORY_COUNT = 20;
+
+static const string& GetPackPath()
+{
+  static const string packPath = RteFsUtils::AbsolutePath(string(BUILD_FOLDER) + "benchmark/SyntheticPack").generic_string();
+  return packPath;
+}
+
+static const vector<string>& CreateSyntheticPack(int filesPerDirectory)
+{
+  static int createdFilesPerDirectory = 0;
+  static vector<string> fileNames;
+  if(createdFilesPerDirectory == filesPerDirectory) {
+    return fileNames;
+  }
+
+  const string& packPath = GetPackPath();
+  RteFsUtils::RemoveDir(packPath);
+  fileNames.clear();
+  for(int d = 0; d < DIRECTORY_COUNT; d++) {
+    const string dir = "Device/Family" + to_string(d) + "/Source";
+    RteFsUtils::CreateDirectories(packPath + "/" + dir);
+    for(int f = 0; f < filesPerDirectory; f++) {
+      const string fileName = dir + "/Peripheral" + to_string(f) + "_Driver.c";
+      RteFsUtils::CreateTextFile(packPath + "/" + fileName, "");
+      fileNames.push_back(fileName);
+    }
+  }
+  createdFilesPerDirectory = filesPerDirectory;
+  return fileNames;
+}
+
+// implementation before the directory index: the parent directory is enumerated for every name
+static bool FindExactNameDirectoryIterator(const string& dir, const string& name, string& exactName)
+{
+  error_code ec;
+  for(auto& item : fs::directory_iterator(dir, ec)) {
+    const string fsName = item.path().filename().generic_string();
+    if(!AlnumCmp::CompareLen(name, fsName, false)) {
+      exactName = fsName;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void BM_FindExactNameDirectoryIterator(benchmark::State& state)
+{
+  const vector<string>& fileNames = CreateSyntheticPack((int)state.range(0));
+  const string& packPath = GetPackPath();
+  string exactName;
+  for(auto _ : state) {
+    for(const string& fileName : fileNames) {
+      const string path = packPath + "/" + fileName;
+      benchmark::DoNotOptimize(FindExactNameDirectoryIterator(RteUtils::ExtractFilePath(path, false),
+        RteUtils::ExtractFileName(path), exactName));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * fileNames.size());
+}
+BENCHMARK(BM_FindExactNameDirectoryIterator)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+static void BM_FindExactName(benchmark::State& state)
+{
+  const vector<string>& fileNames = CreateSyntheticPack((int)state.range(0));
+  const string& packPath = GetPackPath();
+  string exactName;
+  for(auto _ : state) {
+    PackFileSystem::ClearCache();   // every directory is enumerated once per iteration
+    for(const string& fileName : fileNames) {
+      const string path = packPath + "/" + fileName;
+      benchmark::DoNotOptimize(PackFileSystem::FindExactName(RteUtils::ExtractFilePath(path, false),
+        RteUtils::ExtractFileName(path), exactName));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * fileNames.size());
+}
+BENCHMARK(BM_FindExactName)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+// file checks of CheckFilesVisitor for every referenced file
+static void BM_CheckFiles(benchmark::State& state)
+{
+  const vector<string>& fileNames = CreateSyntheticPack((int)state.range(0));
+  PackChk packChk;    // initializes the message table
+  CheckFiles checkFiles;
+  checkFiles.SetPackagePath(GetPackPath());
+  for(auto _ : state) {
+    PackFileSystem::ClearCache();
+    for(const string& fileName : fileNames) {
+      benchmark::DoNotOptimize(checkFiles.CheckFileExists(fileName, 1));
+      benchmark::DoNotOptimize(checkFiles.CheckCaseSense(fileName, 1));
+      benchmark::DoNotOptimize(checkFiles.CheckFileIsInPack(fileName, 1));
+    }
+    ErrLog::Get()->ClearLogMessages();
+  }
+  state.SetItemsProcessed(state.iterations() * fileNames.size());
+}
+BENCHMARK(BM_CheckFiles)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+// end of CheckFilesBenchmark.cpp
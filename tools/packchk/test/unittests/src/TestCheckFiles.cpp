@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -8,6 +8,7 @@
 
 #include "PackChk.h"
 #include "CheckFiles.h"
+#include "PackFileSystem.h"
 #include "RteFsUtils.h"
 #include "ErrLog.h"
 
@@ -191,6 +192,28 @@ TEST_F(TestCheckFiles, CheckCaseSense)
 }
 
 
+TEST_F(TestCheckFiles, FindGetExactFileSystemName)
+{
+  // GIVEN a directory with a file
+  const string testDataFolder = checkFiles.GetPackagePath() + "/testdata";
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(testDataFolder + "/Exclusive.h", RteUtils::EMPTY_STRING));
+
+  // WHEN searching names differing in case THEN the name on the file system is returned from the directory index
+  string exactName;
+  EXPECT_TRUE(checkFiles.FindGetExactFileSystemName(testDataFolder, "exclusive.H", exactName));
+  EXPECT_EQ("Exclusive.h", exactName);
+  EXPECT_TRUE(checkFiles.CheckFileExists("testdata/Exclusive.h", 1));
+  EXPECT_FALSE(checkFiles.FindGetExactFileSystemName(testDataFolder, "NonExclusive.h", exactName));
+
+  // WHEN a file is added to the indexed directory THEN it is found as well
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(testDataFolder + "/NonExclusive.h", RteUtils::EMPTY_STRING));
+  EXPECT_TRUE(checkFiles.FindGetExactFileSystemName(testDataFolder, "nonexclusive.h", exactName));
+  EXPECT_EQ("NonExclusive.h", exactName);
+  EXPECT_TRUE(checkFiles.CheckFileExists("testdata/NonExclusive.h", 1));
+
+  PackFileSystem::ClearCache();
+}
+
 TEST_F(TestCheckFiles, CheckForSpaces)
 {
   map<string, bool> testInputs = {
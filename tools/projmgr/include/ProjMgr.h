@@ -52,6 +52,8 @@ public:
 
 
 protected:
+  friend class ProjMgrServer;
+
   /**
    * @brief parse command line options
    * @param argc command line argument count
@@ -66,6 +68,13 @@ protected:
   */
   int ProcessCommands();
 
+  /**
+   * @brief initialize model and process requested commands
+   * @param envVars environment variables
+   * @return program exit code as an integer, 0 for success
+  */
+  int RunCommands(const std::vector<std::string>& envVars);
+
   /**
    * @brief print usage
    * @param cmdOptionsDict map of command and options
@@ -157,6 +166,7 @@ protected:
   bool m_frozenPacks;
   bool m_cbuildgen;
   bool m_updateIdx;
+  bool m_parallelContexts;
   GroupNode m_files;
   std::vector<ContextItem*> m_processedContexts;
   std::vector<ContextItem*> m_allContexts;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,9 @@
 
 #include "RteCallback.h"
 
+#include <list>
+#include <string>
+
 /**
  * @brief extension to RTE Callback
 */
@@ -29,7 +32,7 @@ public:
    * @return list of all error messages
   */
   const std::list<std::string>& GetErrorMessages() const {
-    return m_errorMessages;
+    return theThreadMessages ? theThreadMessages->errors : m_errorMessages;
   }
 
   /**
@@ -37,21 +40,21 @@ public:
  * @return list of all warning messages
 */
   const std::list<std::string>& GetWarningMessages() const {
-    return m_warningMessages;
+    return theThreadMessages ? theThreadMessages->warnings : m_warningMessages;
   }
 
   /**
    * @brief clear all error messages
   */
   void ClearErrorMessages() {
-    m_errorMessages.clear();
+    (theThreadMessages ? theThreadMessages->errors : m_errorMessages).clear();
   }
 
   /**
    * @brief clear all warning messages
   */
   void ClearWarningMessages() {
-    m_warningMessages.clear();
+    (theThreadMessages ? theThreadMessages->warnings : m_warningMessages).clear();
   }
 
   /**
@@ -79,9 +82,26 @@ public:
   */
   void Err(const std::string& id, const std::string& message, const std::string& object = RteUtils::EMPTY_STRING) override;
 
+  /**
+   * @brief error and warning messages of a thread
+  */
+  struct Messages {
+    std::list<std::string> errors;
+    std::list<std::string> warnings;
+  };
+
+  /**
+   * @brief collect messages reported in the calling thread separately, e.g. while a context is processed in parallel
+   * @param messages pointer to Messages to fill, nullptr to collect messages in this callback again
+  */
+  static void SetThreadMessages(Messages* messages) {
+    theThreadMessages = messages;
+  }
+
 protected:
   std::list<std::string> m_errorMessages;
   std::list<std::string> m_warningMessages;
+  static thread_local Messages* theThreadMessages;
 
 };
 #endif // PROJMGRCALLBACK_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,6 +10,8 @@
 #include "ProjMgrParser.h"
 #include "ProjMgrUtils.h"
 
+#include <mutex>
+
 /**
  * @brief map of used generators options
 */
@@ -81,12 +83,18 @@ public:
   const std::string& GetGlobalDescription(const std::string& generatorId);
 
   /**
-   * @brief add generator to the list of used generators of a given context
+   * @brief add generator to the list of used generators of a given context, thread-safe
    * @param generator options
    * @param contextId context identifier
   */
   void AddUsedGenerator(const GeneratorOptionsItem& options, const std::string& contextId);
 
+  /**
+   * @brief sort contexts of each used generator, e.g. after contexts are processed in parallel
+   * @param contexts vector of context identifiers in processing order
+  */
+  void SortUsedGenerators(const StrVec& contexts);
+
   /**
    * @brief get map of used generators
    * @return map of used generators
@@ -104,6 +112,7 @@ public:
 protected:
   ProjMgrParser* m_parser = nullptr;
   GeneratorContextVecMap m_usedGenerators;
+  std::mutex m_usedGeneratorsMutex;
   bool m_checkSchema;
 };
 
@@ -9,6 +9,10 @@
 
 #include "ProjMgrCallback.h"
 #include "RteKernelSlim.h"
+#include "RteFsUtils.h"
+
+#include <map>
+#include <string>
 
 /**
  * @brief extension to RTE Kernel
@@ -36,14 +40,44 @@ public:
   */
   static void Destroy();
 
+  /**
+   * @brief release kernel at the end of a run
+   *        the kernel is destroyed unless it is kept, a kept kernel clears its model and keeps the parsed packs
+  */
+  static void Release();
+
+  /**
+   * @brief keep kernel and its parsed packs when it is released, used in server mode
+   * @param keep true to keep kernel, false to destroy it on release
+  */
+  static void SetKeep(bool keep);
+
+  /**
+   * @brief initialize kernel, parsed packs whose pdsc files have changed since the previous run are discarded
+   * @return true if successful
+  */
+  bool Init() override;
+
   /**
    * @brief get callback
    * @return pointer to callback
   */
   ProjMgrCallback* GetCallback() const;
 
+protected:
+  /**
+   * @brief remember pdsc file write times of parsed packs
+  */
+  void UpdatePackTimes();
+
+  /**
+   * @brief discard parsed packs whose pdsc files have been modified or removed
+  */
+  void RemoveModifiedPacks();
+
 private:
   std::unique_ptr<ProjMgrCallback> m_callback;
+  std::map<std::string, fs::file_time_type> m_packTimes;
 };
 
 #endif /* PROJMGRKERNEL_H */
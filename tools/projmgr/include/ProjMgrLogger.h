@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,6 +7,7 @@
 #ifndef PROJMGRLOGGER_H
 #define PROJMGRLOGGER_H
 
+#include <list>
 #include <map>
 #include <string>
 #include <sstream>
@@ -141,4 +142,71 @@ protected:
 
 };
 
+/**
+ * @brief collects messages issued by the calling thread instead of printing them,
+ *        used to output messages of contexts processed in parallel in deterministic order
+*/
+class ProjMgrLoggerCapture {
+public:
+  /**
+   * @brief class constructor
+  */
+  ProjMgrLoggerCapture(void);
+
+  /**
+   * @brief class destructor, stops capturing if still active
+  */
+  ~ProjMgrLoggerCapture(void);
+
+  /**
+   * @brief start capturing messages issued by the calling thread
+  */
+  void Start();
+
+  /**
+   * @brief stop capturing messages, must be called by the thread that called Start()
+  */
+  void Stop();
+
+  /**
+   * @brief pass captured messages to the logger in the order they were issued
+  */
+  void Replay() const;
+
+  /**
+   * @brief check if any message is captured
+   * @return true if no message is captured
+  */
+  bool IsEmpty() const { return m_messages.empty(); }
+
+protected:
+  friend class ProjMgrLogger;
+
+  enum class MessageType { Error, Warn, Info, Debug };
+  struct Message {
+    MessageType type;
+    std::string msg;
+    std::string context;
+    std::string file;
+    int line;
+    int column;
+  };
+
+  /**
+   * @brief store message if the calling thread captures messages
+   * @return true if the message is captured and must not be output
+  */
+  static bool Capture(MessageType type, const std::string& msg, const std::string& context = std::string(),
+    const std::string& file = std::string(), const int line = 0, const int column = 0);
+
+  ProjMgrLoggerCapture(const ProjMgrLoggerCapture&) = delete;
+  ProjMgrLoggerCapture& operator=(const ProjMgrLoggerCapture&) = delete;
+
+  std::list<Message> m_messages;
+  ProjMgrLoggerCapture* m_prev;
+  bool m_active;
+
+  static thread_local ProjMgrLoggerCapture* theCapture;
+};
+
 #endif  // PROJMGRLOGGER_H
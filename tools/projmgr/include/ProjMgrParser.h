@@ -7,6 +7,7 @@
 #ifndef PROJMGRPARSER_H
 #define PROJMGRPARSER_H
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -617,6 +618,17 @@ public:
   */
   bool ParseCproject(const std::string& input, bool checkSchema, bool single = false);
 
+  /**
+   * @brief parse cprojects in parallel
+   *        projects are inserted and messages are output in the order of the input files,
+   *        parsing stops at the first file that fails as if the files were parsed one by one
+   * @param inputs cproject.yml files
+   * @param checkSchema false to skip schema validation
+   * @param jobs maximum number of parallel jobs, 0 for number of hardware threads
+   * @return true if all files are parsed successfully
+  */
+  bool ParseCprojects(const std::vector<std::string>& inputs, bool checkSchema, unsigned jobs);
+
   /**
    * @brief parse csolution
    * @param checkSchema false to skip schema validation
@@ -632,6 +644,19 @@ public:
   */
   bool ParseClayer(const std::string& input, bool checkSchema);
 
+  /**
+   * @brief parse clayers in parallel, already parsed files are skipped
+   *        layers are inserted and messages are output in the order of the input files,
+   *        parsing stops at the first file that fails as if the files were parsed one by one
+   * @param inputs clayer.yml files
+   * @param checkSchema false to skip schema validation
+   * @param jobs maximum number of parallel jobs, 0 for number of hardware threads
+   * @param output function called with the index of each input file before its messages are output
+   * @return true if all files are parsed successfully
+  */
+  bool ParseClayers(const std::vector<std::string>& inputs, bool checkSchema, unsigned jobs,
+    const std::function<void(size_t)>& output = nullptr);
+
   /**
    * @brief parse generic clayer files
    * @param checkSchema false to skip schema validation
@@ -639,6 +664,15 @@ public:
   */
   bool ParseGenericClayer(const std::string& input, bool checkSchema);
 
+  /**
+   * @brief parse generic clayer files in parallel, see ParseClayers
+   * @param inputs clayer.yml files
+   * @param checkSchema false to skip schema validation
+   * @param jobs maximum number of parallel jobs, 0 for number of hardware threads
+   * @return true if all files are parsed successfully
+  */
+  bool ParseGenericClayers(const std::vector<std::string>& inputs, bool checkSchema, unsigned jobs);
+
   /**
    * @brief parse cbuild set file
    * @param checkSchema false to skip schema validation
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PROJMGRSERVER_H
+#define PROJMGRSERVER_H
+
+#include <nlohmann/json.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief projmgr server serving JSON-RPC 2.0 requests
+ *
+ * Each request runs a csolution command, the method is the command name, e.g. "list components" or "convert",
+ * and the params object holds the command line options by their long names, e.g. {"solution": "my.csolution.yml",
+ * "context": ["project.Debug+Target"]}. Messages are read one per line, or with a 'Content-Length' header,
+ * responses use the framing of the request. Loaded packs and yml files are kept between requests and are
+ * reloaded when their files change. The method "shutdown" stops the server.
+*/
+class ProjMgrServer {
+public:
+  /**
+   * @brief class constructor
+   * @param envVars environment variables passed to every request
+  */
+  ProjMgrServer(const std::vector<std::string>& envVars);
+
+  /**
+   * @brief class destructor, discards loaded packs and yml files
+  */
+  ~ProjMgrServer();
+
+  /**
+   * @brief serve requests until input is closed or shutdown is requested
+   * @param in input stream to read requests from
+   * @param out output stream to write responses to
+   * @return true if shutdown is requested or input is closed, false if a message could not be read
+  */
+  bool Run(std::istream& in, std::ostream& out);
+
+  /**
+   * @brief handle a single request
+   * @param message JSON-RPC request
+   * @return JSON-RPC response, null for notifications
+  */
+  nlohmann::json HandleRequest(const std::string& message);
+
+protected:
+  bool ReadMessage(std::istream& in, std::string& message, bool& contentLength);
+  void WriteMessage(std::ostream& out, const std::string& message, bool contentLength);
+  bool GetArguments(const std::string& method, const nlohmann::json& params, std::vector<std::string>& args, std::string& error);
+  nlohmann::json RunCommand(const std::vector<std::string>& args);
+
+  std::vector<std::string> m_envVars;
+  bool m_shutdown;
+};
+
+#endif  // PROJMGRSERVER_H
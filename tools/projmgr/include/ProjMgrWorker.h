@@ -12,6 +12,8 @@
 #include "ProjMgrParser.h"
 #include "ProjMgrUtils.h"
 
+#include <functional>
+
 /**
  * Forward declarations
 */
@@ -429,6 +431,18 @@ public:
   */
   bool ProcessContext(ContextItem& context, bool loadGenFiles = true, bool resolveDependencies = true, bool updateRteFiles = true);
 
+  /**
+   * @brief process contexts, in parallel if enabled and more than one job is available
+   * @param contexts vector of pointers to contexts in yml order
+   * @param loadGenFiles boolean automatically load generated files
+   * @param resolveDependencies boolean automatically resolve dependencies
+   * @param updateRteFiles boolean update RTE files
+   * @param parallel boolean process contexts in parallel using the number of jobs set by SetJobs()
+   * @param processed function called for each context in yml order after its messages are output: processed(context, success)
+  */
+  void ProcessContexts(const std::vector<ContextItem*>& contexts, bool loadGenFiles, bool resolveDependencies,
+    bool updateRteFiles, bool parallel, const std::function<void(ContextItem&, bool)>& processed);
+
   /**
    * @brief list available packs
    * @param reference to list of packs
@@ -609,6 +623,24 @@ public:
   */
   void SetLoadPacksPolicy(const LoadPacksPolicy& policy);
 
+  /**
+   * @brief set number of parallel jobs for loading packs, parsing cproject and clayer files and processing contexts
+   * @param jobs number of jobs, 0 for number of hardware threads
+  */
+  void SetJobs(unsigned jobs);
+
+  /**
+   * @brief get number of parallel jobs
+   * @return number of jobs, 0 for number of hardware threads
+  */
+  unsigned GetJobs(void) const { return m_jobs; }
+
+  /**
+   * @brief set flag to use cached pack descriptions
+   * @param bUse true to use the pack cache
+  */
+  void SetUsePackCache(bool bUse);
+
   /**
    * @brief set vector of environment variables
    * @param reference to vector of environment variables
@@ -694,6 +726,12 @@ public:
   */
   std::string GetPackRoot(void);
 
+  /**
+   * @brief get directory to cache parsed pack descriptions
+   * @return string $CMSIS_PACK_CACHE_DIR, empty string to use the default $CMSIS_PACK_ROOT/.Local/.cache
+  */
+  std::string GetPackCacheDir(void);
+
   /**
    * @brief retrieve all context types, including mapped ones
   */
@@ -817,6 +855,8 @@ protected:
   std::string m_selectedToolchain;
   std::string m_rootDir;
   LoadPacksPolicy m_loadPacksPolicy;
+  unsigned m_jobs;
+  bool m_usePackCache;
   ContextTypesItem m_types;
   bool m_checkSchema;
   bool m_verbose;
@@ -832,8 +872,14 @@ protected:
   StrVec m_selectableCompilers;
   bool m_undefCompiler = false;
   std::map<std::string, FileNode> m_missingFiles;
+  static thread_local std::vector<std::function<void()>>* theDeferredUpdates; // solution data updates of a context processed in parallel
 
   bool LoadPacks(ContextItem& context);
+  bool InitializeContextTarget(ContextItem& context);
+  bool FilterContextPacks(ContextItem& context);
+  bool ProcessContextComponents(ContextItem& context);
+  bool CompleteContext(ContextItem& context, bool resolveDependencies);
+  void UpdateSolutionData(const std::function<void()>& update);
   bool CheckMissingPackRequirements(const std::string& contextName);
   void CheckMissingLinkerScript(ContextItem& context);
   bool CollectRequiredPdscFiles(ContextItem& context, const std::string& packRoot);
@@ -854,7 +900,7 @@ protected:
   bool ProcessToolchain(ContextItem& context);
   bool ProcessPackages(ContextItem& context, const std::string& packRoot);
   bool ProcessComponents(ContextItem& context);
-  RteComponent* ProcessComponent(ContextItem& context, ComponentItem& item, RteComponentMap& componentMap, std::string& hint);
+  RteComponent* ProcessComponent(ContextItem& context, ComponentItem& item, const RteComponentIndex& componentIndex, std::string& hint);
   bool ProcessGpdsc(ContextItem& context);
   bool ProcessConfigFiles(ContextItem& context);
   bool ProcessComponentFiles(ContextItem& context);
@@ -899,9 +945,12 @@ protected:
   void GetActiveConnectMap(const ConnectionsCollectionVec& collection, ActiveConnectMap& activeConnectMap);
   void SetActiveConnect(const ConnectItem* activeConnect, const ConnectionsCollectionVec& collection, ActiveConnectMap& activeConnectMap);
   ConnectionsCollectionMap ClassifyConnections(const ConnectionsCollectionVec& connections, BoolMap optionalTypeFlags);
-  ConnectionsValidationResult ValidateConnections(ConnectionsCollectionVec combination);
-  void GetAllCombinations(const ConnectionsCollectionMap& src, const ConnectionsCollectionMap::iterator& it,
-    std::vector<ConnectionsCollectionVec>& combinations, const ConnectionsCollectionVec& previous = ConnectionsCollectionVec());
+  ConnectionsValidationResult ValidateConnections(const ConnectionsCollectionVec& combination);
+  bool VisitCombinations(const ConnectionsCollectionMap& src, const std::function<bool(const ConnectionsCollectionVec&)>& visit, bool prune = true);
+  bool VisitCombinations(ConnectionsCollectionMap::const_iterator it, ConnectionsCollectionMap::const_iterator end,
+    std::vector<StrSet>::const_iterator laterProvides, ConnectionsCollectionVec& combination,
+    const std::function<bool(const ConnectionsCollectionVec&)>& visit, bool prune);
+  bool IsFeasibleCombination(const ConnectionsCollectionVec& combination, const StrSet& laterProvides);
   void GetAllSelectCombinations(const ConnectPtrMap& src, const ConnectPtrMap::iterator& it,
     std::vector<ConnectPtrVec>& combinations, const ConnectPtrVec& previous = ConnectPtrVec());
   void PushBackUniquely(ConnectionsCollectionVec& vec, const ConnectionsCollection& value);
@@ -924,6 +973,8 @@ protected:
   bool GetGeneratorOptions(ContextItem& context, const std::string& layer, GeneratorOptionsItem& options);
   bool GetExtGeneratorOptions(ContextItem& context, const std::string& layer, GeneratorOptionsItem& options);
   bool ParseContextLayers(ContextItem& context);
+  bool ParseContextLayers(const std::vector<ContextItem*>& contexts);
+  void GetContextLayerFiles(ContextItem& context, StrVec& clayerFiles);
   bool AddPackRequirements(ContextItem& context, const std::vector<PackItem>& packRequirements);
   void InsertPackRequirements(const std::vector<PackItem>& src, std::vector<PackItem>& dst, std::string base);
   void CheckTypeFilterSpelling(const TypeFilter& typeFilter);
@@ -110,7 +110,8 @@ protected:
   bool m_checkSchema;
 
   bool WriteFile(YAML::Node& rootNode, const std::string& filename, const std::string& context = std::string(), bool allowUpdate = true);
-  bool CompareFile(const std::string& filename, const YAML::Node& rootNode);
+  bool CompareFile(const std::string& filename, const std::string& content);
+  bool WriteFileAtomically(const std::string& filename, const std::string& content);
   bool CompareNodes(const YAML::Node& lhs, const YAML::Node& rhs);
   bool NeedRebuild(const std::string& filename, const YAML::Node& rootNode);
 };
@@ -271,6 +271,12 @@ public:
   */
   bool ParseCbuildSet(const std::string& input, CbuildSetItem& cbuildSet, bool checkSchema);
 
+  /**
+   * @brief enable cache of loaded yml files, a cached file is loaded again when its write time changes
+   * @param enable true to enable cache, false to disable it and drop cached files
+  */
+  static void EnableCache(bool enable);
+
 
 protected:
   bool ParseCbuildPack(const std::string& input, CbuildPackItem& cbuildPack, bool checkSchema);
@@ -309,6 +315,7 @@ protected:
   bool ParseLinker(const YAML::Node& parent, const std::string& file, std::vector<LinkerItem>& linker);
   void ParseRte(const YAML::Node& parent, std::string& rteBaseDir);
   bool GetTypes(const std::string& type, std::string& buildType, std::string& targetType, std::string& pattern);
+  bool LoadYamlFile(const std::string& input, bool checkSchema, YAML::Node& root);
   bool ValidateCdefault(const std::string& input, const YAML::Node& root);
   bool ValidateCsolution(const std::string& input, const YAML::Node& root);
   bool ValidateCproject(const std::string& input, const YAML::Node& root);
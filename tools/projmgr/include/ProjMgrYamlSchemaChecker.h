@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -22,12 +22,38 @@ public:
   */
   bool Validate(const std::string& file) override;
 
+  /**
+   * @brief Validates a file against schema obtained by FindSchema() method and provides the loaded data
+   * @param fileName file to validate
+   * @param root YAML data loaded from the file, the file is read and parsed only once
+   * @return true if successful
+  */
+  bool Validate(const std::string& file, YAML::Node& root);
+
+  /**
+   * @brief Validates file content held in memory against schema obtained by FindSchema() method
+   * @param fileName file the content belongs to
+   * @param content YAML content, validated without reading the file again
+   * @return true if successful
+  */
+  bool ValidateContent(const std::string& file, const std::string& content);
+
    /**
    * @brief Finds schema for given file to validate
    * @param fileName file to validate
    * @return schema file name if found, empty string otherwise
   */
   std::string FindSchema(const std::string& file) const override;
+
+protected:
+  /**
+   * @brief Validates YAML data against schema obtained by FindSchema() method
+   * @param fileName file the data belongs to
+   * @param root YAML data, loaded from the file if not yet loaded
+   * @param loaded true if root holds already loaded data, false to read the file
+   * @return true if successful
+  */
+  bool ValidateNode(const std::string& file, YAML::Node& root, bool loaded);
 };
 
 #endif  // PROJMGRYAMLSCHEMACHECKER_H
@@ -7,14 +7,17 @@
 #include "ProjMgr.h"
 #include "ProjMgrParser.h"
 #include "ProjMgrLogger.h"
+#include "ProjMgrServer.h"
 #include "ProjMgrUtils.h"
 #include "ProductInfo.h"
+#include "RteCondition.h"
 #include "RteFsUtils.h"
 
 #include "CrossPlatformUtils.h"
 
 #include <algorithm>
 #include <functional>
+#include <iostream>
 
 using namespace std;
 
@@ -35,6 +38,7 @@ Commands:\n\
   list packs                    Print list of used packs from the pack repository\n\
   list toolchains               Print list of supported toolchains\n\
   run                           Run code generator\n\
+  server                        Serve JSON-RPC requests read from stdin, keeping loaded packs and files\n\
   update-rte                    Create/update configuration files and validate solution\n\n\
 Options:\n\
   -c, --context arg [...]       Input context names [<project-name>][.<build-type>][+<target-type>]\n\
@@ -43,6 +47,7 @@ Options:\n\
   -e, --export arg              Set suffix for exporting <context><suffix>.cprj retaining only specified versions\n\
   -f, --filter arg              Filter words\n\
   -g, --generator arg           Code generator identifier\n\
+  -j, --jobs arg                Number of parallel jobs for loading packs, parsing cproject and clayer files and processing contexts, 0 for number of hardware threads (default 0)\n\
   -l, --load arg                Set policy for packs loading [latest | all | required]\n\
   -L, --clayer-path arg         Set search path for external clayers\n\
   -m, --missing                 List only required packs that are missing in the pack repository\n\
@@ -74,7 +79,8 @@ ProjMgr::ProjMgr() :
   m_relativePaths(false),
   m_frozenPacks(false),
   m_cbuildgen(false),
-  m_updateIdx(false)
+  m_updateIdx(false),
+  m_parallelContexts(false)
 {
   m_worker.SetEmitter(&m_emitter);
 }
@@ -142,6 +148,7 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
   cxxopts::Option filter("f,filter", "Filter words", cxxopts::value<string>());
   cxxopts::Option help("h,help", "Print usage");
   cxxopts::Option generator("g,generator", "Code generator identifier", cxxopts::value<string>());
+  cxxopts::Option jobs("j,jobs", "Number of parallel jobs for loading packs, parsing cproject and clayer files and processing contexts, 0 for number of hardware threads", cxxopts::value<unsigned>()->default_value("0"));
   cxxopts::Option load("l,load", "Set policy for packs loading [latest | all | required]", cxxopts::value<string>());
   cxxopts::Option clayerSearchPath("L,clayer-path", "Set search path for external clayers", cxxopts::value<string>());
   cxxopts::Option missing("m,missing", "List only required packs that are missing in the pack repository", cxxopts::value<bool>()->default_value("false"));
@@ -162,33 +169,36 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
   cxxopts::Option updateIdx("update-idx", "Update cbuild-idx file with layer info", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option quiet("q,quiet", "Run silently, printing only error messages", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option cbuildgen("cbuildgen", "Generate legacy *.cprj files", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option noPackCache("no-pack-cache", "Do not use cached pack descriptions in '${CMSIS_PACK_CACHE_DIR}', default '${CMSIS_PACK_ROOT}/.Local/.cache'", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option parallelContexts("parallel-contexts", "Process contexts in parallel, the number of threads is set by '--jobs'", cxxopts::value<bool>()->default_value("false"));
 
   // command options dictionary
   map<string, std::pair<bool, vector<cxxopts::Option>>> optionsDict = {
     // command, optional args, options
-    {"update-rte",        { false, {context, contextSet, debug, load, quiet, schemaCheck, toolchain, verbose, frozenPacks}}},
-    {"convert",           { false, {context, contextSet, debug, exportSuffix, load, quiet, schemaCheck, noUpdateRte, output, outputAlt, toolchain, verbose, frozenPacks, cbuildgen}}},
-    {"run",               { false, {context, contextSet, debug, generator, load, quiet, schemaCheck, verbose, dryRun}}},
-    {"list packs",        { true,  {context, contextSet, debug, filter, load, missing, quiet, schemaCheck, toolchain, verbose, relativePaths}}},
-    {"list boards",       { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list devices",      { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list configs",      { false, {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list components",   { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list dependencies", { false, {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
+    {"update-rte",        { false, {context, contextSet, debug, jobs, load, noPackCache, parallelContexts, quiet, schemaCheck, toolchain, verbose, frozenPacks}}},
+    {"convert",           { false, {context, contextSet, debug, exportSuffix, jobs, load, noPackCache, parallelContexts, quiet, schemaCheck, noUpdateRte, output, outputAlt, toolchain, verbose, frozenPacks, cbuildgen}}},
+    {"run",               { false, {context, contextSet, debug, generator, jobs, load, noPackCache, quiet, schemaCheck, verbose, dryRun}}},
+    {"list packs",        { true,  {context, contextSet, debug, filter, jobs, load, noPackCache, missing, quiet, schemaCheck, toolchain, verbose, relativePaths}}},
+    {"list boards",       { true,  {context, contextSet, debug, filter, jobs, load, noPackCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list devices",      { true,  {context, contextSet, debug, filter, jobs, load, noPackCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list configs",      { false, {context, contextSet, debug, filter, jobs, load, noPackCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list components",   { true,  {context, contextSet, debug, filter, jobs, load, noPackCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list dependencies", { false, {context, contextSet, debug, filter, jobs, load, noPackCache, quiet, schemaCheck, toolchain, verbose}}},
     {"list contexts",     { false, {debug, filter, quiet, schemaCheck, verbose, ymlOrder}}},
-    {"list generators",   { false, {context, contextSet, debug, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list layers",       { false, {context, contextSet, debug, load, clayerSearchPath, quiet, schemaCheck, toolchain, verbose, updateIdx}}},
+    {"list generators",   { false, {context, contextSet, debug, jobs, load, noPackCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list layers",       { false, {context, contextSet, debug, jobs, load, noPackCache, clayerSearchPath, quiet, schemaCheck, toolchain, verbose, updateIdx}}},
     {"list toolchains",   { false, {context, contextSet, debug, quiet, toolchain, verbose}}},
     {"list environment",  { true,  {}}},
+    {"server",            { true,  {}}},
   };
 
   try {
     options.add_options("", {
       {"positional", "", cxxopts::value<vector<string>>()},
       solution, context, contextSet, filter, generator,
-      load, clayerSearchPath, missing, schemaCheck, noUpdateRte, output, outputAlt,
+      jobs, load, clayerSearchPath, missing, schemaCheck, noUpdateRte, output, outputAlt,
       help, version, verbose, debug, dryRun, exportSuffix, toolchain, ymlOrder,
-      relativePaths, frozenPacks, updateIdx, quiet, cbuildgen
+      relativePaths, frozenPacks, updateIdx, quiet, cbuildgen, noPackCache, parallelContexts
     });
     options.parse_positional({ "positional" });
 
@@ -214,6 +224,9 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
     m_frozenPacks = parseResult.count("frozen-packs");
     m_cbuildgen = parseResult.count("cbuildgen");
     m_worker.SetCbuild2Cmake(!m_cbuildgen);
+    m_worker.SetJobs(parseResult["jobs"].as<unsigned>());
+    m_worker.SetUsePackCache(!parseResult.count("no-pack-cache"));
+    m_parallelContexts = parseResult.count("parallel-contexts");
     ProjMgrLogger::m_quiet = parseResult.count("quiet");
 
     vector<string> positionalArguments;
@@ -315,13 +328,20 @@ int ProjMgr::RunProjMgr(int argc, char** argv, char** envp) {
       envVars.push_back(string(*env));
     }
   }
-  manager.m_worker.SetEnvironmentVariables(envVars);
-  if(manager.m_worker.InitializeModel()) {
-    res = manager.ProcessCommands();
-  } else {
-    res = ErrorCode::ERROR;
+  if (manager.m_command == "server") {
+    // Serve requests until the input is closed or shutdown is requested
+    ProjMgrServer server(envVars);
+    return server.Run(cin, cout) ? ErrorCode::SUCCESS : ErrorCode::ERROR;
+  }
+  return manager.RunCommands(envVars);
+}
+
+int ProjMgr::RunCommands(const vector<string>& envVars) {
+  m_worker.SetEnvironmentVariables(envVars);
+  if (!m_worker.InitializeModel()) {
+    return ErrorCode::ERROR;
   }
-  return res;
+  return ProcessCommands();
 }
 
 int ProjMgr::ProcessCommands() {
@@ -462,16 +482,21 @@ bool ProjMgr::PopulateContexts(void) {
       }
     }
     // Parse cprojects
+    StrVec cprojectFiles;
     for (const auto& cproject : cprojects) {
       error_code ec;
       string const& cprojectFile = fs::canonical(m_rootDir + "/" + cproject, ec).generic_string();
       if (cprojectFile.empty()) {
-        ProjMgrLogger::Get().Error("cproject file was not found", "", cproject);
-        return false;
-      }
-      if (!m_parser.ParseCproject(cprojectFile, m_checkSchema)) {
+        // projects listed before the missing one are parsed and report their messages first
+        if (m_parser.ParseCprojects(cprojectFiles, m_checkSchema, m_worker.GetJobs())) {
+          ProjMgrLogger::Get().Error("cproject file was not found", "", cproject);
+        }
         return false;
       }
+      cprojectFiles.push_back(cprojectFile);
+    }
+    if (!m_parser.ParseCprojects(cprojectFiles, m_checkSchema, m_worker.GetJobs())) {
+      return false;
     }
   } else {
     ProjMgrLogger::Get().Error("input yml files were not specified");
@@ -570,6 +595,8 @@ bool ProjMgr::ParseAndValidateContexts() {
 }
 
 bool ProjMgr::Configure() {
+  RteCondition::ResetFilterCacheStatistics();
+
   // Parse all input files and populate contexts inputs
   if (!PopulateContexts()) {
     return false;
@@ -600,19 +627,23 @@ bool ProjMgr::Configure() {
   m_allContexts.clear();
   m_processedContexts.clear();
   m_failedContext.clear();
+  vector<ContextItem*> selectedContexts;
   for (auto& contextName : orderedContexts) {
     auto& contextItem = (*contexts)[contextName];
     m_allContexts.push_back(&contextItem);
-    if (!m_worker.IsContextSelected(contextName)) {
-      continue;
-    }
-    if (!m_worker.ProcessContext(contextItem, true, true, false)) {
-      ProjMgrLogger::Get().Error("processing context '" + contextName + "' failed", contextName);
-      m_failedContext.insert(contextItem.name);
-      error = true;
+    if (m_worker.IsContextSelected(contextName)) {
+      selectedContexts.push_back(&contextItem);
     }
-    m_processedContexts.push_back(&contextItem);
   }
+  m_worker.ProcessContexts(selectedContexts, true, true, false, m_parallelContexts,
+    [&](ContextItem& contextItem, bool success) {
+      if (!success) {
+        ProjMgrLogger::Get().Error("processing context '" + contextItem.name + "' failed", contextItem.name);
+        m_failedContext.insert(contextItem.name);
+        error = true;
+      }
+      m_processedContexts.push_back(&contextItem);
+    });
 
   if (m_worker.HasToolchainErrors()) {
     error = true;
@@ -648,6 +679,9 @@ bool ProjMgr::Configure() {
       }
       ProjMgrLogger::Get().Info(infoMsg);
     }
+    // Print condition filter results shared between contexts with equal filter attributes
+    ProjMgrLogger::Get().Info("condition filter results: " + to_string(RteCondition::GetFilterCacheHits()) +
+      " reused, " + to_string(RteCondition::GetFilterCacheMisses()) + " evaluated");
   }
 
   return !error;
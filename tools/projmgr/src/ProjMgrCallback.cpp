@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,8 @@
 
 using namespace std;
 
+thread_local ProjMgrCallback::Messages* ProjMgrCallback::theThreadMessages = nullptr;
+
 ProjMgrCallback::ProjMgrCallback() : RteCallback()
 {
 }
@@ -38,14 +40,14 @@ void ProjMgrCallback::Err(const string& id, const string& message, const string&
 void ProjMgrCallback::OutputErrMessage(const string& message)
 {
   if(!message.empty()) {
-    m_errorMessages.push_back(message);
+    (theThreadMessages ? theThreadMessages->errors : m_errorMessages).push_back(message);
   }
 }
 
 void ProjMgrCallback::OutputMessage(const string& message)
 {
   if (!message.empty()) {
-    m_warningMessages.push_back(message);
+    (theThreadMessages ? theThreadMessages->warnings : m_warningMessages).push_back(message);
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -11,6 +11,8 @@
 
 #include "RteFsUtils.h"
 
+#include <algorithm>
+
 using namespace std;
 
 ProjMgrExtGenerator::ProjMgrExtGenerator(ProjMgrParser* parser) :
@@ -55,9 +57,22 @@ const string& ProjMgrExtGenerator::GetGlobalDescription(const string& generatorI
 }
 
 void ProjMgrExtGenerator::AddUsedGenerator(const GeneratorOptionsItem& options, const string& contextId) {
+  lock_guard<mutex> lock(m_usedGeneratorsMutex);
   m_usedGenerators[options].push_back(contextId);
 }
 
+void ProjMgrExtGenerator::SortUsedGenerators(const StrVec& contexts) {
+  auto position = [&](const string& contextId) {
+    return find(contexts.begin(), contexts.end(), contextId) - contexts.begin();
+  };
+  lock_guard<mutex> lock(m_usedGeneratorsMutex);
+  for (auto& [_, contextIds] : m_usedGenerators) {
+    stable_sort(contextIds.begin(), contextIds.end(), [&](const string& a, const string& b) {
+      return position(a) < position(b);
+    });
+  }
+}
+
 const GeneratorContextVecMap& ProjMgrExtGenerator::GetUsedGenerators(void) {
   return m_usedGenerators;
 }
@@ -20,6 +20,7 @@ using namespace std;
 
 // Singleton kernel object
 static unique_ptr<ProjMgrKernel> theProjMgrKernel = 0;
+static bool theKeepKernel = false;
 
 ProjMgrKernel::ProjMgrKernel() :
   RteKernelSlim()
@@ -63,3 +64,47 @@ void ProjMgrKernel::Destroy() {
     theProjMgrKernel.reset();
   }
 }
+
+void ProjMgrKernel::Release() {
+  if (!theKeepKernel) {
+    Destroy();
+    return;
+  }
+  if (theProjMgrKernel) {
+    theProjMgrKernel->UpdatePackTimes();
+    theProjMgrKernel->GetGlobalModel()->ClearKeepPacks();
+    theProjMgrKernel->GetCallback()->ClearErrorMessages();
+    theProjMgrKernel->GetCallback()->ClearWarningMessages();
+  }
+}
+
+void ProjMgrKernel::SetKeep(bool keep) {
+  theKeepKernel = keep;
+}
+
+bool ProjMgrKernel::Init() {
+  RemoveModifiedPacks();
+  return RteKernelSlim::Init();
+}
+
+void ProjMgrKernel::UpdatePackTimes() {
+  for (const auto& [pdscFile, _] : GetPackRegistry()->GetLoadedPacks()) {
+    if (m_packTimes.find(pdscFile) == m_packTimes.end()) {
+      error_code ec;
+      m_packTimes[pdscFile] = fs::last_write_time(pdscFile, ec);
+    }
+  }
+}
+
+void ProjMgrKernel::RemoveModifiedPacks() {
+  for (auto it = m_packTimes.begin(); it != m_packTimes.end();) {
+    error_code ec;
+    const auto time = fs::last_write_time(it->first, ec);
+    if (ec || time != it->second) {
+      GetPackRegistry()->ErasePack(it->first);
+      it = m_packTimes.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -26,6 +26,8 @@ bool ProjMgrLogger::m_silent = false;
 // singleton instance
 static unique_ptr<ProjMgrLogger> theProjMgrLogger = 0;
 
+thread_local ProjMgrLoggerCapture* ProjMgrLoggerCapture::theCapture = nullptr;
+
   ProjMgrLogger::ProjMgrLogger() {
 }
 
@@ -50,6 +52,9 @@ void ProjMgrLogger::ProjMgrLogger::Clear() {
 
 void ProjMgrLogger::Error(const string& msg, const string& context,
   const string& file, const int line, const int column) {
+  if (ProjMgrLoggerCapture::Capture(ProjMgrLoggerCapture::MessageType::Error, msg, context, file, line, column)) {
+    return;
+  }
   const string mark = (line > 0 ? ":" + to_string(line) : "") + (column > 0 ? ":" + to_string(column) : "");
   CollectionUtils::PushBackUniquely(m_errors[context],
     (file.empty() ? "" : RteUtils::ExtractFileName(file) + mark + " - ") + msg);
@@ -60,6 +65,9 @@ void ProjMgrLogger::Error(const string& msg, const string& context,
 
 void ProjMgrLogger::Warn(const string& msg, const string& context,
   const string& file, const int line, const int column) {
+  if (ProjMgrLoggerCapture::Capture(ProjMgrLoggerCapture::MessageType::Warn, msg, context, file, line, column)) {
+    return;
+  }
   const string mark = (line > 0 ? ":" + to_string(line) : "") + (column > 0 ? ":" + to_string(column) : "");
   CollectionUtils::PushBackUniquely(m_warns[context],
     (file.empty() ? "" : RteUtils::ExtractFileName(file) + mark + " - ") + msg);
@@ -70,6 +78,9 @@ void ProjMgrLogger::Warn(const string& msg, const string& context,
 
 void ProjMgrLogger::Info(const string& msg, const string& context,
   const string& file, const int line, const int column) {
+  if (ProjMgrLoggerCapture::Capture(ProjMgrLoggerCapture::MessageType::Info, msg, context, file, line, column)) {
+    return;
+  }
   const string mark = (line > 0 ? ":" + to_string(line) : "") + (column > 0 ? ":" + to_string(column) : "");
   CollectionUtils::PushBackUniquely(m_infos[context],
     (file.empty() ? "" : RteUtils::ExtractFileName(file) + mark + " - ") + msg);
@@ -79,6 +90,9 @@ void ProjMgrLogger::Info(const string& msg, const string& context,
 }
 
 void ProjMgrLogger::Debug(const string& msg) {
+  if (ProjMgrLoggerCapture::Capture(ProjMgrLoggerCapture::MessageType::Debug, msg)) {
+    return;
+  }
   if (!IsQuiet()) {
     cerr << PROJMGR_DEBUG << PROJMGR_TOOL << msg << endl;
   }
@@ -106,5 +120,65 @@ const std::vector<std::string>& ProjMgrLogger::GetInfosForContext(const std::str
   return get_or_default_const_ref(m_infos, context, RteUtils::EMPTY_STRING_VECTOR);
 }
 
+ProjMgrLoggerCapture::ProjMgrLoggerCapture() :
+  m_prev(nullptr),
+  m_active(false)
+{
+}
+
+ProjMgrLoggerCapture::~ProjMgrLoggerCapture() {
+  Stop();
+}
+
+void ProjMgrLoggerCapture::Start() {
+  if (m_active) {
+    return;
+  }
+  m_prev = theCapture;
+  theCapture = this;
+  m_active = true;
+}
+
+void ProjMgrLoggerCapture::Stop() {
+  if (!m_active) {
+    return;
+  }
+  if (theCapture == this) {
+    theCapture = m_prev;
+  }
+  m_prev = nullptr;
+  m_active = false;
+}
+
+bool ProjMgrLoggerCapture::Capture(MessageType type, const string& msg, const string& context,
+  const string& file, const int line, const int column) {
+  if (!theCapture) {
+    return false;
+  }
+  theCapture->m_messages.push_back({ type, msg, context, file, line, column });
+  return true;
+}
+
+void ProjMgrLoggerCapture::Replay() const {
+  if (theCapture == this) {
+    return; // still capturing in this thread
+  }
+  for (const auto& m : m_messages) {
+    switch (m.type) {
+    case MessageType::Error:
+      ProjMgrLogger::Get().Error(m.msg, m.context, m.file, m.line, m.column);
+      break;
+    case MessageType::Warn:
+      ProjMgrLogger::Get().Warn(m.msg, m.context, m.file, m.line, m.column);
+      break;
+    case MessageType::Info:
+      ProjMgrLogger::Get().Info(m.msg, m.context, m.file, m.line, m.column);
+      break;
+    case MessageType::Debug:
+      ProjMgrLogger::Debug(m.msg);
+      break;
+    }
+  }
+}
 
 // end of ProjMgrLogger.cpp
@@ -1,17 +1,63 @@
 /*
- * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "ProjMgrParser.h"
+#include "ProjMgrLogger.h"
 #include "ProjMgrYamlParser.h"
 
+#include "ThreadPool.h"
+
 #include <iostream>
+#include <set>
 #include <string>
 
 using namespace std;
 
+// Files are parsed by worker threads into separate maps, their messages are captured.
+// Parsed items are inserted and messages are output afterwards in the order of the input files.
+template<class Item>
+static bool ParseFiles(const vector<string>& inputs, unsigned jobs, map<string, Item>& items,
+  const function<bool(const string&, map<string, Item>&)>& parse, const function<void(size_t)>& output)
+{
+  struct ParseResult {
+    ProjMgrLoggerCapture logger;
+    map<string, Item> items;
+    bool duplicate = false;
+    bool ret = true;
+  };
+  vector<ParseResult> results(inputs.size());
+  set<string> uniqueInputs;
+  for (size_t index = 0; index < inputs.size(); index++) {
+    results[index].duplicate = !uniqueInputs.insert(inputs[index]).second;
+  }
+  ProjMgrLogger::Get(); // create logger instance before it is used by worker threads
+  ThreadPool(jobs).ForEach(inputs.size(), [&](size_t index, size_t) {
+    ParseResult& result = results[index];
+    if (!result.duplicate) {
+      result.logger.Start();
+      result.ret = parse(inputs[index], result.items);
+      result.logger.Stop();
+    }
+  });
+  for (size_t index = 0; index < inputs.size(); index++) {
+    ParseResult& result = results[index];
+    if (output) {
+      output(index);
+    }
+    result.logger.Replay();
+    if (!result.ret) {
+      return false;
+    }
+    for (auto& [input, item] : result.items) {
+      items[input] = move(item);
+    }
+  }
+  return true;
+}
+
 // Parser class for public interfacing
 // ParseCsolution and ParseCproject are forwarded to the implementation class
 
@@ -39,16 +85,41 @@ bool ProjMgrParser::ParseCproject(const string& input, bool checkSchema, bool si
     input, m_csolution, m_cprojects, single, checkSchema);
 }
 
+bool ProjMgrParser::ParseCprojects(const vector<string>& inputs, bool checkSchema, unsigned jobs) {
+  // Parse projects
+  return ParseFiles<CprojectItem>(inputs, jobs, m_cprojects,
+    [&](const string& input, map<string, CprojectItem>& cprojects) {
+      return ProjMgrYamlParser().ParseCproject(input, m_csolution, cprojects, false, checkSchema);
+    }, nullptr);
+}
+
 bool ProjMgrParser::ParseClayer(const string& input, bool checkSchema) {
   // Parse layer file
   return ProjMgrYamlParser().ParseClayer(input, m_clayers, checkSchema);
 }
 
+bool ProjMgrParser::ParseClayers(const vector<string>& inputs, bool checkSchema, unsigned jobs,
+  const function<void(size_t)>& output) {
+  // Parse layer files
+  return ParseFiles<ClayerItem>(inputs, jobs, m_clayers,
+    [&](const string& input, map<string, ClayerItem>& clayers) {
+      return m_clayers.find(input) != m_clayers.end() || ProjMgrYamlParser().ParseClayer(input, clayers, checkSchema);
+    }, output);
+}
+
 bool ProjMgrParser::ParseGenericClayer(const string& input, bool checkSchema) {
   // Parse generic layer file
   return ProjMgrYamlParser().ParseClayer(input, m_genericClayers, checkSchema);
 }
 
+bool ProjMgrParser::ParseGenericClayers(const vector<string>& inputs, bool checkSchema, unsigned jobs) {
+  // Parse generic layer files
+  return ParseFiles<ClayerItem>(inputs, jobs, m_genericClayers,
+    [&](const string& input, map<string, ClayerItem>& clayers) {
+      return m_genericClayers.find(input) != m_genericClayers.end() || ProjMgrYamlParser().ParseClayer(input, clayers, checkSchema);
+    }, nullptr);
+}
+
 bool ProjMgrParser::ParseCbuildSet(const string& input, bool checkSchema) {
   // Parse cbuild-set file
   return ProjMgrYamlParser().ParseCbuildSet(input, m_cbuildSet, checkSchema);
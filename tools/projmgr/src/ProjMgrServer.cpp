@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ProjMgrServer.h"
+#include "ProjMgr.h"
+#include "ProjMgrKernel.h"
+#include "ProjMgrLogger.h"
+#include "ProjMgrYamlParser.h"
+
+#include "RteUtils.h"
+
+#include <set>
+
+using namespace std;
+using json = nlohmann::json;
+
+/**
+  * @brief JSON-RPC 2.0 error codes
+ */
+static constexpr int RPC_PARSE_ERROR = -32700;
+static constexpr int RPC_INVALID_REQUEST = -32600;
+static constexpr int RPC_METHOD_NOT_FOUND = -32601;
+static constexpr int RPC_INVALID_PARAMS = -32602;
+static constexpr int RPC_INTERNAL_ERROR = -32603;
+
+static constexpr const char* CONTENT_LENGTH = "Content-Length:";
+
+// commands served by requests, 'run' is excluded as it launches external generators
+static const set<string> SERVER_COMMANDS = {
+  "convert", "update-rte",
+  "list boards", "list components", "list configs", "list contexts", "list dependencies",
+  "list devices", "list environment", "list generators", "list layers", "list packs", "list toolchains",
+};
+
+static json ErrorResponse(const json& id, int code, const string& message) {
+  return { {"jsonrpc", "2.0"}, {"id", id}, {"error", { {"code", code}, {"message", message} }} };
+}
+
+static json GetMessages(const map<string, vector<string>>& messages) {
+  json list = json::array();
+  for (const auto& [_, contextMessages] : messages) {
+    for (const auto& msg : contextMessages) {
+      list.push_back(msg);
+    }
+  }
+  return list;
+}
+
+ProjMgrServer::ProjMgrServer(const vector<string>& envVars) :
+  m_envVars(envVars),
+  m_shutdown(false)
+{
+  ProjMgrKernel::SetKeep(true);
+  ProjMgrYamlParser::EnableCache(true);
+}
+
+ProjMgrServer::~ProjMgrServer() {
+  ProjMgrYamlParser::EnableCache(false);
+  ProjMgrKernel::SetKeep(false);
+  ProjMgrKernel::Destroy();
+}
+
+bool ProjMgrServer::Run(istream& in, ostream& out) {
+  m_shutdown = false;
+  string message;
+  bool contentLength = false;
+  while (!m_shutdown && ReadMessage(in, message, contentLength)) {
+    const json& response = HandleRequest(message);
+    if (!response.is_null()) {
+      WriteMessage(out, response.dump(-1, ' ', false, json::error_handler_t::replace), contentLength);
+    }
+  }
+  return out.good();
+}
+
+bool ProjMgrServer::ReadMessage(istream& in, string& message, bool& contentLength) {
+  string line;
+  while (getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    if (line.empty()) {
+      continue;
+    }
+    const size_t headerLength = string(CONTENT_LENGTH).size();
+    if (line.compare(0, headerLength, CONTENT_LENGTH) != 0) {
+      // message in a single line
+      message = line;
+      contentLength = false;
+      return true;
+    }
+    // skip further headers up to the empty line
+    const size_t length = RteUtils::StringToULL(RteUtils::Trim(line.substr(headerLength)));
+    while (getline(in, line) && !line.empty() && line != "\r");
+    message.assign(length, '\0');
+    if (!in.read(message.data(), length)) {
+      return false;
+    }
+    contentLength = true;
+    return true;
+  }
+  return false;
+}
+
+void ProjMgrServer::WriteMessage(ostream& out, const string& message, bool contentLength) {
+  if (contentLength) {
+    out << CONTENT_LENGTH << " " << message.size() << "\r\n\r\n" << message;
+  } else {
+    out << message << "\n";
+  }
+  out.flush();
+}
+
+json ProjMgrServer::HandleRequest(const string& message) {
+  json request;
+  try {
+    request = json::parse(message);
+  }
+  catch (json::parse_error& e) {
+    return ErrorResponse(nullptr, RPC_PARSE_ERROR, e.what());
+  }
+  if (!request.is_object() || !request.contains("jsonrpc") || request["jsonrpc"] != "2.0" ||
+    !request.contains("method") || !request["method"].is_string()) {
+    const bool validId = request.is_object() && request.contains("id") &&
+      (request["id"].is_string() || request["id"].is_number());
+    return ErrorResponse(validId ? request["id"] : json(), RPC_INVALID_REQUEST, "invalid request");
+  }
+  const bool notification = !request.contains("id");
+  const json id = notification ? json() : request["id"];
+  const string& method = request["method"].get<string>();
+
+  json response = { {"jsonrpc", "2.0"}, {"id", id} };
+  if (method == "shutdown") {
+    m_shutdown = true;
+    response["result"] = nullptr;
+  } else if (SERVER_COMMANDS.find(method) == SERVER_COMMANDS.end()) {
+    response = ErrorResponse(id, RPC_METHOD_NOT_FOUND, "method '" + method + "' was not found");
+  } else {
+    vector<string> args;
+    string error;
+    const json& params = request.contains("params") ? request["params"] : json::object();
+    if (!GetArguments(method, params, args, error)) {
+      response = ErrorResponse(id, RPC_INVALID_PARAMS, error);
+    } else {
+      try {
+        response["result"] = RunCommand(args);
+      }
+      catch (exception& e) {
+        response = ErrorResponse(id, RPC_INTERNAL_ERROR, e.what());
+      }
+    }
+  }
+  return notification ? json() : response;
+}
+
+bool ProjMgrServer::GetArguments(const string& method, const json& params, vector<string>& args, string& error) {
+  // command and its argument, e.g. 'list components'
+  const size_t pos = method.find(' ');
+  args = pos == string::npos ? vector<string>{ method } :
+    vector<string>{ method.substr(0, pos), method.substr(pos + 1) };
+  if (!params.is_object()) {
+    error = "params must be an object of command line options";
+    return false;
+  }
+  for (const auto& [key, value] : params.items()) {
+    if (key.empty() || key.front() == '-') {
+      error = "invalid option '" + key + "'";
+      return false;
+    }
+    const string option = (key.size() == 1 ? "-" : "--") + key;
+    if (value.is_boolean()) {
+      if (value.get<bool>()) {
+        args.push_back(option);
+      }
+    } else if (value.is_string()) {
+      args.push_back(option);
+      args.push_back(value.get<string>());
+    } else if (value.is_number_unsigned()) {
+      args.push_back(option);
+      args.push_back(to_string(value.get<unsigned long long>()));
+    } else if (value.is_array()) {
+      for (const auto& item : value) {
+        if (!item.is_string()) {
+          error = "invalid value of option '" + key + "'";
+          return false;
+        }
+        args.push_back(option);
+        args.push_back(item.get<string>());
+      }
+    } else {
+      error = "invalid value of option '" + key + "'";
+      return false;
+    }
+  }
+  return true;
+}
+
+json ProjMgrServer::RunCommand(const vector<string>& args) {
+  vector<char*> argv = { (char*)"csolution" };
+  for (const auto& arg : args) {
+    argv.push_back(const_cast<char*>(arg.c_str()));
+  }
+
+  // output and messages are collected instead of printed
+  const bool silent = ProjMgrLogger::m_silent;
+  const bool quiet = ProjMgrLogger::m_quiet;
+  ProjMgrLogger::m_silent = true;
+  ProjMgrLogger::Get().Clear();
+
+  json result;
+  try {
+    ProjMgr manager;
+    int exitCode = manager.ParseCommandLine((int)argv.size(), argv.data());
+    if (exitCode == 0) {
+      exitCode = manager.RunCommands(m_envVars);
+    } else if (exitCode < 0) {
+      // help requested
+      exitCode = ErrorCode::SUCCESS;
+    }
+    // the logger is cleared when the manager is destroyed
+    const ProjMgrLogger& logger = ProjMgrLogger::Get();
+    result["success"] = exitCode == ErrorCode::SUCCESS;
+    result["exitCode"] = exitCode;
+    result["output"] = logger.GetStringStream().str();
+    result["errors"] = GetMessages(logger.GetErrors());
+    result["warnings"] = GetMessages(logger.GetWarns());
+    result["infos"] = GetMessages(logger.GetInfos());
+  }
+  catch (...) {
+    ProjMgrLogger::m_silent = silent;
+    ProjMgrLogger::m_quiet = quiet;
+    throw;
+  }
+
+  ProjMgrLogger::m_silent = silent;
+  ProjMgrLogger::m_quiet = quiet;
+  return result;
+}
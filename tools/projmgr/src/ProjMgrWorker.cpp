@@ -10,6 +10,7 @@
 
 #include "CrossPlatformUtils.h"
 #include "RteFsUtils.h"
+#include "ThreadPool.h"
 
 #include <algorithm>
 #include <iostream>
@@ -17,6 +18,8 @@
 
 using namespace std;
 
+thread_local vector<function<void()>>* ProjMgrWorker::theDeferredUpdates = nullptr;
+
 static const regex accessSequencesRegEx = regex(string("^(") +
   RteConstants::AS_SOLUTION_DIR + "|" +
   RteConstants::AS_PROJECT_DIR  + "|" +
@@ -44,6 +47,8 @@ ProjMgrWorker::ProjMgrWorker(ProjMgrParser* parser, ProjMgrExtGenerator* extGene
   m_parser(parser),
   m_extGenerator(extGenerator),
   m_loadPacksPolicy(LoadPacksPolicy::DEFAULT),
+  m_jobs(0),
+  m_usePackCache(true),
   m_checkSchema(false),
   m_verbose(false),
   m_debug(false),
@@ -54,7 +59,7 @@ ProjMgrWorker::ProjMgrWorker(ProjMgrParser* parser, ProjMgrExtGenerator* extGene
 }
 
 ProjMgrWorker::~ProjMgrWorker(void) {
-  ProjMgrKernel::Destroy();
+  ProjMgrKernel::Release();
   ProjMgrLogger::Get().Clear();
 
   for (auto context : m_contexts) {
@@ -158,6 +163,46 @@ void ProjMgrWorker::AddContext(ContextDesc& descriptor, const TypePair& type, Co
 }
 
 bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
+  return ParseContextLayers(vector<ContextItem*>{ &context });
+}
+
+bool ProjMgrWorker::ParseContextLayers(const vector<ContextItem*>& contexts) {
+  // Layer files of all contexts are parsed in parallel. Messages are output in the same order
+  // as if the layers were parsed context by context, each context after its own messages.
+  struct ContextLayers {
+    ProjMgrLoggerCapture logger;
+    StrVec clayerFiles;
+    size_t firstFile = 0;
+  };
+  vector<ContextLayers> contextLayers(contexts.size());
+  StrVec clayerFiles;
+  for (size_t i = 0; i < contexts.size(); i++) {
+    ContextLayers& layers = contextLayers[i];
+    layers.logger.Start();
+    GetContextLayerFiles(*contexts[i], layers.clayerFiles);
+    layers.logger.Stop();
+    layers.firstFile = clayerFiles.size();
+    clayerFiles.insert(clayerFiles.end(), layers.clayerFiles.begin(), layers.clayerFiles.end());
+  }
+  size_t outputContexts = 0;
+  auto outputContextMessages = [&](size_t fileIndex) {
+    while (outputContexts < contexts.size() && contextLayers[outputContexts].firstFile <= fileIndex) {
+      contextLayers[outputContexts++].logger.Replay();
+    }
+  };
+  if (!m_parser->ParseClayers(clayerFiles, m_checkSchema, m_jobs, outputContextMessages)) {
+    return false;
+  }
+  outputContextMessages(clayerFiles.size());
+  for (size_t i = 0; i < contexts.size(); i++) {
+    for (const auto& clayerFile : contextLayers[i].clayerFiles) {
+      contexts[i]->clayers[clayerFile] = &m_parser->GetClayers().at(clayerFile);
+    }
+  }
+  return true;
+}
+
+void ProjMgrWorker::GetContextLayerFiles(ContextItem& context, StrVec& clayerFiles) {
   // user defined variables
   typedef std::vector<std::pair<std::string, std::string>> Variables;
   auto itBuildType = std::find_if(context.csolution->buildTypes.begin(), context.csolution->buildTypes.end(),
@@ -193,7 +238,7 @@ bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
       context.variables[key] = expandedValue;
     }
   }
-  // parse clayers
+  // clayers to be parsed
   for (const auto& clayer : context.cproject->clayers) {
     if (clayer.layer.empty()) {
       continue;
@@ -216,14 +261,9 @@ bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
           continue;
         }
       }
-      if (m_parser->ParseClayer(clayerFile, m_checkSchema)) {
-        context.clayers[clayerFile] = &m_parser->GetClayers().at(clayerFile);
-      } else {
-        return false;
-      }
+      clayerFiles.push_back(clayerFile);
     }
   }
-  return true;
 }
 
 void ProjMgrWorker::GetContexts(map<string, ContextItem>* &contexts) {
@@ -280,6 +320,14 @@ void ProjMgrWorker::SetLoadPacksPolicy(const LoadPacksPolicy& policy) {
   m_loadPacksPolicy = policy;
 }
 
+void ProjMgrWorker::SetJobs(unsigned jobs) {
+  m_jobs = jobs;
+}
+
+void ProjMgrWorker::SetUsePackCache(bool bUse) {
+  m_usePackCache = bUse;
+}
+
 void ProjMgrWorker::SetEnvironmentVariables(const StrVec& envVars) {
   m_envVars = envVars;
 }
@@ -389,6 +437,14 @@ string ProjMgrWorker::GetPackRoot() {
   return packRoot;
 }
 
+string ProjMgrWorker::GetPackCacheDir() {
+  string packCacheDir = CrossPlatformUtils::GetEnv("CMSIS_PACK_CACHE_DIR");
+  if (!packCacheDir.empty()) {
+    packCacheDir = RteFsUtils::MakePathCanonical(packCacheDir);
+  }
+  return packCacheDir;
+}
+
 bool ProjMgrWorker::InitializeModel() {
   if(m_kernel) {
     return true; // already initialized
@@ -405,6 +461,9 @@ bool ProjMgrWorker::InitializeModel() {
     return false;
   }
   m_kernel->SetCmsisPackRoot(m_packRoot);
+  m_kernel->SetJobs(m_jobs);
+  m_kernel->SetUsePackCache(m_usePackCache);
+  m_kernel->SetPackCacheDir(GetPackCacheDir());
   m_model->SetCallback(m_kernel->GetCallback());
   return m_kernel->Init();
 }
@@ -477,6 +536,10 @@ bool ProjMgrWorker::LoadAllRelevantPacks() {
 }
 
 bool ProjMgrWorker::LoadPacks(ContextItem& context) {
+  return InitializeContextTarget(context) && FilterContextPacks(context);
+}
+
+bool ProjMgrWorker::InitializeContextTarget(ContextItem& context) {
   if (!InitializeModel()) {
     return false;
   }
@@ -487,6 +550,10 @@ bool ProjMgrWorker::LoadPacks(ContextItem& context) {
     PrintContextErrors(context.name);
     return false;
   }
+  return true;
+}
+
+bool ProjMgrWorker::FilterContextPacks(ContextItem& context) {
   // Filter context specific packs
   set<string> selectedPacks;
   const bool allOrLatest = (m_loadPacksPolicy == LoadPacksPolicy::ALL) || (m_loadPacksPolicy == LoadPacksPolicy::LATEST);
@@ -643,25 +710,102 @@ bool ProjMgrWorker::GetPrecedentValue(std::string& outValue, const std::string&
   return true;
 }
 
-void ProjMgrWorker::GetAllCombinations(const ConnectionsCollectionMap& src, const ConnectionsCollectionMap::iterator& it,
-  std::vector<ConnectionsCollectionVec>& combinations, const ConnectionsCollectionVec& previous) {
-  // combine items from a table of 'connections'
-  // see an example in the test case ProjMgrWorkerUnitTests.GetAllCombinations
+bool ProjMgrWorker::VisitCombinations(const ConnectionsCollectionMap& src,
+  const function<bool(const ConnectionsCollectionVec&)>& visit, bool prune) {
+  // combine items from a table of 'connections', one item per column, building the combinations
+  // one by one by backtracking: with 'prune' a partial combination is abandoned as soon as it
+  // cannot become valid anymore; the search stops when 'visit' returns false
+  // see an example in the test case ProjMgrWorkerUnitTests.VisitCombinations
+  if (src.empty()) {
+    return true;
+  }
+  // keys provided by any candidate of the remaining layer types
+  vector<StrSet> laterProvides(src.size());
+  size_t index = src.size() - 1;
+  for (auto it = src.rbegin(); next(it) != src.rend(); it++, index--) {
+    laterProvides[index - 1] = laterProvides[index];
+    for (const auto& item : it->second) {
+      for (const auto& connect : item.connections) {
+        for (const auto& provided : connect->provides) {
+          laterProvides[index - 1].insert(provided.first);
+        }
+      }
+    }
+  }
+  ConnectionsCollectionVec combination;
+  return VisitCombinations(src.begin(), src.end(), laterProvides.begin(), combination, visit, prune);
+}
+
+bool ProjMgrWorker::VisitCombinations(ConnectionsCollectionMap::const_iterator it, ConnectionsCollectionMap::const_iterator end,
+  vector<StrSet>::const_iterator laterProvides, ConnectionsCollectionVec& combination,
+  const function<bool(const ConnectionsCollectionVec&)>& visit, bool prune) {
   const auto nextIt = next(it, 1);
-  // iterate over the input columns
   for (const auto& item : it->second) {
-    ConnectionsCollectionVec combination = previous;
     if (!item.filename.empty()) {
       combination.push_back(item);
     }
-    if (nextIt != src.end()) {
-      // run recursively over the next item
-      GetAllCombinations(src, nextIt, combinations, combination);
+    bool proceed = true;
+    if (prune && !item.filename.empty() && !IsFeasibleCombination(combination, *laterProvides)) {
+      // skip all combinations starting with this one
+    } else if (nextIt != end) {
+      proceed = VisitCombinations(nextIt, end, next(laterProvides, 1), combination, visit, prune);
     } else {
-      // add a new combination containing an item from each column
-      combinations.push_back(combination);
+      proceed = visit(combination);
+    }
+    if (!item.filename.empty()) {
+      combination.pop_back();
+    }
+    if (!proceed) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ProjMgrWorker::IsFeasibleCombination(const ConnectionsCollectionVec& combination, const StrSet& laterProvides) {
+  // adding layers can only activate further connects: conflicts, overflows and incompatibilities
+  // of active connects remain, unless a missing interface can still be provided by a later layer
+  ActiveConnectMap activeConnectMap;
+  GetActiveConnectMap(combination, activeConnectMap);
+  StrMap providedValues;
+  for (const auto& [connect, active] : activeConnectMap) {
+    if (active) {
+      for (const auto& [key, value] : connect->provides) {
+        if (!providedValues.emplace(key, value).second) {
+          return false; // conflict
+        }
+      }
     }
   }
+  IntMap consumedAddedValues;
+  for (const auto& [connect, active] : activeConnectMap) {
+    if (!active) {
+      continue;
+    }
+    for (const auto& [key, value] : connect->consumes) {
+      const auto provided = providedValues.find(key);
+      if (value.find_first_of('+') == 0) {
+        consumedAddedValues[key] += RteUtils::StringToInt(value, 0);
+      } else if (provided != providedValues.end()) {
+        if (!value.empty() && value != provided->second) {
+          return false; // incompatible
+        }
+      } else if (laterProvides.find(key) == laterProvides.end()) {
+        return false; // never provided
+      }
+    }
+  }
+  for (const auto& [key, value] : consumedAddedValues) {
+    const auto provided = providedValues.find(key);
+    if (provided != providedValues.end()) {
+      if (value > RteUtils::StringToInt(provided->second, 0)) {
+        return false; // overflow
+      }
+    } else if (value > 0 && laterProvides.find(key) == laterProvides.end()) {
+      return false; // overflow, never provided
+    }
+  }
+  return true;
 }
 
 void ProjMgrWorker::GetAllSelectCombinations(const ConnectPtrMap& src, const ConnectPtrMap::iterator& it,
@@ -703,18 +847,22 @@ bool ProjMgrWorker::CollectLayersFromSearchPath(const string& clayerSearchPath,
       ProjMgrLogger::Get().Error("clayer search path does not exist", "", absSearchPath);
       return false;
     }
+    StrVec clayerFiles;
     for (auto& item : fs::recursive_directory_iterator(absSearchPath, ec)) {
       if (fs::is_regular_file(item, ec) && (!ec)) {
         const string& clayerFile = item.path().generic_string();
         if (regex_match(clayerFile, regex(".*\\.clayer\\.(yml|yaml)"))) {
-          if (!m_parser->ParseGenericClayer(clayerFile, m_checkSchema)) {
-            return false;
-          }
-          ClayerItem* clayer = &m_parser->GetGenericClayers()[clayerFile];
-          CollectionUtils::PushBackUniquely(clayers[clayer->type], clayerFile);
+          clayerFiles.push_back(clayerFile);
         }
       }
     }
+    if (!m_parser->ParseGenericClayers(clayerFiles, m_checkSchema, m_jobs)) {
+      return false;
+    }
+    for (const auto& clayerFile : clayerFiles) {
+      ClayerItem* clayer = &m_parser->GetGenericClayers()[clayerFile];
+      CollectionUtils::PushBackUniquely(clayers[clayer->type], clayerFile);
+    }
   }
   return true;
 }
@@ -743,14 +891,11 @@ bool ProjMgrWorker::GetCandidateLayers(LayersDiscovering& discover) {
     }
   }
   // parse matched type layers
+  StrVec clayerFiles;
   for (const auto& [type, clayers] : discover.candidateClayers) {
-    for (const auto& clayer : clayers) {
-      if (!m_parser->ParseGenericClayer(clayer, m_checkSchema)) {
-        return false;
-      }
-    }
+    clayerFiles.insert(clayerFiles.end(), clayers.begin(), clayers.end());
   }
-  return true;
+  return m_parser->ParseGenericClayers(clayerFiles, m_checkSchema, m_jobs);
 }
 
 bool ProjMgrWorker::DiscoverMatchingLayers(ContextItem& context, string clayerSearchPath) {
@@ -816,14 +961,12 @@ bool ProjMgrWorker::ProcessLayerCombinations(ContextItem& context, LayersDiscove
   // classify connections according to layer types and set config-ids
   ConnectionsCollectionMap classifiedConnections = ClassifyConnections(allConnections, discover.optionalTypeFlags);
 
-  // cross classified connections to get all combinations to be validated
-  vector<ConnectionsCollectionVec> combinations;
-  if (!classifiedConnections.empty()) {
-    GetAllCombinations(classifiedConnections, classifiedConnections.begin(), combinations);
-  }
-
-  // validate connections combinations
-  for (auto& combination : combinations) {
+  // cross classified connections and validate combinations one by one,
+  // debug output lists all combinations, otherwise combinations that cannot become valid are skipped;
+  // the search is not stopped after a number of valid combinations: compatible layers and configuration
+  // options are derived from all of them and an incomplete set would change the listed layers
+  VisitCombinations(classifiedConnections, [&](const ConnectionsCollectionVec& visited) {
+    ConnectionsCollectionVec combination = visited;
 
     // validate connections
     ConnectionsValidationResult result = ValidateConnections(combination);
@@ -877,7 +1020,8 @@ bool ProjMgrWorker::ProcessLayerCombinations(ContextItem& context, LayersDiscove
       PrintConnectionsValidation(result, debugMsg);
       debugMsg += "connections are " + string(result.valid ? "valid" : "invalid") + "\n";
     }
-  }
+    return true;
+  }, !m_debug);
 
   // assess generic layers validation results
   if (!discover.candidateClayers.empty()) {
@@ -1105,7 +1249,7 @@ bool ProjMgrWorker::ProvidedConnectionsMatch(ConnectionsCollection collection, C
   return false;
 }
 
-ConnectionsValidationResult ProjMgrWorker::ValidateConnections(ConnectionsCollectionVec combination) {
+ConnectionsValidationResult ProjMgrWorker::ValidateConnections(const ConnectionsCollectionVec& combination) {
   // get active connects
   ActiveConnectMap activeConnectMap;
   GetActiveConnectMap(combination, activeConnectMap);
@@ -1758,13 +1902,8 @@ bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
     return false;
   }
 
-  // Get installed components map
-  const RteComponentMap& installedComponents = context.rteActiveTarget->GetFilteredComponents();
-  RteComponentMap componentMap;
-  for (auto& component : installedComponents) {
-    const string& componentId = component.second->GetComponentID(true);
-    componentMap[componentId] = component.second;
-  }
+  // Get index of installed components
+  const RteComponentIndex& componentIndex = context.rteActiveTarget->GetComponentIndex();
 
   map<string, vector<string>> processedComponents;
   for (auto& [item, layer] : context.componentRequirements) {
@@ -1772,7 +1911,7 @@ bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
       continue;
     }
     string hint;
-    RteComponent* matchedComponent = ProcessComponent(context, item, componentMap, hint);
+    RteComponent* matchedComponent = ProcessComponent(context, item, componentIndex, hint);
     if (!matchedComponent) {
       // No match
       ProjMgrLogger::Get().Error("no component was found with identifier '" + item.component + "'" +
@@ -1902,7 +2041,7 @@ bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
   return !error;
 }
 
-RteComponent* ProjMgrWorker::ProcessComponent(ContextItem& context, ComponentItem& item, RteComponentMap& componentMap, string& hint)
+RteComponent* ProjMgrWorker::ProcessComponent(ContextItem& context, ComponentItem& item, const RteComponentIndex& componentIndex, string& hint)
 {
   if (!item.condition.empty()) {
     RteComponentInstance ci(nullptr);
@@ -1923,7 +2062,6 @@ RteComponent* ProjMgrWorker::ProcessComponent(ContextItem& context, ComponentIte
 
   // Filter components
   RteComponentMap filteredComponents;
-  vector<string> filteredIds;
   string componentDescriptor = item.component;
 
   set<string> filterSet;
@@ -1937,16 +2075,7 @@ RteComponent* ProjMgrWorker::ProcessComponent(ContextItem& context, ComponentIte
     freeText = true;
   }
 
-  vector<string> componentIdVec;
-  componentIdVec.reserve(componentMap.size());
-  for (auto [componentId, _] :componentMap) {
-    componentIdVec.push_back(componentId);
-  }
-  RteUtils::ApplyFilter(componentIdVec, filterSet, filteredIds);
-  for (const auto& filteredId : filteredIds) {
-    auto c = componentMap[filteredId];
-    filteredComponents[filteredId] = c;
-  }
+  componentIndex.ApplyFilter(filterSet, filteredComponents);
 
   // Multiple matches, search best matched identifier
   if (filteredComponents.size() > 1) {
@@ -2042,7 +2171,7 @@ void ProjMgrWorker::CheckAndGenerateRegionsHeader(ContextItem& context) {
     }
   }
   if (!RteFsUtils::Exists(regionsHeader)) {
-    m_missingFiles.insert({ regionsHeader, FileNode() });
+    UpdateSolutionData([this, regionsHeader]() { m_missingFiles.insert({ regionsHeader, FileNode() }); });
   }
 }
 
@@ -2460,13 +2589,15 @@ bool ProjMgrWorker::ProcessExecutes(ContextItem& context, bool solutionLevel) {
   for (const auto& item : executes) {
     if (solutionLevel || CheckContextFilters(item.typeFilter, context)) {
       const string& execute = (solutionLevel ? "" : context.name + "-") + ProjMgrUtils::ReplaceDelimiters(item.execute);
-      m_executes[execute] = item;
-      m_executes[execute].execute = execute;
+      ExecutesItem executeItem = item;
+      executeItem.execute = execute;
       // expand access sequences
-      m_executes[execute].run = RteUtils::ExpandAccessSequences(m_executes[execute].run, IOSeqMap);
-      m_executes[execute].run = RteUtils::ExpandAccessSequences(m_executes[execute].run, context.variables);
-      if (!ProcessSequencesRelatives(context, m_executes[execute].input, ref, outDir, true, solutionLevel) ||
-        !ProcessSequencesRelatives(context, m_executes[execute].output, ref, outDir, true, solutionLevel)) {
+      executeItem.run = RteUtils::ExpandAccessSequences(executeItem.run, IOSeqMap);
+      executeItem.run = RteUtils::ExpandAccessSequences(executeItem.run, context.variables);
+      const bool success = ProcessSequencesRelatives(context, executeItem.input, ref, outDir, true, solutionLevel) &&
+        ProcessSequencesRelatives(context, executeItem.output, ref, outDir, true, solutionLevel);
+      UpdateSolutionData([this, execute, executeItem]() { m_executes[execute] = executeItem; });
+      if (!success) {
         return false;
       }
     }
@@ -3513,7 +3644,7 @@ bool ProjMgrWorker::AddFile(const FileNode& src, vector<FileNode>& dst, ContextI
     if (!ProjMgrUtils::HasAccessSequence(src.file)) {
       const string file = RteFsUtils::LexicallyNormal(fs::path(context.directories.cprj).append(srcNode.file).generic_string());
       if (!RteFsUtils::Exists(file)) {
-        m_missingFiles[file] = srcNode;
+        UpdateSolutionData([this, file, srcNode]() { m_missingFiles[file] = srcNode; });
       }
     }
   }
@@ -3577,7 +3708,7 @@ void ProjMgrWorker::CheckCompilerFilterSpelling(const string& compiler) {
       return;
     }
   }
-  CollectionUtils::PushBackUniquely(m_missingToolchains, compilerName);
+  UpdateSolutionData([this, compilerName]() { CollectionUtils::PushBackUniquely(m_missingToolchains, compilerName); });
 }
 
 bool ProjMgrWorker::CheckType(const TypeFilter& typeFilter, const vector<TypePair>& typeVec) {
@@ -3695,12 +3826,12 @@ void ProjMgrWorker::CheckTypeFilterSpelling(const TypeFilter& typeFilter) {
       if (!typePair.build.empty() &&
         find(m_types.allBuildTypes.begin(), m_types.allBuildTypes.end(), typePair.build) == m_types.allBuildTypes.end()) {
         bool misspelled = find(m_types.allTargetTypes.begin(), m_types.allTargetTypes.end(), typePair.build) != m_types.allTargetTypes.end();
-        m_types.missingBuildTypes[typePair.build] = misspelled;
+        UpdateSolutionData([this, typePair, misspelled]() { m_types.missingBuildTypes[typePair.build] = misspelled; });
       }
       if (!typePair.target.empty() &&
         find(m_types.allTargetTypes.begin(), m_types.allTargetTypes.end(), typePair.target) == m_types.allTargetTypes.end()) {
         bool misspelled = find(m_types.allBuildTypes.begin(), m_types.allBuildTypes.end(), typePair.target) != m_types.allBuildTypes.end();
-        m_types.missingTargetTypes[typePair.target] = misspelled;
+        UpdateSolutionData([this, typePair, misspelled]() { m_types.missingTargetTypes[typePair.target] = misspelled; });
       }
     }
   }
@@ -3730,9 +3861,7 @@ bool ProjMgrWorker::ProcessContext(ContextItem& context, bool loadGenFiles, bool
   if (!SetTargetAttributes(context, context.targetAttributes)) {
     return false;
   }
-  ret &= ProcessLinkerOptions(context);
-  ret &= ProcessGroups(context);
-  ret &= ProcessComponents(context);
+  ret &= ProcessContextComponents(context);
   if (loadGenFiles) {
     ret &= ProcessGpdsc(context);
     ret &= ProcessGeneratedLayers(context);
@@ -3741,6 +3870,20 @@ bool ProjMgrWorker::ProcessContext(ContextItem& context, bool loadGenFiles, bool
   if (!context.linker.regions.empty()) {
     CheckAndGenerateRegionsHeader(context);
   }
+  ret &= CompleteContext(context, resolveDependencies);
+  return ret;
+}
+
+bool ProjMgrWorker::ProcessContextComponents(ContextItem& context) {
+  bool ret = true;
+  ret &= ProcessLinkerOptions(context);
+  ret &= ProcessGroups(context);
+  ret &= ProcessComponents(context);
+  return ret;
+}
+
+bool ProjMgrWorker::CompleteContext(ContextItem& context, bool resolveDependencies) {
+  bool ret = true;
   ret &= ProcessConfigFiles(context);
   ret &= ProcessComponentFiles(context);
   ret &= ProcessExecutes(context);
@@ -3768,6 +3911,148 @@ bool ProjMgrWorker::ProcessContext(ContextItem& context, bool loadGenFiles, bool
   return ret;
 }
 
+void ProjMgrWorker::ProcessContexts(const vector<ContextItem*>& contexts, bool loadGenFiles, bool resolveDependencies,
+  bool updateRteFiles, bool parallel, const function<void(ContextItem&, bool)>& processed) {
+  const ThreadPool pool(m_jobs);
+  if (!parallel || pool.GetWorkerCount(contexts.size()) < 2) {
+    for (auto context : contexts) {
+      processed(*context, ProcessContext(*context, loadGenFiles, resolveDependencies, updateRteFiles));
+    }
+    return;
+  }
+
+  // Steps modifying the global model or reading other contexts run sequentially in context order,
+  // the remaining steps run in parallel. Messages and solution-wide data of each context are kept
+  // separately and merged in context order, the output is the same as for sequential processing.
+  struct ContextState {
+    ProjMgrLoggerCapture logger;
+    ProjMgrCallback::Messages rteMessages;
+    vector<function<void()>> updates;
+    size_t inheritedErrors = 0; // leading rteMessages errors reported before the context
+    bool targetInitialized = false;
+    bool aborted = false;
+    bool ret = true;
+  };
+  vector<ContextState> states(contexts.size());
+  ProjMgrLogger::Get(); // create logger instance before it is used by worker threads
+
+  // RTE model errors are not cleared once reported, they are seen by all subsequent contexts.
+  // Pending warnings are reported by the first context.
+  ProjMgrCallback* callback = m_kernel ? m_kernel->GetCallback() : nullptr;
+  const list<string> pendingErrors = callback ? callback->GetErrorMessages() : list<string>();
+  if (callback) {
+    states.front().rteMessages.warnings = callback->GetWarningMessages();
+    callback->ClearWarningMessages();
+  }
+  auto inheritErrors = [&](size_t index) {
+    list<string> inherited = pendingErrors;
+    for (size_t i = 0; i < index; i++) {
+      const auto& errors = states[i].rteMessages.errors;
+      inherited.insert(inherited.end(), next(errors.begin(), states[i].inheritedErrors), errors.end());
+    }
+    auto& errors = states[index].rteMessages.errors;
+    errors.erase(errors.begin(), next(errors.begin(), states[index].inheritedErrors));
+    states[index].inheritedErrors = inherited.size();
+    errors.splice(errors.begin(), inherited);
+  };
+  auto runStep = [&](size_t index, const function<void(ContextItem&, ContextState&)>& step) {
+    ContextState& state = states[index];
+    if (state.aborted) {
+      return;
+    }
+    state.logger.Start();
+    ProjMgrCallback::SetThreadMessages(&state.rteMessages);
+    theDeferredUpdates = &state.updates;
+    // string expansion in the RTE model refers to the active project
+    ContextItem& context = *contexts[index];
+    RteGlobalModel::SetThreadActiveProjectId(context.rteActiveProject ? context.rteActiveProject->GetProjectId() : -1);
+    step(context, state);
+    RteGlobalModel::SetThreadActiveProjectId(-1);
+    theDeferredUpdates = nullptr;
+    ProjMgrCallback::SetThreadMessages(nullptr);
+    state.logger.Stop();
+  };
+  auto runSequential = [&](const function<void(ContextItem&, ContextState&)>& step) {
+    for (size_t i = 0; i < contexts.size(); i++) {
+      inheritErrors(i);
+      runStep(i, step);
+    }
+  };
+  auto runParallel = [&](const function<void(ContextItem&, ContextState&)>& step) {
+    pool.ForEach(contexts.size(), [&](size_t index, size_t) { runStep(index, step); });
+  };
+
+  // create targets and load packs
+  runSequential([&](ContextItem& context, ContextState& state) {
+    state.targetInitialized = InitializeContextTarget(context);
+    state.ret = state.targetInitialized;
+  });
+  runParallel([&](ContextItem& context, ContextState& state) {
+    if (state.targetInitialized) {
+      state.ret = FilterContextPacks(context);
+    }
+  });
+  // precedences can refer to other contexts
+  runSequential([&](ContextItem& context, ContextState& state) {
+    context.rteActiveProject->SetAttribute("update-rte-files", updateRteFiles ? "1" : "0");
+    if (!ProcessPrecedences(context, BoardOrDevice::Both)) {
+      state.ret = false;
+      state.aborted = true;
+    }
+  });
+  runParallel([&](ContextItem& context, ContextState& state) {
+    if (!SetTargetAttributes(context, context.targetAttributes)) {
+      state.ret = false;
+      state.aborted = true;
+      return;
+    }
+    state.ret &= ProcessContextComponents(context);
+  });
+  // generators can load additional packs, regions headers can be shared by contexts
+  runSequential([&](ContextItem& context, ContextState& state) {
+    if (loadGenFiles) {
+      state.ret &= ProcessGpdsc(context);
+      state.ret &= ProcessGeneratedLayers(context);
+    }
+    if (!context.linker.regions.empty()) {
+      CheckAndGenerateRegionsHeader(context);
+    }
+  });
+  runParallel([&](ContextItem& context, ContextState& state) {
+    state.ret &= CompleteContext(context, resolveDependencies);
+  });
+
+  // merge results in context order
+  StrVec contextNames;
+  for (size_t i = 0; i < contexts.size(); i++) {
+    ContextState& state = states[i];
+    for (const auto& update : state.updates) {
+      update();
+    }
+    state.logger.Replay();
+    if (callback) {
+      const auto& errors = state.rteMessages.errors;
+      for (auto it = next(errors.begin(), state.inheritedErrors); it != errors.end(); it++) {
+        callback->OutputErrMessage(*it);
+      }
+      for (const auto& msg : state.rteMessages.warnings) {
+        callback->OutputMessage(msg);
+      }
+    }
+    contextNames.push_back(contexts[i]->name);
+    processed(*contexts[i], state.ret);
+  }
+  m_extGenerator->SortUsedGenerators(contextNames);
+}
+
+void ProjMgrWorker::UpdateSolutionData(const function<void()>& update) {
+  if (theDeferredUpdates) {
+    theDeferredUpdates->push_back(update);
+  } else {
+    update();
+  }
+}
+
 bool ProjMgrWorker::ListPacks(vector<string>&packs, bool bListMissingPacksOnly, const string& filter) {
   map<string, string, RtePackageComparator> packsMap;
   list<string> pdscFiles;
@@ -4510,10 +4795,12 @@ bool ProjMgrWorker::ParseContextSelection(
     }
 
     // Parse context layers
+    vector<ContextItem*> selectedContexts;
     for (const auto& context : m_selectedContexts) {
-      if (!ParseContextLayers(m_contexts[context])) {
-        return false;
-      }
+      selectedContexts.push_back(&m_contexts[context]);
+    }
+    if (!ParseContextLayers(selectedContexts)) {
+      return false;
     }
   }
 
@@ -4951,16 +5238,18 @@ bool ProjMgrWorker::ProcessGlobalGenerators(ContextItem* selectedContext, const
 
   // iterate over contexts with same build and target types
   m_selectedContexts.clear();
+  vector<ContextItem*> selectedContexts;
   for (auto& [_, context] : m_contexts) {
     if ((context.type.build != selectedContext->type.build) ||
       (context.type.target != selectedContext->type.target)) {
       continue;
     }
-    if (!ParseContextLayers(context)) {
-      return false;
-    }
+    selectedContexts.push_back(&context);
     m_selectedContexts.push_back(context.name);
   }
+  if (!ParseContextLayers(selectedContexts)) {
+    return false;
+  }
   for (auto& context : m_selectedContexts) {
     if (!ProcessContext(m_contexts.at(context), false, true, false)) {
       return false;
@@ -5281,7 +5570,7 @@ void ProjMgrWorker::CheckMissingLinkerScript(ContextItem& context) {
       RteFsUtils::NormalizePath(script, context.directories.cprj);
     }
     if (!RteFsUtils::Exists(script)) {
-      m_missingFiles.insert({ script, FileNode() });
+      UpdateSolutionData([this, script]() { m_missingFiles.insert({ script, FileNode() }); });
     }
   }
 }
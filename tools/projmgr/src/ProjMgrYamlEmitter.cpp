@@ -12,8 +12,12 @@
 #include "ProjMgrWorker.h"
 #include "RteFsUtils.h"
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
 
 using namespace std;
 
@@ -51,8 +55,17 @@ bool ProjMgrYamlEmitter::WriteFile(YAML::Node& rootNode, const std::string& file
     else {
       ProjMgrLogger::Get().Info("file skipped", context, filename);
     }
+    return true;
   }
-  else if (!CompareFile(filename, rootNode)) {
+
+  // Emit yaml contents once, the same buffer is compared, written and validated
+  YAML::Emitter emitter;
+  emitter.SetNullFormat(YAML::EmptyNull);
+  emitter.SetIntBase(YAML::Hex);
+  emitter << rootNode;
+  const string content = string(emitter.c_str()) + '\n';
+
+  if (!CompareFile(filename, content)) {
     if (!allowUpdate) {
       ProjMgrLogger::Get().Error("file not allowed to be updated", context, filename);
       return false;
@@ -61,23 +74,14 @@ bool ProjMgrYamlEmitter::WriteFile(YAML::Node& rootNode, const std::string& file
       ProjMgrLogger::Get().Error("destination directory cannot be created", context, filename);
       return false;
     }
-    ofstream fileStream(filename);
-    if (!fileStream) {
+    if (!WriteFileAtomically(filename, content)) {
       ProjMgrLogger::Get().Error("file cannot be written", context, filename);
       return false;
     }
-    YAML::Emitter emitter;
-    emitter.SetNullFormat(YAML::EmptyNull);
-    emitter.SetIntBase(YAML::Hex);
-    emitter << rootNode;
-    fileStream << emitter.c_str();
-    fileStream << endl;
-    fileStream << flush;
-    fileStream.close();
     ProjMgrLogger::Get().Info("file generated successfully", context, filename);
 
     // Check generated file schema
-    if (m_checkSchema && !ProjMgrYamlSchemaChecker().Validate(filename)) {
+    if (m_checkSchema && !ProjMgrYamlSchemaChecker().ValidateContent(filename, content)) {
       return false;
     }
   }
@@ -87,26 +91,71 @@ bool ProjMgrYamlEmitter::WriteFile(YAML::Node& rootNode, const std::string& file
   return true;
 }
 
-bool ProjMgrYamlEmitter::CompareFile(const string& filename, const YAML::Node& rootNode) {
+bool ProjMgrYamlEmitter::WriteFileAtomically(const string& filename, const string& content) {
+  // write to a temporary file in the same directory first: readers never see an incomplete file
+  stringstream tmpFile;
+  tmpFile << filename << ".tmp" << hex << hash<thread::id>()(this_thread::get_id())
+    << chrono::steady_clock::now().time_since_epoch().count();
+  {
+    ofstream fileStream(tmpFile.str());
+    if (!fileStream) {
+      return false;
+    }
+    fileStream << content << flush;
+    if (!fileStream.good()) {
+      fileStream.close();
+      RteFsUtils::RemoveFile(tmpFile.str());
+      return false;
+    }
+  }
+  error_code ec;
+  filesystem::rename(tmpFile.str(), filename, ec);
+  if (ec) {
+    RteFsUtils::RemoveFile(tmpFile.str());
+    return false;
+  }
+  return true;
+}
+
+static string EraseGeneratedBy(const string& inStr) {
+  // remove generated-by node from the string
+  string outStr = inStr;
+  size_t startIndex = outStr.find(YAML_GENERATED_BY, 0);
+  size_t endIndex = outStr.find('\n', startIndex);
+  if (startIndex != std::string::npos && endIndex != std::string::npos) {
+    outStr = outStr.erase(startIndex, endIndex - startIndex);
+  }
+  return outStr;
+}
+
+bool ProjMgrYamlEmitter::CompareFile(const string& filename, const string& content) {
   if (!RteFsUtils::Exists(filename)) {
     return false;
   }
-  const YAML::Node& yamlRoot = YAML::LoadFile(filename);
-  return CompareNodes(yamlRoot, rootNode);
+  // read existing file in text mode as it has been written
+  ifstream fileStream(filename);
+  if (!fileStream) {
+    return false;
+  }
+  stringstream existing;
+  existing << fileStream.rdbuf();
+  fileStream.close();
+  const string existingContent = EraseGeneratedBy(existing.str());
+  const string newContent = EraseGeneratedBy(content);
+  if (existingContent == newContent) {
+    // unchanged file: no parsing needed
+    return true;
+  }
+  // differently formatted file: compare the yaml contents, the new content is emitted with the same settings
+  const YAML::Node& yamlRoot = YAML::Load(existing.str());
+  YAML::Emitter emitter;
+  emitter.SetNullFormat(YAML::EmptyNull);
+  emitter.SetIntBase(YAML::Hex);
+  emitter << yamlRoot;
+  return EraseGeneratedBy(string(emitter.c_str()) + '\n') == newContent;
 }
 
 bool ProjMgrYamlEmitter::CompareNodes(const YAML::Node& lhs, const YAML::Node& rhs) {
-  auto eraseGenNode = [](const string& inStr) {
-    size_t startIndex, endIndex;
-    string outStr = inStr;
-    startIndex = outStr.find(YAML_GENERATED_BY, 0);
-    endIndex = outStr.find('\n', startIndex);
-    if (startIndex != std::string::npos && endIndex != std::string::npos) {
-      outStr = outStr.erase(startIndex, endIndex - startIndex);
-    }
-    return outStr;
-  };
-
   YAML::Emitter lhsEmitter, rhsEmitter;
   string lhsData, rhsData;
 
@@ -115,8 +164,8 @@ bool ProjMgrYamlEmitter::CompareNodes(const YAML::Node& lhs, const YAML::Node& r
   rhsEmitter << rhs;
 
   // remove generated-by node from the string
-  lhsData = eraseGenNode(lhsEmitter.c_str());
-  rhsData = eraseGenNode(rhsEmitter.c_str());
+  lhsData = EraseGeneratedBy(lhsEmitter.c_str());
+  rhsData = EraseGeneratedBy(rhsEmitter.c_str());
 
   return (lhsData == rhsData) ? true : false;
 }
@@ -10,11 +10,22 @@
 #include "ProjMgrYamlSchemaChecker.h"
 
 #include "RteFsUtils.h"
+#include <mutex>
 #include <regex>
 #include <string>
 
 using namespace std;
 
+// loaded yml files mapped by file name, the cache is enabled in server mode
+struct YamlCacheEntry {
+  fs::file_time_type time;
+  bool schemaChecked;
+  YAML::Node root;
+};
+static bool theYamlCacheEnabled = false;
+static map<string, YamlCacheEntry> theYamlCache;
+static mutex theYamlCacheMutex;
+
 ProjMgrYamlParser::ProjMgrYamlParser(void) {
   // Reserved
 }
@@ -26,15 +37,15 @@ ProjMgrYamlParser::~ProjMgrYamlParser(void) {
 bool ProjMgrYamlParser::ParseCdefault(const string& input,
   CdefaultItem& cdefault, bool checkSchema) {
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate schema
+    YAML::Node node;
+    if (!LoadYamlFile(input, checkSchema, node)) {
       return false;
     }
 
     cdefault.path = RteFsUtils::MakePathCanonical(input);
 
-    const YAML::Node& root = YAML::LoadFile(input);
+    const YAML::Node& root = node;
     if (!ValidateCdefault(input, root)) {
       return false;
     }
@@ -68,9 +79,9 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
   }
 
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate schema
+    YAML::Node node;
+    if (!LoadYamlFile(input, checkSchema, node)) {
       return false;
     }
 
@@ -78,7 +89,7 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
     csolution.directory = RteFsUtils::ParentPath(csolution.path);
     csolution.name = fs::path(input).stem().stem().generic_string();
 
-    const YAML::Node& root = YAML::LoadFile(input);
+    const YAML::Node& root = node;
     if (!ValidateCsolution(input, root)) {
       return false;
     }
@@ -128,9 +139,9 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
 bool ProjMgrYamlParser::ParseCbuildPack(const string& input,
   CbuildPackItem& cbuildPack, bool checkSchema) {
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate schema
+    YAML::Node node;
+    if (!LoadYamlFile(input, checkSchema, node)) {
       return false;
     }
 
@@ -138,7 +149,7 @@ bool ProjMgrYamlParser::ParseCbuildPack(const string& input,
     cbuildPack.directory = RteFsUtils::ParentPath(cbuildPack.path);
     cbuildPack.name = fs::path(input).stem().stem().stem().generic_string();
 
-    const YAML::Node& root = YAML::LoadFile(input);
+    const YAML::Node& root = node;
     if (!ValidateCbuildPack(input, root)) {
       return false;
     }
@@ -159,13 +170,13 @@ bool ProjMgrYamlParser::ParseCproject(const string& input,
   bool single, bool checkSchema) {
   CprojectItem cproject;
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate schema
+    YAML::Node node;
+    if (!LoadYamlFile(input, checkSchema, node)) {
       return false;
     }
 
-    const YAML::Node& root = YAML::LoadFile(input);
+    const YAML::Node& root = node;
     if (!ValidateCproject(input, root)) {
       return false;
     }
@@ -227,14 +238,13 @@ bool ProjMgrYamlParser::ParseClayer(const string& input,
   }
   ClayerItem clayer;
   try {
-    // Validate file schema
-    if (checkSchema) {
-      if (!ProjMgrYamlSchemaChecker().Validate(input)) {
-        return false;
-      }
+    // Load file and validate schema
+    YAML::Node node;
+    if (!LoadYamlFile(input, checkSchema, node)) {
+      return false;
     }
 
-    const YAML::Node& root = YAML::LoadFile(input);
+    const YAML::Node& root = node;
     const bool cgen = fs::path(input).stem().extension().generic_string() == ".cgen";
     if (!cgen && !ValidateClayer(input, root)) {
       return false;
@@ -281,13 +291,14 @@ bool ProjMgrYamlParser::ParseClayer(const string& input,
 }
 
 bool ProjMgrYamlParser::ParseCbuildSet(const string& input, CbuildSetItem& cbuildSet, bool checkSchema) {
-  // Validate file schema
-  if (!ProjMgrYamlSchemaChecker().Validate(input)) {
-    return false;
-  }
-
   try {
-    const YAML::Node& root = YAML::LoadFile(input);
+    // Load file and validate schema
+    YAML::Node node;
+    if (!LoadYamlFile(input, true, node)) {
+      return false;
+    }
+
+    const YAML::Node& root = node;
     if (checkSchema && !ValidateCbuildSet(input, root)) {
       return false;
     }
@@ -1403,6 +1414,42 @@ const map<string, set<string>> mappings = {
   {YAML_RTE, rteKeys},
 };
 
+void ProjMgrYamlParser::EnableCache(bool enable) {
+  lock_guard<mutex> lock(theYamlCacheMutex);
+  theYamlCacheEnabled = enable;
+  theYamlCache.clear();
+}
+
+bool ProjMgrYamlParser::LoadYamlFile(const string& input, bool checkSchema, YAML::Node& root) {
+  error_code ec;
+  fs::file_time_type time;
+  {
+    lock_guard<mutex> lock(theYamlCacheMutex);
+    if (theYamlCacheEnabled) {
+      time = fs::last_write_time(input, ec);
+      auto it = theYamlCache.find(input);
+      if (!ec && it != theYamlCache.end() && it->second.time == time && (it->second.schemaChecked || !checkSchema)) {
+        // callers get their own copy, the cached node stays unmodified
+        root = YAML::Clone(it->second.root);
+        return true;
+      }
+    }
+  }
+  if (checkSchema) {
+    // schema checker validates the loaded data, the file is read only once
+    if (!ProjMgrYamlSchemaChecker().Validate(input, root)) {
+      return false;
+    }
+  } else {
+    root = YAML::LoadFile(input);
+  }
+  lock_guard<mutex> lock(theYamlCacheMutex);
+  if (theYamlCacheEnabled && !ec) {
+    theYamlCache[input] = { time, checkSchema, YAML::Clone(root) };
+  }
+  return true;
+}
+
 bool ProjMgrYamlParser::ValidateCdefault(const string& input, const YAML::Node& root) {
   const set<string> rootKeys = {
     YAML_DEFAULT,
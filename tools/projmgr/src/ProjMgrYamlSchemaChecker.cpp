@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -38,6 +38,49 @@ bool ProjMgrYamlSchemaChecker::Validate(const std::string& file)
     return result;
 }
 
+bool ProjMgrYamlSchemaChecker::Validate(const std::string& file, YAML::Node& root)
+{
+  // Check if the input file exist
+  if (!RteFsUtils::Exists(file)) {
+    ProjMgrLogger::Get().Error("file doesn't exist", "", file);
+    return false;
+  }
+  return ValidateNode(file, root, false);
+}
+
+bool ProjMgrYamlSchemaChecker::ValidateContent(const std::string& file, const std::string& content)
+{
+  YAML::Node root;
+  try {
+    root = YAML::Load(content);
+  }
+  catch (YAML::Exception& e) {
+    ProjMgrLogger::Get().Error("schema check failed, verify syntax", "", file, e.mark.line + 1, e.mark.column + 1);
+    return false;
+  }
+  return ValidateNode(file, root, true);
+}
+
+bool ProjMgrYamlSchemaChecker::ValidateNode(const std::string& file, YAML::Node& root, bool loaded)
+{
+  string schemaFile = FindSchema(file);
+  if (schemaFile.empty()) {
+    ProjMgrLogger::Get().Warn("yaml schemas were not found, file cannot be validated", "", file);
+    if (!loaded) {
+      root = YAML::LoadFile(file);
+    }
+    return true;
+  }
+
+  ClearErrors();
+  // Load and validate schema
+  bool result = loaded ? ValidateData(root, file, schemaFile) : ValidateFile(file, schemaFile, root);
+  for (auto& err : GetErrors()) {
+    ProjMgrLogger::Get().Error(err.m_msg, "", err.m_file, err.m_line, err.m_col);
+  }
+  return result;
+}
+
 std::string ProjMgrYamlSchemaChecker::FindSchema(const std::string& file) const
 {
   // Get current exe path
@@ -489,3 +489,22 @@ TEST_F(ProjMgrSchemaCheckerUnitTests, SchemaCheck_CbuildSet_Contexts) {
     EXPECT_TRUE(errList.end() != errItr);
   }
 }
+
+TEST_F(ProjMgrSchemaCheckerUnitTests, SchemaCheck_Content) {
+  string content;
+  const string& filename = testinput_folder + "/TestProject/test.cproject.yml";
+  EXPECT_TRUE(RteFsUtils::ReadFile(filename, content));
+  EXPECT_TRUE(ValidateContent(filename, content));
+  EXPECT_TRUE(GetErrors().empty());
+
+  const string& failedFilename = testinput_folder +
+    "/TestProject/test_schema_validation_failed.cproject.yml";
+  EXPECT_TRUE(RteFsUtils::ReadFile(failedFilename, content));
+  EXPECT_FALSE(ValidateContent(failedFilename, content));
+  auto errList = GetErrors();
+  ASSERT_EQ(1, errList.size());
+  EXPECT_EQ(5, errList.front().m_line);
+  EXPECT_EQ(3, errList.front().m_col);
+
+  EXPECT_FALSE(ValidateContent(filename, "project: [\n"));
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ProjMgrServer.h"
+#include "ProjMgrKernel.h"
+#include "ProjMgrTestEnv.h"
+#include "RteFsUtils.h"
+
+#include "gtest/gtest.h"
+
+#include <regex>
+#include <sstream>
+
+using namespace std;
+using json = nlohmann::json;
+
+class ProjMgrServerUnitTests : public ProjMgrServer, public ::testing::Test {
+protected:
+  ProjMgrServerUnitTests() : ProjMgrServer({}) {}
+  virtual ~ProjMgrServerUnitTests() {}
+
+  // stand-in client: sends the requests and returns the responses
+  vector<json> Send(const vector<json>& requests) {
+    stringstream in;
+    for (const auto& request : requests) {
+      in << request.dump() << "\n";
+    }
+    stringstream out;
+    EXPECT_TRUE(ProjMgrServer::Run(in, out));
+    vector<json> responses;
+    string line;
+    while (getline(out, line)) {
+      responses.push_back(json::parse(line));
+    }
+    return responses;
+  }
+
+  json Request(int id, const string& method, const json& params) {
+    return { {"jsonrpc", "2.0"}, {"id", id}, {"method", method}, {"params", params} };
+  }
+};
+
+TEST_F(ProjMgrServerUnitTests, ListContexts) {
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  const auto& responses = Send({
+    Request(1, "list contexts", { {"solution", csolution}, {"filter", "test1"} }),
+    { {"jsonrpc", "2.0"}, {"id", 2}, {"method", "shutdown"} },
+    Request(3, "list contexts", { {"solution", csolution} }),
+  });
+  ASSERT_EQ(2, responses.size());
+  EXPECT_EQ(1, responses[0]["id"]);
+  EXPECT_TRUE(responses[0]["result"]["success"].get<bool>());
+  EXPECT_EQ("test1.Debug+CM0\ntest1.Release+CM0\n", responses[0]["result"]["output"]);
+  EXPECT_EQ(2, responses[1]["id"]);
+  EXPECT_TRUE(responses[1]["result"].is_null());
+}
+
+TEST_F(ProjMgrServerUnitTests, ListComponents_KeepPacks) {
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  const json& request = Request(1, "list components", { {"solution", csolution}, {"context", "test1.Debug+CM0"},
+    {"filter", "Device:Startup"} });
+  const string& expected = "ARM::Device:Startup&RteTest Startup@2.0.3 (ARM::RteTest_DFP@0.2.0)\n";
+
+  auto responses = Send({ request });
+  ASSERT_EQ(1, responses.size());
+  EXPECT_EQ(expected, responses[0]["result"]["output"]);
+  ASSERT_NE(nullptr, ProjMgrKernel::Get());
+  const auto loadedPacks = ProjMgrKernel::Get()->GetPackRegistry()->GetLoadedPacks();
+  EXPECT_FALSE(loadedPacks.empty());
+
+  // packs loaded by the first request are reused
+  responses = Send({ request });
+  ASSERT_EQ(1, responses.size());
+  EXPECT_EQ(expected, responses[0]["result"]["output"]);
+  EXPECT_EQ(loadedPacks, ProjMgrKernel::Get()->GetPackRegistry()->GetLoadedPacks());
+}
+
+TEST_F(ProjMgrServerUnitTests, ListContexts_ModifiedFile) {
+  const string& csolution = testinput_folder + "/TestSolution/server.csolution.yml";
+  string content;
+  ASSERT_TRUE(RteFsUtils::ReadFile(testinput_folder + "/TestSolution/test.csolution.yml", content));
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(csolution, content));
+  const json& request = Request(1, "list contexts", { {"solution", csolution}, {"filter", "test1"} });
+
+  auto responses = Send({ request });
+  ASSERT_EQ(1, responses.size());
+  EXPECT_EQ("test1.Debug+CM0\ntest1.Release+CM0\n", responses[0]["result"]["output"]);
+
+  // modified file is read again
+  const auto time = fs::last_write_time(csolution);
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(csolution, regex_replace(content, regex("type: Release"), "type: Develop")));
+  fs::last_write_time(csolution, time + chrono::seconds(10));
+  responses = Send({ request });
+  ASSERT_EQ(1, responses.size());
+  EXPECT_EQ("test1.Debug+CM0\ntest1.Develop+CM0\n", responses[0]["result"]["output"]);
+
+  RteFsUtils::RemoveFile(csolution);
+}
+
+TEST_F(ProjMgrServerUnitTests, HandleRequest_Errors) {
+  EXPECT_EQ(-32700, HandleRequest("{ invalid")["error"]["code"]);
+  EXPECT_EQ(-32600, HandleRequest("[]")["error"]["code"]);
+  EXPECT_EQ(-32600, HandleRequest(R"({"id": 1, "method": "list packs"})")["error"]["code"]);
+
+  json response = HandleRequest(R"({"jsonrpc": "2.0", "id": 1, "method": "run"})");
+  EXPECT_EQ(1, response["id"]);
+  EXPECT_EQ(-32601, response["error"]["code"]);
+  EXPECT_EQ(-32602, HandleRequest(R"({"jsonrpc": "2.0", "id": 2, "method": "list packs", "params": ["-s"]})")["error"]["code"]);
+  EXPECT_EQ(-32602, HandleRequest(R"({"jsonrpc": "2.0", "id": 3, "method": "list packs", "params": {"solution": 1.5}})")["error"]["code"]);
+  EXPECT_EQ(-32602, HandleRequest(R"({"jsonrpc": "2.0", "id": 4, "method": "list packs", "params": {"--solution": "a"}})")["error"]["code"]);
+
+  // notifications are not answered
+  EXPECT_TRUE(HandleRequest(R"({"jsonrpc": "2.0", "method": "run"})").is_null());
+}
+
+TEST_F(ProjMgrServerUnitTests, Run_ContentLength) {
+  const string& request = Request(7, "list contexts", {
+    {"solution", testinput_folder + "/TestSolution/test.csolution.yml"}, {"filter", "test2"} }).dump();
+  stringstream in;
+  in << "Content-Length: " << request.size() << "\r\n\r\n" << request;
+  stringstream out;
+  EXPECT_TRUE(ProjMgrServer::Run(in, out));
+
+  string header;
+  getline(out, header);
+  EXPECT_EQ(0, header.find("Content-Length: "));
+  const size_t length = stoul(header.substr(16));
+  getline(out, header);
+  EXPECT_EQ("\r", header);
+  string message(length, '\0');
+  ASSERT_TRUE(out.read(message.data(), length));
+  const json& response = json::parse(message);
+  EXPECT_EQ(7, response["id"]);
+  EXPECT_EQ("test2.Debug+CM0\ntest2.Debug+CM3\n", response["result"]["output"]);
+}
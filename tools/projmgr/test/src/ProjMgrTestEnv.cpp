@@ -137,6 +137,8 @@ void ProjMgrTestEnv::SetUp() {
   fs::copy(fs::path(srcInvalidPacks), fs::path(destInvalidPacks), fs::copy_options::recursive, ec);
 
   CrossPlatformUtils::SetEnv("CMSIS_PACK_ROOT", testcmsispack_folder);
+  // keep cached pack descriptions out of the source tree
+  CrossPlatformUtils::SetEnv("CMSIS_PACK_CACHE_DIR", RteFsUtils::GetCurrentFolder() + "packcache");
 
   // create dummy cmsis compiler root
   RteFsUtils::CreateDirectories(testcmsiscompiler_folder);
@@ -346,6 +346,25 @@ TEST_F(ProjMgrUnitTests, RunProjMgr_ListPacks_1) {
   EXPECT_EQ(outStr, expected);
 }
 
+TEST_F(ProjMgrUnitTests, RunProjMgr_ListPacks_PackCache) {
+  char* argv[4];
+  StdStreamRedirect streamRedirect;
+  const string packCacheDir = CrossPlatformUtils::GetEnv("CMSIS_PACK_CACHE_DIR");
+  ASSERT_FALSE(packCacheDir.empty());
+  RteFsUtils::RemoveDir(packCacheDir);
+  argv[1] = (char*)"list";
+  argv[2] = (char*)"packs";
+  EXPECT_EQ(0, RunProjMgr(3, argv, 0));
+  EXPECT_GT(RteFsUtils::CountFilesInFolder(packCacheDir), 0);
+  EXPECT_FALSE(RteFsUtils::Exists(testcmsispack_folder + "/.Local/.cache"));
+
+  // cache is not used with --no-pack-cache
+  RteFsUtils::RemoveDir(packCacheDir);
+  argv[3] = (char*)"--no-pack-cache";
+  EXPECT_EQ(0, RunProjMgr(4, argv, 0));
+  EXPECT_FALSE(RteFsUtils::Exists(packCacheDir));
+}
+
 TEST_F(ProjMgrUnitTests, RunProjMgr_ListPacks_project) {
   char* argv[7];
   StdStreamRedirect streamRedirect;
@@ -792,6 +811,82 @@ TEST_F(ProjMgrUnitTests, RunProjMgrSolution) {
     testinput_folder + "/TestSolution/ref/test.cbuild-pack.yml");
 }
 
+TEST_F(ProjMgrUnitTests, RunProjMgrSolution_UpToDateFiles) {
+  StdStreamRedirect streamRedirect;
+  char* argv[6];
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  const string& cbuild = testoutput_folder + "/test1.Debug+CM0.cbuild.yml";
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)testoutput_folder.c_str();
+  RteFsUtils::RemoveFile(cbuild);
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_NE(streamRedirect.GetOutString().find(cbuild + " - info csolution: file generated successfully"), string::npos);
+
+  // 2nd run: unchanged file is not rewritten
+  error_code ec;
+  const auto writeTime = fs::last_write_time(cbuild, ec);
+  streamRedirect.ClearStringStreams();
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_NE(streamRedirect.GetOutString().find(cbuild + " - info csolution: file is already up-to-date"), string::npos);
+  EXPECT_EQ(writeTime, fs::last_write_time(cbuild, ec));
+
+  // 3rd run: differently formatted file with the same contents is not rewritten
+  string content;
+  ASSERT_TRUE(RteFsUtils::ReadFile(cbuild, content));
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(cbuild, content + "# comment\n"));
+  streamRedirect.ClearStringStreams();
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_NE(streamRedirect.GetOutString().find(cbuild + " - info csolution: file is already up-to-date"), string::npos);
+  ASSERT_TRUE(RteFsUtils::ReadFile(cbuild, content));
+  EXPECT_NE(content.find("# comment"), string::npos);
+
+  // no temporary files are left behind
+  for (const auto& entry : fs::directory_iterator(testoutput_folder, ec)) {
+    EXPECT_EQ(entry.path().filename().string().find(".yml.tmp"), string::npos);
+  }
+}
+
+TEST_F(ProjMgrUnitTests, RunProjMgrSolution_ParallelContexts) {
+  char* argv[10];
+  StdStreamRedirect streamRedirect;
+
+  // convert --solution solution.yml --parallel-contexts -j 4
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)testoutput_folder.c_str();
+  argv[6] = (char*)"--parallel-contexts";
+  argv[7] = (char*)"-j";
+  argv[8] = (char*)"4";
+  argv[9] = (char*)"--cbuildgen";
+  EXPECT_EQ(0, RunProjMgr(10, argv, m_envp));
+
+  // Check generated cbuild YMLs are the same as for sequential processing
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test.cbuild-idx.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test.cbuild-idx.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Debug+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test1.Debug+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Release+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test1.Release+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test2.Debug+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM3.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test2.Debug+CM3.cbuild.yml");
+
+  // Check messages are reported in context order
+  const string& errStr = streamRedirect.GetErrorString();
+  const size_t cm0 = errStr.find("device 'RteTest_ARMCM0' does not support 'trustzone: non-secure'");
+  const size_t cm3 = errStr.find("device 'RteTest_ARMCM3' does not support 'trustzone: non-secure'");
+  EXPECT_NE(string::npos, cm0);
+  EXPECT_NE(string::npos, cm3);
+  EXPECT_LT(cm0, cm3);
+}
+
 TEST_F(ProjMgrUnitTests, RunProjMgrSolution_PositionalArguments) {
   char* argv[6];
   const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
@@ -2629,6 +2724,22 @@ TEST_F(ProjMgrUnitTests, ListPacks) {
   EXPECT_EQ(allPacks, expected);
 }
 
+TEST_F(ProjMgrUnitTests, ListPacks_Jobs) {
+  vector<string> packs;
+  EXPECT_TRUE(m_worker.ParseContextSelection({}));
+  m_worker.SetLoadPacksPolicy(LoadPacksPolicy::ALL);
+  m_worker.SetJobs(4);
+  EXPECT_TRUE(m_worker.ListPacks(packs, false, "RteTest"));
+  string allPacks;
+  for (auto& pack : packs) {
+    allPacks += pack + "\n";
+  }
+
+  auto pdscFiles = ProjMgrTestEnv::GetEffectivePdscFiles(false);
+  string expected = ProjMgrTestEnv::GetFilteredPacksString(pdscFiles, "*RteTest*");
+  EXPECT_EQ(allPacks, expected);
+}
+
 TEST_F(ProjMgrUnitTests, ListPacksLatest) {
   vector<string> packs;
   EXPECT_TRUE(m_worker.ParseContextSelection({}));
@@ -4806,6 +4917,7 @@ info csolution: config files for each component:\n\
     - .*/TestSolution/TestProject1/RTE/Device/RteTest_ARMCM0/ARMCM0_ac6.sct \\(base@1.0.0\\)\n\
     - .*/TestSolution/TestProject1/RTE/Device/RteTest_ARMCM0/startup_ARMCM0.c \\(base@2.0.1\\) \\(update@2.0.3\\)\n\
     - .*/TestSolution/TestProject1/RTE/Device/RteTest_ARMCM0/system_ARMCM0.c \\(base@1.0.0\\)\n\
+info csolution: condition filter results: [0-9]+ reused, [1-9][0-9]* evaluated\n\
 ";
 
   auto outStr = streamRedirect.GetOutString();
@@ -985,7 +985,7 @@ TEST_F(ProjMgrWorkerUnitTests, ProcessComponentFilesEmpty) {
   EXPECT_TRUE(ProcessComponentFiles(context));
 }
 
-TEST_F(ProjMgrWorkerUnitTests, GetAllCombinations) {
+TEST_F(ProjMgrWorkerUnitTests, VisitAllCombinations) {
   const string strOrangeA = "OrangeA";
   const string strOrangeB = "OrangeB";
   const string strOrangeC = "OrangeC";
@@ -1013,14 +1013,82 @@ TEST_F(ProjMgrWorkerUnitTests, GetAllCombinations) {
     {AnanasA, BananaB, OrangeC},
   };
   vector<ConnectionsCollectionVec> combinations;
-  GetAllCombinations(connections, connections.begin(), combinations);
+  EXPECT_TRUE(VisitCombinations(connections, [&](const ConnectionsCollectionVec& combination) {
+    combinations.push_back(combination);
+    return true;
+  }, false));
 
+  ASSERT_EQ(expected.size(), combinations.size());
   auto it = combinations.begin();
   for (const auto& expectedItem : expected) {
-    EXPECT_EQ(expectedItem.front().filename, (*it++).front().filename);
+    const auto& combination = *it++;
+    ASSERT_EQ(expectedItem.size(), combination.size());
+    for (size_t i = 0; i < expectedItem.size(); i++) {
+      EXPECT_EQ(expectedItem[i].filename, combination[i].filename);
+    }
   }
 }
 
+TEST_F(ProjMgrWorkerUnitTests, VisitCombinations) {
+  StrPairVec consumedList = {{ "Ananas", "1" }, { "Banana", "" }};
+  ConnectItem project  = { RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, StrPairVec(), consumedList };
+  ConnectItem ananas1  = { RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{ "Ananas", "1" }}, StrPairVec() };
+  ConnectItem ananas2  = { RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{ "Ananas", "2" }}, StrPairVec() };
+  ConnectItem banana   = { RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{ "Banana", "" }}, StrPairVec() };
+  ConnectItem cherry   = { RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{ "Cherry", "" }}, StrPairVec() };
+  const string strProject = "project.cproject.yml";
+  const string strAnanas1 = "ananas1.clayer.yml";
+  const string strAnanas2 = "ananas2.clayer.yml";
+  const string strBanana = "banana.clayer.yml";
+  const string strCherry = "cherry.clayer.yml";
+  const string strTypeA = "A";
+  const string strTypeB = "B";
+  ConnectionsCollectionMap connections = {
+    {"0", {{ strProject, RteUtils::EMPTY_STRING, { &project }}}},
+    {"A", {{ strAnanas1, strTypeA, { &ananas1 }}, { strAnanas2, strTypeA, { &ananas2 }}}},
+    {"B", {{ strBanana, strTypeB, { &banana }}, { strCherry, strTypeB, { &cherry }}}},
+  };
+  auto getFilenames = [](const ConnectionsCollectionVec& combination) {
+    StrVec filenames;
+    for (const auto& item : combination) {
+      filenames.push_back(item.filename);
+    }
+    return filenames;
+  };
+
+  // without pruning all combinations are visited
+  const vector<StrVec> expected = {
+    { strProject, strAnanas1, strBanana },
+    { strProject, strAnanas1, strCherry },
+    { strProject, strAnanas2, strBanana },
+    { strProject, strAnanas2, strCherry },
+  };
+  vector<StrVec> visited;
+  EXPECT_TRUE(VisitCombinations(connections, [&](const ConnectionsCollectionVec& combination) {
+    visited.push_back(getFilenames(combination));
+    return true;
+  }, false));
+  EXPECT_EQ(expected, visited);
+
+  // with pruning only the valid combination is visited:
+  // 'ananas2' is incompatible, 'cherry' leaves 'Banana' unprovided
+  visited.clear();
+  EXPECT_TRUE(VisitCombinations(connections, [&](const ConnectionsCollectionVec& combination) {
+    EXPECT_TRUE(ValidateConnections(combination).valid);
+    visited.push_back(getFilenames(combination));
+    return true;
+  }));
+  const vector<StrVec> expectedValid = {{ strProject, strAnanas1, strBanana }};
+  EXPECT_EQ(expectedValid, visited);
+
+  // the search stops when the visitor returns false
+  int count = 0;
+  EXPECT_FALSE(VisitCombinations(connections, [&](const ConnectionsCollectionVec&) {
+    return ++count < 2;
+  }, false));
+  EXPECT_EQ(2, count);
+}
+
 TEST_F(ProjMgrWorkerUnitTests, GetAllSelectCombinations) {
   ConnectItem connectA = { "A" };
   ConnectItem connectB = { "B" };
@@ -42,3 +42,41 @@ TEST_F(ProjMgrYamlParserUnitTests, ValidateCbuildSet) {
   invalidRoot["processor"] = "invalid";
   EXPECT_FALSE(ValidateCbuildSet(cbuildSetFile, invalidRoot));
 }
+
+TEST_F(ProjMgrYamlParserUnitTests, ParseCprojects_Parallel) {
+  StdStreamRedirect streamRedirect;
+  const string& dir = testinput_folder + "/TestSolution/";
+  const vector<string> cprojects = {
+    dir + "TestProject2/test2.cproject.yml",
+    dir + "TestProject1/test1.cproject.yml",
+    dir + "unknown.cproject.yml",
+    dir + "TestProject3/TestProject3.cproject.yml",
+  };
+  // projects are inserted and messages are output up to the first file that fails
+  ProjMgrParser parser;
+  EXPECT_FALSE(parser.ParseCprojects(cprojects, false, 4));
+  const auto& parsed = parser.GetCprojects();
+  EXPECT_EQ(2, parsed.size());
+  EXPECT_EQ(1, parsed.count(cprojects[0]));
+  EXPECT_EQ(1, parsed.count(cprojects[1]));
+  const string& errStr = streamRedirect.GetErrorString();
+  const size_t warnPos = errStr.find("test1.cproject.yml - warning csolution: 'device: Dname' is deprecated");
+  const size_t errorPos = errStr.find("unknown.cproject.yml - error");
+  ASSERT_NE(string::npos, warnPos);
+  ASSERT_NE(string::npos, errorPos);
+  EXPECT_LT(warnPos, errorPos);
+
+  EXPECT_TRUE(parser.ParseCprojects({ cprojects[3], cprojects[0] }, false, 4));
+  EXPECT_EQ(3, parsed.size());
+}
+
+TEST_F(ProjMgrYamlParserUnitTests, ParseClayers_Parallel) {
+  const string& dir = testinput_folder + "/TestLayers/";
+  const vector<string> clayers = { dir + "select.clayer.yml", dir + "config.clayer.yml", dir + "select.clayer.yml" };
+  ProjMgrParser parser;
+  vector<size_t> outputs;
+  EXPECT_TRUE(parser.ParseClayers(clayers, false, 4, [&](size_t index) { outputs.push_back(index); }));
+  EXPECT_EQ(vector<size_t>({ 0, 1, 2 }), outputs);
+  EXPECT_EQ(2, parser.GetClayers().size());
+  EXPECT_EQ("select", parser.GetClayers().at(clayers[0]).name);
+}
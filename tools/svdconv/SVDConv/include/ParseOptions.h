@@ -53,6 +53,9 @@ protected:
   bool SetShowMissingEnums();
   bool SetCreateFolder();
   bool SetSuppressPath();
+  bool SetJobs(unsigned jobs);
+  bool SetBatch(const std::string& batch);
+  bool SetBatchSummary(const std::string& filename);
 
 
   bool ParseOptGenerate(const std::string& opt);
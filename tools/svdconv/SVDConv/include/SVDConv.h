@@ -14,6 +14,7 @@
 #include <string>
 #include <set>
 #include <list>
+#include <vector>
 
 using json = nlohmann::json;
 
@@ -36,6 +37,8 @@ public:
 
   int Check(int argc, const char* argv[], const char* envp[]);
   SVD_ERR CheckSvdFile();
+  SVD_ERR CheckSvdFile(SvdOptions &svdOptions);
+  bool CheckBatch();
 
   void PrintDevice(SvdDevice *device);
   void PrintPeripheral(SvdPeripheral *const peri, const std::list<SvdInterrupt *> &interrupts);
@@ -43,9 +46,9 @@ public:
   void PrintRegistersClusters(const std::list<SvdItem *> &childs, int indent);
   void PrintRegisterWrapper(SvdRegister *reg, int indent);
   void PrintFieldWrapper(SvdField *const field, int indent);
-  void PrintEnumContainerWrapper(SvdEnumContainer *const enumContainer, int indent);
-  void PrintEnum(SvdEnum *const &enum_, int indent);
-  void PrintEnumContainer(SvdEnumContainer *const enumContainer, int indent);
+  void PrintEnumContainerWrapper(SvdEnumContainer *const enumContainer, const std::string &hierarchicalName, int indent);
+  void PrintEnum(SvdEnum *const &enum_, const std::string &hierarchicalName, int indent);
+  void PrintEnumContainer(SvdEnumContainer *const enumContainer, const std::string &hierarchicalName, int indent);
   void PrintClusterWrapper(SvdCluster *cluster, int indent);
   void PrintCluster(SvdCluster *cluster, int indent);
   void PrintRegister(SvdRegister *reg, int indent);
@@ -67,6 +70,7 @@ public:
 
 protected:
   bool InitMessageTable();
+  bool GetBatchFiles(const std::string &batch, std::vector<std::string> &files);
 
 private:
   SvdOptions m_svdOptions;
@@ -36,6 +36,10 @@ public:
   bool MakeSurePathExists(const std::string& path);
   bool SetOutFilenameOverride(const std::string& filename);
   const std::string& GetOutFilenameOverride() const;
+  bool SetBatch(const std::string& batch);
+  const std::string& GetBatch() const;
+  bool SetBatchSummary(const std::string& filename);
+  const std::string& GetBatchSummary() const;
 
   std::string GetCurrentDateTime();
   std::string GetHeader();
@@ -65,6 +69,7 @@ public:
   void SetGenerateMapPeripheral (bool bGenerateMapPeripheral    = true)   { m_bGenerateMapPeripheral  = bGenerateMapPeripheral  ; }
   void SetGenerateMapRegister   (bool bGenerateMapRegister      = true)   { m_bGenerateMapRegister    = bGenerateMapRegister    ; }
   void SetGenerateMapField      (bool bGenerateMapField         = true)   { m_bGenerateMapField       = bGenerateMapField       ; }
+  void SetJobs                  (unsigned jobs                  = 0)      { m_jobs                    = jobs                    ; }
 
 
   bool IsGenerateHeader         () const  { return m_bGenerateHeader         ; }
@@ -88,6 +93,7 @@ public:
   bool IsGenerateMapPeripheral  () const  { return m_bGenerateMapPeripheral  ; }
   bool IsGenerateMapRegister    () const  { return m_bGenerateMapRegister    ; }
   bool IsGenerateMapField       () const  { return m_bGenerateMapField       ; }
+  unsigned GetJobs              () const  { return m_jobs                    ; }
 
   bool IsGenerateMap() const;
 
@@ -114,12 +120,15 @@ private:
   bool m_bDebugStruct = false;
   bool m_bDebugHeaderfile = false;
   bool m_bDebugSfd = false;
+  unsigned m_jobs = 0;
 
   std::string m_svdToCheck;
   std::string m_logPath;
   std::string m_programName;
   std::string m_outputDir;
   std::string m_outfileOverride;
+  std::string m_batch;
+  std::string m_batchSummary;
 };
 
 #endif // PACKOPTIONS_H
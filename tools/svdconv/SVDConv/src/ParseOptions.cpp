@@ -264,6 +264,23 @@ bool ParseOptions::SetShowMissingEnums()
   return true;
 }
 
+bool ParseOptions::SetJobs(unsigned jobs)
+{
+  m_options.SetJobs(jobs);
+
+  return true;
+}
+
+bool ParseOptions::SetBatch(const string& batch)
+{
+  return m_options.SetBatch(batch);
+}
+
+bool ParseOptions::SetBatchSummary(const string& filename)
+{
+  return m_options.SetBatchSummary(filename);
+}
+
 bool ParseOptions::SetCreateFolder()
 {
   m_options.SetCreateFolder();
@@ -426,6 +443,9 @@ ParseOptions::Result ParseOptions::ParseOpts(int argc, const char* argv[])
       ( "create-folder"         , "Always create required folders"                            , cxxopts::value<bool>()->default_value("false") )
       ( "show-missingEnums"     , "Show SVD elements where enumerated values could be added"  , cxxopts::value<bool>()->default_value("false") )
       ( "strict"                , "Strict error checking (RECOMMENDED!)"                      , cxxopts::value<bool>()->default_value("false") )
+      ( "j,jobs"                , "Number of parallel jobs to check peripherals and generate files, 0 for number of hardware threads", cxxopts::value<unsigned>()->default_value("0") )
+      ( "batch"                 , "Check SVD files listed in a file (one per line) or matching a wild card pattern", cxxopts::value<string>() )
+      ( "batch-summary"         , "Write JSON summary of the batch check to file"              , cxxopts::value<string>() )
       ( "b,log"                 , "Log file"                                                  , cxxopts::value<string>() )
       ( "x,diag-suppress"       , "Suppress Messages"                                         , cxxopts::value<std::vector<std::string>>() )
       ( "suppress-warnings"     , "Suppress all WARNINGs"                                     , cxxopts::value<bool>()->default_value("false") )
@@ -572,6 +592,25 @@ ParseOptions::Result ParseOptions::ParseOpts(int argc, const char* argv[])
         bOk = false;
       }
     }
+    if(parseResult.count("jobs")) {
+      if(!SetJobs(parseResult["jobs"].as<unsigned>())) {
+        bOk = false;
+      }
+    }
+    if(parseResult.count("batch")) {
+      if(parseResult.count("input")) {
+        cerr << fileName << " error: option '--batch' cannot be used together with an input file" << endl;
+        bOk = false;
+      }
+      else if(!SetBatch(parseResult["batch"].as<string>())) {
+        bOk = false;
+      }
+    }
+    if(parseResult.count("batch-summary")) {
+      if(!SetBatchSummary(parseResult["batch-summary"].as<string>())) {
+        bOk = false;
+      }
+    }
   }
   catch (cxxopts::OptionException& e) {
     cerr << fileName << " error: " << e.what() << endl;
@@ -25,23 +25,30 @@
 #include "ProductInfo.h"
 #include "ParseOptions.h"
 #include "EnumStringTables.h"
+#include "ThreadPool.h"
+#include "RteUtils.h"
+#include "WildCards.h"
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <fstream>
 #include <ostream>
 #include <string>
 #include <set>
+#include <sstream>
 #include <list>
 #include <map>
 #include <csignal>
 #include <bitset>
+#include <functional>
+#include <memory>
+#include <vector>
 
 using namespace std;
 using json = nlohmann::json;
 
 #define WHITESPACES 4
 
-SvdModel* m_svdModel;
-
 std::ostream& operator<<(std::ostream& os, const SvdTypes::Access& access) {
   switch (access) {
     case SvdTypes::Access::UNDEF:
@@ -456,6 +463,7 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
     signal(s, Sighandler);  // catch fault
   }
 
+  bool bOk = true;
   try {
 #if 0   // Exception Test Code
     int *testPtr = (int *) 0x12345678;
@@ -492,7 +500,12 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
     ErrLog::Get()->CheckSuppressMessages();
     LogMsg("M061");  // Checking Package Description
 
-    CheckSvdFile();
+    if(!m_svdOptions.GetBatch().empty()) {
+      bOk = CheckBatch();
+    }
+    else {
+      CheckSvdFile();
+    }
   }
   catch(std::exception& e) {
     string criticalErrMsg = "STL exception occurred: ";
@@ -520,7 +533,7 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
     cout << "Found " << errCnt << " Error(s) and " << warnCnt << " Warning(s)." << endl;
   }
 
-  if(errCnt) {
+  if(errCnt || !bOk) {
     return 2;
   }
   else if(warnCnt) {
@@ -531,12 +544,158 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
 }
 
 SVD_ERR SvdConv::CheckSvdFile()
+{
+  return CheckSvdFile(m_svdOptions);
+}
+
+/**
+ * @brief collects the SVD files of a batch check
+ * @param batch list file with one SVD file per line, or wild card pattern for SVD files in a directory
+ * @param files list of SVD files to check
+ * @return passed / failed
+*/
+bool SvdConv::GetBatchFiles(const string &batch, vector<string> &files)
+{
+  const string batchPath = RteUtils::BackSlashesToSlashes(RteUtils::RemoveQuotes(batch));
+
+  if(WildCards::IsWildcardPattern(RteUtils::ExtractFileName(batchPath))) {
+    string dir = RteUtils::ExtractFilePath(batchPath, false);
+    if(dir.empty()) {
+      dir = ".";
+    }
+    list<string> fileNames;
+    RteFsUtils::GrepFileNames(fileNames, dir, RteUtils::ExtractFileName(batchPath));
+    files.assign(fileNames.begin(), fileNames.end());
+    sort(files.begin(), files.end());
+  }
+  else {
+    ifstream listFile(batchPath);
+    if(!listFile.is_open()) {
+      LogMsg("M123", PATH(batchPath));
+      return false;
+    }
+
+    string line;
+    while(getline(listFile, line)) {
+      line = RteUtils::Trim(line);
+      if(line.empty() || line[0] == '#') {
+        continue;
+      }
+      files.push_back(line);
+    }
+  }
+
+  if(files.empty()) {
+    LogMsg("M123", PATH(batchPath));
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief checks all SVD files of a batch concurrently, each file with its own options and model.
+ *        Messages are printed per file in the order of the batch, followed by the file's result.
+ * @return passed / failed
+*/
+bool SvdConv::CheckBatch()
+{
+  const uint32_t tAll = CrossPlatformUtils::ClockInMsec();
+
+  vector<string> files;
+  if(!GetBatchFiles(m_svdOptions.GetBatch(), files)) {
+    return false;
+  }
+
+  vector<unique_ptr<ErrLogCapture> > captures(files.size());
+  vector<uint32_t> times(files.size());
+  ThreadPool threadPool(m_svdOptions.GetJobs());
+  threadPool.ForEach(files.size(), [&](size_t index, size_t) {
+    captures[index] = make_unique<ErrLogCapture>();
+    captures[index]->Start();
+    const uint32_t t1 = CrossPlatformUtils::ClockInMsec();
+
+    SvdOptions svdOptions(m_svdOptions);
+    svdOptions.SetJobs(1);     // files are checked concurrently
+    if(svdOptions.SetFileUnderTest(files[index])) {
+      CheckSvdFile(svdOptions);
+    }
+
+    times[index] = CrossPlatformUtils::ClockInMsec() - t1;
+    captures[index]->Stop();
+  });
+
+  json summary;
+  summary["files"] = json::array();
+  ErrLog* errLog = ErrLog::Get();
+  const string prevFileName = errLog->GetFileName();
+  for(size_t index = 0; index < files.size(); index++) {
+    const int errCnt  = errLog->GetErrCnt();
+    const int warnCnt = errLog->GetWarnCnt();
+
+    // replay the captured messages one by one to record those counted as error or warning
+    json messages = json::array();
+    for(const auto& [msg, fileName] : captures[index]->GetMessages()) {
+      const int msgErrCnt  = errLog->GetErrCnt();
+      const int msgWarnCnt = errLog->GetWarnCnt();
+      errLog->SetFileName(fileName);
+      errLog->PDSC_PrintMessage(msg);
+      if(errLog->GetErrCnt() == msgErrCnt && errLog->GetWarnCnt() == msgWarnCnt) {
+        continue;
+      }
+      json message;
+      message["id"]    = msg.GetMsgNum();
+      message["level"] = errLog->GetErrCnt() != msgErrCnt ? "error" : "warning";
+      if(msg.GetLineNo() >= 0) {
+        message["line"] = msg.GetLineNo();
+      }
+      message["text"]  = msg.PDSC_FormatMessage();
+      messages.push_back(message);
+    }
+    errLog->SetFileName(prevFileName);
+    captures[index].reset();
+
+    const int fileErrCnt  = errLog->GetErrCnt()  - errCnt;
+    const int fileWarnCnt = errLog->GetWarnCnt() - warnCnt;
+    LogMsg("M042", PATH(files[index]), ERR(fileErrCnt), WARN(fileWarnCnt), TIME(times[index]));
+
+    json fileSummary;
+    fileSummary["file"]     = files[index];
+    fileSummary["result"]   = fileErrCnt ? "error" : fileWarnCnt ? "warning" : "ok";
+    fileSummary["errors"]   = fileErrCnt;
+    fileSummary["warnings"] = fileWarnCnt;
+    fileSummary["time"]     = times[index];
+    fileSummary["messages"] = messages;
+    summary["files"].push_back(fileSummary);
+  }
+
+  const uint32_t t2 = CrossPlatformUtils::ClockInMsec() - tAll;
+  LogMsg("M043", NUM((uint32_t)files.size()), TIME(t2));
+
+  const string& summaryFile = m_svdOptions.GetBatchSummary();
+  if(!summaryFile.empty()) {
+    summary["errors"]   = errLog->GetErrCnt();
+    summary["warnings"] = errLog->GetWarnCnt();
+    summary["time"]     = t2;
+
+    ofstream summaryStream(summaryFile, ios::binary);
+    if(!summaryStream.is_open()) {
+      LogMsg("M130", NAME(summaryFile));
+      return false;
+    }
+    summaryStream << summary.dump(2) << endl;
+  }
+
+  return true;
+}
+
+SVD_ERR SvdConv::CheckSvdFile(SvdOptions &svdOptions)
 {
   uint32_t tAll = CrossPlatformUtils::ClockInMsec();
 
   SVD_ERR svdRes = SVD_ERR_SUCCESS;
   XMLTreeSlim* xmlTree;
-  const string& path = m_svdOptions.GetSvdFullpath();
+  const string& path = svdOptions.GetSvdFullpath();
 
   const string version = VERSION_STRING;
   const string descr = PRODUCT_NAME;
@@ -561,8 +720,8 @@ SVD_ERR SvdConv::CheckSvdFile()
 	else        { LogMsg("M111", NAME("Reading SVD File"));           }
 
   // ----------------------  Construct Model  ----------------------
-  if (m_svdOptions.IsUnderTest()) {
-    string inFile = m_svdOptions.GetSvdFileName();
+  if (svdOptions.IsUnderTest()) {
+    string inFile = svdOptions.GetSvdFileName();
     try {
       const fs::path inPath = inFile;
       const auto inFilename = inPath.filename();
@@ -573,8 +732,8 @@ SVD_ERR SvdConv::CheckSvdFile()
      ErrLog::Get()->SetFileName(inFile);
     }
   }
-  else if (m_svdOptions.IsSuppressPath()) {
-    string inFile = m_svdOptions.GetSvdFileName();
+  else if (svdOptions.IsSuppressPath()) {
+    string inFile = svdOptions.GetSvdFileName();
    ErrLog::Get()->SetFileName(inFile);
   }
   else {
@@ -582,10 +741,11 @@ SVD_ERR SvdConv::CheckSvdFile()
   }
 
   t1 = CrossPlatformUtils::ClockInMsec();
-  m_svdModel = new SvdModel(0);
-  m_svdModel->SetInputFileName(path);
-  m_svdModel->SetShowMissingEnums();
-  success = m_svdModel->Construct(xmlTree);
+  SvdModel *svdModel = new SvdModel(0);
+  svdModel->SetInputFileName(path);
+  svdModel->SetShowMissingEnums();
+  svdModel->SetJobs(svdOptions.GetJobs());
+  success = svdModel->Construct(xmlTree);
   t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
   if(success) { LogMsg("M040", NAME("Constructing Model"), TIME(t2)); }
@@ -601,103 +761,108 @@ SVD_ERR SvdConv::CheckSvdFile()
 
   // ----------------------  Calculate Model  ----------------------
   t1 = CrossPlatformUtils::ClockInMsec();
-  success = m_svdModel->CalculateModel();
+  success = svdModel->CalculateModel();
   t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
   if(success) { LogMsg("M040", NAME("Calculating Model"), TIME(t2));  }
 	else        { LogMsg("M111", NAME("Calculating Model"));            }
   // ----------------------  Validate Model  ----------------------
   t1 = CrossPlatformUtils::ClockInMsec();
-	success = m_svdModel->Validate();
+	success = svdModel->Validate();
   t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
   if(success) { LogMsg("M040", NAME("Validating Model"), TIME(t2)); }
 	else        { LogMsg("M111", NAME("Validating Model"));           }
 
   // ----------------------  GetModel: device  ----------------------
-  SvdDevice  *device = m_svdModel->GetDevice();
+  SvdDevice  *device = svdModel->GetDevice();
 
-  if(device && m_svdOptions.IsCreateFields() && !m_svdOptions.IsCreateFieldsAnsiC()) {     // if fields are generated, we have annon unions
+  if(device && svdOptions.IsCreateFields() && !svdOptions.IsCreateFieldsAnsiC()) {     // if fields are generated, we have annon unions
     device->SetHasAnnonUnions();
   }
 
-  // ----------------------  Create Generator  ----------------------
-  SvdGenerator *generator = new SvdGenerator(m_svdOptions);
-  string outDir = m_svdOptions.GetOutputDirectory();
-
-  // ----------------------  Generate Listings  ----------------------
-  if(m_svdOptions.IsGenerateMap()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
-
-    if(device) {
-      generator->SetSvdFileName(path);
-      generator->SetProgramInfo(version, descr, copyright);
-
-      if(m_svdOptions.IsGenerateMapPeripheral()) {
-        success = generator->PeripheralListing  (device, outDir);
+  // ----------------------  Run Generators  ----------------------
+  // the generators only read the validated model and each one writes its own file, so they run concurrently.
+  // Messages are captured per generator and printed in the order of the generators below.
+  struct GeneratorTask {
+    string name;
+    function<bool(SvdGenerator &generator)> generate;
+    bool success;
+    uint32_t time;
+  };
+  vector<GeneratorTask> tasks;
+  string outDir = svdOptions.GetOutputDirectory();
+
+  if(svdOptions.IsGenerateMap()) {
+    tasks.push_back({ "Generate Listing File", [&](SvdGenerator &generator) {
+      bool ok = true;
+      if(svdOptions.IsGenerateMapPeripheral()) {
+        ok = generator.PeripheralListing  (device, outDir);
       }
-      if(m_svdOptions.IsGenerateMapRegister()) {
-        success = generator->RegisterListing    (device, outDir);
+      if(svdOptions.IsGenerateMapRegister()) {
+        ok = generator.RegisterListing    (device, outDir);
       }
-      if(m_svdOptions.IsGenerateMapField()) {
-        success = generator->FieldListing       (device, outDir);
+      if(svdOptions.IsGenerateMapField()) {
+        ok = generator.FieldListing       (device, outDir);
       }
-    }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
-
-    if(success) { LogMsg("M040", NAME("Generate Listing File"), TIME(t2));}
-	  else        { LogMsg("M111", NAME("Generate Listing File"));          }
+      return ok;
+    }, true, 0 });
   }
-
-  // ----------------------  Generate CMSIS Headerfile  ----------------------
-  if(m_svdOptions.IsGenerateHeader()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
-    if(device) {
-      generator->SetSvdFileName(path);
-      generator->SetProgramInfo(version, descr, copyright);
-      success = generator->CmsisHeaderFile(device, outDir);
-    }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
-
-    if(success) { LogMsg("M040", NAME("Generate CMSIS Headerfile"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate CMSIS Headerfile"));           }
+  if(svdOptions.IsGenerateHeader()) {
+    tasks.push_back({ "Generate CMSIS Headerfile", [&](SvdGenerator &generator) {
+      return generator.CmsisHeaderFile(device, outDir);
+    }, true, 0 });
+  }
+  if(svdOptions.IsGeneratePartition()) {
+    tasks.push_back({ "Generate CMSIS Partitionfile", [&](SvdGenerator &generator) {
+      return generator.CmsisPartitionFile(device, outDir);
+    }, true, 0 });
+  }
+  if(svdOptions.IsGenerateSfd()) {
+    tasks.push_back({ "Generate System Viewer SFD File", [&](SvdGenerator &generator) {
+      return generator.SfdFile(device, outDir);
+    }, true, 0 });
   }
 
-  // ----------------------  Generate CMSIS Partitionfile  ----------------------
-  if(m_svdOptions.IsGeneratePartition()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  const auto& logFileName = ErrLog::Get()->GetFileName();
+  vector<unique_ptr<ErrLogCapture> > captures(tasks.size());
+  ThreadPool threadPool(svdOptions.GetJobs());
+  threadPool.ForEach(tasks.size(), [&](size_t index, size_t) {
+    ErrLog::Get()->SetFileName(logFileName);
+    captures[index] = make_unique<ErrLogCapture>();
+    captures[index]->Start();
+    auto& task = tasks[index];
+    const uint32_t tStart = CrossPlatformUtils::ClockInMsec();
     if(device) {
-      generator->SetSvdFileName(path);
-      generator->SetProgramInfo(version, descr, copyright);
-      success = generator->CmsisPartitionFile(device, outDir);
+      SvdGenerator generator(svdOptions);     // output path and device name are set per generated file
+      generator.SetSvdFileName(path);
+      generator.SetProgramInfo(version, descr, copyright);
+      task.success = task.generate(generator);
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
+    task.time = CrossPlatformUtils::ClockInMsec() - tStart;
+    captures[index]->Stop();
+  });
 
-    if(success) { LogMsg("M040", NAME("Generate CMSIS Partitionfile"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate CMSIS Partitionfile"));           }
-  }
-
-  // ----------------------  Generate SFD File  ----------------------
-  if(m_svdOptions.IsGenerateSfd()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  for(size_t index = 0; index < tasks.size(); index++) {
+    captures[index]->Replay();
+    const auto& task = tasks[index];
     if(device) {
-      generator->SetSvdFileName(path);
-      generator->SetProgramInfo(version, descr, copyright);
-      success = generator->SfdFile(device, outDir);
+      success = task.success;
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
-    if(success) { LogMsg("M040", NAME("Generate System Viewer SFD File"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate System Viewer SFD File"));           }
+    if(success) { LogMsg("M040", NAME(task.name), TIME(task.time)); }
+    else        { LogMsg("M111", NAME(task.name));                  }
   }
 
   // ----------------------  Generate SFR File  ----------------------
-  if(m_svdOptions.IsGenerateSfr()) {
+  // compiles the SFD file, so it runs after the SFD generator
+  if(svdOptions.IsGenerateSfr()) {
     t1 = CrossPlatformUtils::ClockInMsec();
     if(device) {
-      generator->SetSvdFileName(path);
-      generator->SetProgramInfo(version, descr, copyright);
-      success = generator->SfrFile(device, outDir);
+      SvdGenerator generator(svdOptions);
+      generator.SetSvdFileName(path);
+      generator.SetProgramInfo(version, descr, copyright);
+      success = generator.SfrFile(device, outDir);
     }
     t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
@@ -706,20 +871,17 @@ SVD_ERR SvdConv::CheckSvdFile()
   }
 
 
-  if(m_svdOptions.IsDebugOutputModeText()) {
+  if(svdOptions.IsDebugOutputModeText()) {
     PrintDevice(device);
   }
 
-  if(m_svdOptions.IsDebugOutputModeJson()) {
+  if(svdOptions.IsDebugOutputModeJson()) {
     PrintDeviceJson(device);
   }
 
-  // ----------------------  Delete Generator  ----------------------
-  delete generator;
-
   // ----------------------  Delete Model  ----------------------
   t1 = CrossPlatformUtils::ClockInMsec();
-  delete m_svdModel;
+  delete svdModel;
   t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
   if(success) { LogMsg("M040", NAME("Deleting Model"), TIME(t2)); }
@@ -855,16 +1017,16 @@ void SvdConv::PrintField(SvdField *field, int numSpaces)
   cout << space << "\n";
 }
 
-void SvdConv::PrintEnumContainer(SvdEnumContainer *const enumContainer, int numSpaces)
+void SvdConv::PrintEnumContainer(SvdEnumContainer *const enumContainer, const std::string &hierarchicalName, int numSpaces)
 {
   std::string space(numSpaces, ' ');
   cout << space << "=== Enum Container: " << enumContainer->GetName() << " ===" << endl;
   cout << space << "headerEnumName: " << enumContainer->GetHeaderEnumName() << endl;
   cout << space << "usage: " << enumContainer->GetUsage() << endl;
-  cout << space << "Hierarchical Name: " << enumContainer->GetHierarchicalNameResulting() << endl;
+  cout << space << "Hierarchical Name: " << hierarchicalName << endl;
 }
 
-void SvdConv::PrintEnum(SvdEnum *const &enum_, int numSpaces)
+void SvdConv::PrintEnum(SvdEnum *const &enum_, const std::string &hierarchicalName, int numSpaces)
 {
   std::string space(numSpaces, ' ');
 
@@ -873,7 +1035,7 @@ void SvdConv::PrintEnum(SvdEnum *const &enum_, int numSpaces)
   // cout << space << "  description: " << enum_->GetDescription() << endl;
   cout << space << "  value: 0b" << bitset<32>(enum_->GetValue().u32) << endl;
   cout << space << "  isDefault: " << boolalpha << enum_->IsDefault() << noboolalpha << endl;
-  cout << space << "  Hierarchical Name: " << enum_->GetHierarchicalNameResulting() << endl;
+  cout << space << "  Hierarchical Name: " << hierarchicalName << endl;
   cout << space << "\n";
 }
 
@@ -996,6 +1158,8 @@ void SvdConv::PrintFieldWrapper(SvdField *const field, int numSpaces)
   PrintField(field, numSpaces + WHITESPACES);
   
   if (field && !field->GetChildren().empty()) {
+    // containers can be shared with the field they are copied from, name them below this field
+    const auto fieldName = field->GetHierarchicalNameResulting();
     for(const auto &child : field->GetChildren()) {
       if(!child || !child->IsValid()) {
         continue;
@@ -1003,15 +1167,15 @@ void SvdConv::PrintFieldWrapper(SvdField *const field, int numSpaces)
       
       const auto enumContainer = dynamic_cast<SvdEnumContainer *>(child);
       if(enumContainer) {
-        PrintEnumContainerWrapper(enumContainer, numSpaces + WHITESPACES);
+        PrintEnumContainerWrapper(enumContainer, enumContainer->GetHierarchicalName(fieldName), numSpaces + WHITESPACES);
       }
     }
   }
 }
 
-void SvdConv::PrintEnumContainerWrapper(SvdEnumContainer *const enumContainer, int numSpaces)
+void SvdConv::PrintEnumContainerWrapper(SvdEnumContainer *const enumContainer, const std::string &hierarchicalName, int numSpaces)
 {
-  PrintEnumContainer(enumContainer, numSpaces + WHITESPACES);
+  PrintEnumContainer(enumContainer, hierarchicalName, numSpaces + WHITESPACES);
   const auto &enums = enumContainer->GetChildren();
   for (const auto &child : enums)
   {
@@ -1020,7 +1184,7 @@ void SvdConv::PrintEnumContainerWrapper(SvdEnumContainer *const enumContainer, i
       continue;
     }
     const auto enum_ = dynamic_cast<SvdEnum *>(child);
-    PrintEnum(enum_, numSpaces + 2 * WHITESPACES);
+    PrintEnum(enum_, enum_->GetHierarchicalName(hierarchicalName), numSpaces + 2 * WHITESPACES);
   }
 }
 
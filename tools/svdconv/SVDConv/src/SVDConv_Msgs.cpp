@@ -19,8 +19,8 @@ const MsgTable SvdConv::msgTable = {
 // 40... Info Messages (INFO = verbose)
   { "M040", { MsgLevel::LEVEL_INFO ,    CRLF_B,   "%NAME%: %TIME%ms. Passed"                                                    } },
   { "M041", { MsgLevel::LEVEL_INFO,     CRLF_B,   "Overall time: %TIME%ms."                                                     } },
-  { "M042", { MsgLevel::LEVEL_INFO,     CRLF_B,   ""                                                                            } },
-  { "M043", { MsgLevel::LEVEL_INFO,     CRLF_B,   ""                                                                            } },
+  { "M042", { MsgLevel::LEVEL_TEXT,     CRLF_B,   "'%PATH%': Found %ERR% Error(s) and %WARN% Warning(s) in %TIME%ms."          } },
+  { "M043", { MsgLevel::LEVEL_INFO,     CRLF_B,   "Batch: checked %NUM% SVD files in %TIME%ms."                                 } },
   { "M044", { MsgLevel::LEVEL_INFO,     CRLF_B,   ""                                                                            } },
   { "M045", { MsgLevel::LEVEL_INFO,     CRLF_B,   ""                                                                            } },
   { "M046", { MsgLevel::LEVEL_INFO,     CRLF_B,   ""                                                                            } },
@@ -38,7 +38,8 @@ SvdOptions::SvdOptions() :
   m_bNoCleanup(false),
   m_bDebugStruct(false),
   m_bDebugHeaderfile(false),
-  m_bDebugSfd(false)
+  m_bDebugSfd(false),
+  m_jobs(0)
 {
 }
 
@@ -312,6 +313,48 @@ const string& SvdOptions::GetOutFilenameOverride() const
   return m_outfileOverride;
 }
 
+/**
+ * @brief set SVD files to check in one run
+ * @param batch list file with one SVD file per line, or wild card pattern
+ * @return passed / failed
+ */
+bool SvdOptions::SetBatch(const string& batch)
+{
+  if(batch.empty()) {
+    return false;
+  }
+
+  m_batch = batch;
+
+  return true;
+}
+
+const string& SvdOptions::GetBatch() const
+{
+  return m_batch;
+}
+
+/**
+ * @brief set JSON file for the summary of a batch check
+ * @param filename string name
+ * @return passed / failed
+ */
+bool SvdOptions::SetBatchSummary(const string& filename)
+{
+  if(filename.empty()) {
+    return false;
+  }
+
+  m_batchSummary = RteUtils::BackSlashesToSlashes(RteUtils::RemoveQuotes(filename));
+
+  return true;
+}
+
+const string& SvdOptions::GetBatchSummary() const
+{
+  return m_batchSummary;
+}
+
 /**
  * @brief set output directory
  * @param filename string name
@@ -6,10 +6,15 @@
 #ifndef FileIo_H
 #define FileIo_H
 
+#include <fmt/format.h>
+
 #include <string>
 #include <map>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <utility>
 
 #define FILE_BUF_SIZE           (1024 * 1024)
 #define SPACES_PER_TAB_FIO      2
@@ -28,6 +33,13 @@ public:
   bool                Flush                     (void);
   bool                Close                     ();
 
+  // fmt style formatting, the text is appended to the output buffer without length limit
+  template<typename... Args>
+  bool WriteFormat(fmt::format_string<Args...> format, Args&&... args) {
+    fmt::format_to(std::back_inserter(m_outFileStr), format, std::forward<Args>(args)...);
+    return FlushIfFull();
+  }
+
   bool                SetFileName               (const std::string fileName)      { m_fileName = fileName; return true; }
   const std::string&  GetFileName               ()                                { return m_fileName; }
   bool                SetSvdFileName            (const std::string fileName)      { m_svdFileName = fileName; return true; }
@@ -47,6 +59,7 @@ public:
 
 protected:
   uint32_t            ConvertTab                (std::string& dest, const std::string& src);
+  bool                FlushIfFull               ();
   bool                CreateFileDescription     ();
 
   // see https://stackoverflow.com/questions/56788745/how-to-convert-stdfilesystemfile-time-type-to-a-string-using-gcc-9/58237530#58237530
@@ -58,6 +71,7 @@ protected:
 
 private:
   uint32_t      m_tabSpaceCnt;
+  uint32_t      m_charCnt;
   std::string   m_fileName;
   std::string   m_svdFileName;
   std::string   m_versionString;
@@ -66,7 +80,9 @@ private:
   std::string   m_briefDescription;
   std::string   m_licenseText;
   std::string   m_deviceVersion;
-  std::string   m_outFileStr;
+  std::string   m_outFileStr;       // text written since the last flush, tabs are converted on flush
+  std::string   m_convertedStr;
+  std::ofstream m_fileStream;
 
   static const std::string genericLicenseText;
 };
@@ -75,6 +75,7 @@ struct EnumValuesNames {
   std::string alternate;
   std::string field;
   std::string headerEnumName;
+  std::string container;
 };
 
 
@@ -184,7 +185,7 @@ protected:
   bool            CreateRegistersEnumValue          (SvdItem* container,          EnumValuesNames *enumValuesNames);
   bool            CreateRegisterEnumValue           (SvdRegister* reg,            EnumValuesNames *enumValuesNames);
   bool            CreateFieldEnumValue              (SvdField* field,             EnumValuesNames *enumValuesNames);
-  bool            CreateEnumValuesContainer         (SvdEnumContainer* enumCont,  EnumValuesNames *enumValuesNames);
+  bool            CreateEnumValuesContainer         (SvdEnumContainer* enumCont,  const std::string& containerName, EnumValuesNames *enumValuesNames);
   bool            CreateEnumValue                   (SvdEnum* enu,                EnumValuesNames *enumValuesNames);
   bool            CreateRegisterEnumArrayValue      (SvdRegister* reg,            EnumValuesNames *enumValuesNames);
   bool            CreateClusterEnumArrayValue       (SvdCluster* clust,           EnumValuesNames *enumValuesNames);
@@ -192,6 +193,8 @@ protected:
 
   void            SetMaxBitWidth                    (uint32_t width) { m_maxBitWidth = width; }
   uint32_t        GetMaxBitWidth                    () { return m_maxBitWidth; }
+  void            SetCalcSize                       (SvdItem* item, uint32_t size) { m_calcSizes[item] = size; }
+  uint32_t        GetCalcSize                       (SvdItem* item);
 
 
   struct ReservedPad {
@@ -218,10 +221,12 @@ private:
   uint32_t            m_maxBitWidth;
   RegTreeNode*        m_rootNode;
   RegTreeNode         m_regTreeNodes[32];     // 32 placeholder
+  uint32_t            m_regTreeNodeCnt;
   StructUnion         m_structUnionStack[32];
 
   std::map<std::string, SvdEnum*> m_usedEnumValues;   // check enum names globally
   std::list<ReservedPad>          m_reservedPad;
+  std::map<SvdItem*, uint32_t>    m_calcSizes;        // calculated sizes of peripherals and clusters
 
   static const std::string m_anonUnionStart;
   static const std::string m_anonUnionEnd;
@@ -14,6 +14,7 @@
 
 #include <string>
 #include <map>
+#include <set>
 #include <list>
 
 
@@ -76,6 +77,7 @@ private:
   const SvdOptions&   m_options;
   FileIo*             m_fileIo;
   SfdGenerator*       m_gen;
+  std::set<SvdRegister*> m_expressionRegs;    // registers already generated for use in C Expressions
 
   static const std::string m_addrWidthStr[];
 };
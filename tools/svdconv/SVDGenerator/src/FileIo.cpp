@@ -9,7 +9,8 @@
 
 #include <stdio.h>
 #include <stdarg.h>
-#include <fstream>
+#include <string.h>
+#include <mutex>
 
 using namespace std;
 
@@ -31,14 +32,20 @@ const string FileIo::genericLicenseText = \
   "See the License for the specific language governing permissions and\\n"\
   "limitations under the License.";
 
+// localtime() and asctime() return static buffers, files are created by concurrent generators
+static mutex s_timeMutex;
 
 FileIo::FileIo() :
-  m_tabSpaceCnt(0)
+  m_tabSpaceCnt(0),
+  m_charCnt(0)
 {
 }
 
 FileIo::~FileIo()
 {
+  if(m_fileStream.is_open()) {
+    Flush();
+  }
 }
 
 bool FileIo::Create(const string &fileName)
@@ -49,13 +56,20 @@ bool FileIo::Create(const string &fileName)
     return false;
   }
 
-  ofstream fileStream(fileName);
-  if(!fileStream.is_open()) {
+  if(m_fileStream.is_open()) {
+    m_fileStream.close();
+  }
+  m_outFileStr.clear();
+  m_tabSpaceCnt = 0;
+  m_charCnt = 0;
+
+  // the file stays open until Close(), buffered text is appended on every flush
+  m_fileStream.open(fileName, ofstream::out | ofstream::binary | ofstream::trunc);
+  if(!m_fileStream.is_open()) {
     LogMsg("M130", NAME(fileName));
     return false;
   }
 
-  fileStream.close();
   SetFileName(fileName);
   CreateFileDescription();
 
@@ -64,26 +78,40 @@ bool FileIo::Create(const string &fileName)
 
 bool FileIo::Write(const string& text)
 {
-  if(m_outFileStr.length() > FILE_BUF_SIZE) {
-    Flush();
-  }
-
-  ConvertTab(m_outFileStr, text);
+  m_outFileStr += text;
 
-  return true;
+  return FlushIfFull();
 }
 
 bool FileIo::WriteLine(const char *text, ...)
 {
-  va_list   marker;
-  char outBuf[1024];
-
-  va_start (marker, text);
-  vsnprintf(outBuf, 1024-2, text, marker);
+  va_list marker;
+  va_list markerLen;
+
+  va_start(marker, text);
+  va_copy(markerLen, marker);
+  const auto len = vsnprintf(nullptr, 0, text, markerLen);
+  va_end(markerLen);
+
+  if(len > 0) {
+    const auto pos = m_outFileStr.length();
+    m_outFileStr.resize(pos + len + 1);
+    vsnprintf(&m_outFileStr[pos], len + 1, text, marker);
+    m_outFileStr.back() = '\n';
+  }
+  else {
+    m_outFileStr += '\n';
+  }
   va_end(marker);
 
-  Write(outBuf);
-  Write("\n");
+  return FlushIfFull();
+}
+
+bool FileIo::FlushIfFull()
+{
+  if(m_outFileStr.length() > FILE_BUF_SIZE) {
+    Flush();
+  }
 
   return true;
 }
@@ -94,18 +122,18 @@ bool FileIo::Flush()
     return false;
   }
 
-  const auto& fileName = GetFileName();
-  ofstream fileStream(fileName, ofstream::out | ofstream::binary | ofstream::app);   // append
-  if (!fileStream.is_open()) {
+  if(!m_fileStream.is_open()) {
     return false;
   }
 
-  fileStream << m_outFileStr;
-  fileStream.flush();
-  fileStream.close();
+  m_convertedStr.clear();
+  ConvertTab(m_convertedStr, m_outFileStr);
   m_outFileStr.clear();
 
-  return true;
+  m_fileStream.write(m_convertedStr.data(), m_convertedStr.size());
+  m_fileStream.flush();
+
+  return m_fileStream.good();
 }
 
 bool FileIo::Close()
@@ -113,6 +141,10 @@ bool FileIo::Close()
   Write("\n");
   Flush();
 
+  if(m_fileStream.is_open()) {
+    m_fileStream.close();
+  }
+
   return true;
 }
 
@@ -125,54 +157,80 @@ bool FileIo::WriteText(const string& text)
 
 bool FileIo::WriteChar(const char c)
 {
-  string text;
-  text += c;
-  Write(text);
+  m_outFileStr += c;
 
-  return true;
+  return FlushIfFull();
+}
+
+// position of the next character c in [pos, end), end if there is none
+static const char* FindChar(const char* pos, const char* end, char c)
+{
+  const auto found = static_cast<const char*>(memchr(pos, c, end - pos));
+  return found? found : end;
 }
 
 uint32_t FileIo::ConvertTab(string& dest, const string& src)
 {
-  static uint32_t s_charCnt = 0;
-  uint32_t j;
   uint32_t lenToNextTab = 0;
   uint32_t charCnt = 0;
 
-  for(auto c : src) {
-    if(c == '\n') {
-      s_charCnt = 0;
-      m_tabSpaceCnt = 0;
-      dest += c;
-      charCnt++;
+  dest.reserve(dest.length() + src.length());
+
+  const char* pos = src.data();
+  const char* const end = pos + src.length();
+  const char* nextTab = FindChar(pos, end, '\t');
+  const char* nextCr  = FindChar(pos, end, '\r');
+
+  while(pos < end) {
+    // text up to the next tab or carriage return is copied at once
+    const char* next = nextTab < nextCr? nextTab : nextCr;
+    if(next != pos) {
+      const auto len = (uint32_t)(next - pos);
+      dest.append(pos, len);
+      charCnt += len;
+
+      const char* lineStart = next;
+      while(lineStart != pos && *(lineStart - 1) != '\n') {
+        lineStart--;
+      }
+      const auto lineLen = (uint32_t)(next - lineStart);
+      if(lineStart != pos) {
+        m_charCnt = lineLen;
+        m_tabSpaceCnt = lineLen;
+      }
+      else {
+        m_charCnt += lineLen;
+        m_tabSpaceCnt += lineLen;
+      }
+
+      pos = next;
+      if(pos == end) {
+        break;
+      }
     }
-    else if(c == '\r') {
+
+    if(*pos == '\r') {
       m_tabSpaceCnt = 0;
+      nextCr = FindChar(pos + 1, end, '\r');
     }
-    else if(c == '\t') {
-      if(m_tabSpaceCnt <=  s_charCnt) {  // if((m_tabSpaceCnt + SPACES_PER_TAB_FIO) <=  s_charCnt) {
+    else {
+      if(m_tabSpaceCnt <=  m_charCnt) {  // if((m_tabSpaceCnt + SPACES_PER_TAB_FIO) <=  m_charCnt) {
         m_tabSpaceCnt += SPACES_PER_TAB_FIO;
       }
       else {
-        lenToNextTab = SPACES_PER_TAB_FIO - (s_charCnt % SPACES_PER_TAB_FIO);      // calculate len to next tab
+        lenToNextTab = SPACES_PER_TAB_FIO - (m_charCnt % SPACES_PER_TAB_FIO);      // calculate len to next tab
         if(!lenToNextTab) {
           lenToNextTab = SPACES_PER_TAB_FIO;
         }
         m_tabSpaceCnt += lenToNextTab;
 
-        for(j=0; j<lenToNextTab; j++) {
-          dest += ' ';
-          charCnt++;
-          s_charCnt++;
-        }
+        dest.append(lenToNextTab, ' ');
+        charCnt += lenToNextTab;
+        m_charCnt += lenToNextTab;
       }
+      nextTab = FindChar(pos + 1, end, '\t');
     }
-    else {
-      dest += c;
-      charCnt++;
-      s_charCnt++;
-      m_tabSpaceCnt++;
-    }
+    pos++;
   }
 
   return charCnt;
@@ -182,6 +240,7 @@ bool FileIo::CreateFileDescription()
 {
   const string& fileName = GetSvdFileName();
 
+  unique_lock<mutex> timeLock(s_timeMutex);
   time_t result = time(nullptr);
   const char* timeAsc = asctime(std::localtime(&result));
   string timeText { "<unknown>" };
@@ -204,6 +263,7 @@ bool FileIo::CreateFileDescription()
       fTimeText.pop_back();    // erase '\n'
     }
   }
+  timeLock.unlock();
 
   string::size_type pos;
   string outFileName = GetFileName();
@@ -12,6 +12,7 @@
 #include "SvdDevice.h"
 #include "SvdCpu.h"
 #include "SvdInterrupt.h"
+#include "SvdDerivedFrom.h"
 #include "SvdUtils.h"
 
 using namespace std;
@@ -77,7 +78,8 @@ HeaderData::HeaderData(const FileHeaderInfo &fileHeaderInfo, const SvdOptions& o
   m_prevWasUnion(0),
   m_structUnionPos(0),
   m_maxBitWidth(32),
-  m_rootNode(nullptr)
+  m_rootNode(nullptr),
+  m_regTreeNodeCnt(0)
 {
   memset(&m_structUnionStack, 0, sizeof(StructUnion) * 32);
   memset(&m_regTreeNodes, 0, sizeof(RegTreeNode) * 32);     // 32 placeholder
@@ -295,3 +297,28 @@ bool HeaderData::CreateInterruptList(SvdDevice *device)
 
   return true;
 }
+
+uint32_t HeaderData::GetCalcSize(SvdItem* item)
+{
+  const auto it = m_calcSizes.find(item);
+  if(it != m_calcSizes.end() && it->second) {
+    return it->second;
+  }
+
+  if(!item->IsModified()) {
+    const auto copiedFrom = item->GetCopiedFrom();
+    if(copiedFrom) {
+      return GetCalcSize(copiedFrom);
+    }
+
+    const auto derivedFrom = item->GetDerivedFrom();
+    if(derivedFrom) {
+      const auto derivedItem = derivedFrom->GetDerivedFromItem();
+      if(derivedItem) {
+        return GetCalcSize(derivedItem);
+      }
+    }
+  }
+
+  return 0;
+}
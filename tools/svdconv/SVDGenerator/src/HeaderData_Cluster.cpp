@@ -119,12 +119,12 @@ bool HeaderData::CloseCluster(SvdCluster* cluster)
   }
 
   GenerateReserved();
-  cluster->SetSize(m_addressCnt);
+  SetCalcSize(cluster, m_addressCnt);
 
   m_gen->Generate<STRUCT|END|TYPEDEF >("%s", name.c_str());
 
   if(m_bDebugHeaderfile) {
-    uint32_t size = cluster->GetSize();
+    uint32_t size = GetCalcSize(cluster);
     m_gen->Generate<MAKE|MK_DOXY_COMMENT  >("Size = %i (0x%x)", size, size);
   }
 
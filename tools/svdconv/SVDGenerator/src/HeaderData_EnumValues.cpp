@@ -114,7 +114,7 @@ bool HeaderData::CreatePeripheralEnumArrayValue(SvdPeripheral* peri, EnumValuesN
   }
  
   m_gen->Generate<DESCR|SUBPART  >("%s", outName.c_str());
-  CreateEnumValuesContainer(enumContainer, enumValuesNames);
+  CreateEnumValuesContainer(enumContainer, enumContainer->GetHierarchicalName(), enumValuesNames);
 
   return true;
 }
@@ -154,7 +154,7 @@ bool HeaderData::CreateClusterEnumArrayValue(SvdCluster* clust, EnumValuesNames
   }
  
   m_gen->Generate<DESCR|SUBPART  >("%s", outName.c_str());
-  CreateEnumValuesContainer(enumContainer, enumValuesNames);
+  CreateEnumValuesContainer(enumContainer, enumContainer->GetHierarchicalName(), enumValuesNames);
 
   return true;
 }
@@ -267,7 +267,7 @@ bool HeaderData::CreateRegisterEnumArrayValue(SvdRegister* reg, EnumValuesNames
   }
  
   m_gen->Generate<DESCR|SUBPART  >("%s", outName.c_str());
-  CreateEnumValuesContainer(enumContainer, enumValuesNames);
+  CreateEnumValuesContainer(enumContainer, enumContainer->GetHierarchicalName(), enumValuesNames);
 
   return true;
 }
@@ -305,30 +305,32 @@ bool HeaderData::CreateFieldEnumValue(SvdField* field, EnumValuesNames *enumValu
   outName += "]";
   
   m_gen->Generate<DESCR|SUBPART  >("%s", outName.c_str());
-  
+
+  // containers can be shared with the field they are copied from, name them below this field
+  const auto fieldHierarchicalName = field->GetHierarchicalName();
   for(const auto enumCont : enumContainers) {
     if(!enumCont || !enumCont->IsValid()) {
       continue;
     }
 
-    CreateEnumValuesContainer(enumCont, enumValuesNames);
+    CreateEnumValuesContainer(enumCont, enumCont->GetHierarchicalName(fieldHierarchicalName), enumValuesNames);
   }
 
   return true;
 }
 
-bool HeaderData::CreateEnumValuesContainer(SvdEnumContainer* enumCont, EnumValuesNames *enumValuesNames)
+bool HeaderData::CreateEnumValuesContainer(SvdEnumContainer* enumCont, const string& containerName, EnumValuesNames *enumValuesNames)
 {
   const auto& childs = enumCont->GetChildren();
   if(childs.empty()) {
     return true;
   }
 
-  const auto  containerName   = enumCont->GetHierarchicalName(); //enumCont->GetNameCalculated();
   const auto& headerEnumName  = enumCont->GetHeaderEnumName(); 
   const auto& descr           = enumCont->GetDescription();
   
   enumValuesNames->headerEnumName = headerEnumName;
+  enumValuesNames->container      = containerName;
 
   m_gen->Generate<ENUM|TYPEDEF|BEGIN    >("");
   m_gen->Generate<MAKE|MK_DOXY_COMMENT  >("%s", !descr.empty()? descr.c_str() : containerName.c_str());
@@ -339,7 +341,7 @@ bool HeaderData::CreateEnumValuesContainer(SvdEnumContainer* enumCont, EnumValue
       continue;
     }
 
-    const auto enumName = enu->GetHierarchicalName();
+    const auto enumName = enu->GetHierarchicalName(containerName);
     const auto find = m_usedEnumValues.find(enumName);
     if(find == m_usedEnumValues.end()) {
       CreateEnumValue(enu, enumValuesNames);
@@ -387,7 +389,7 @@ bool HeaderData::CreateEnumValue(SvdEnum* enu, EnumValuesNames *enumValuesNames)
     enumName += name;
   }
   else {
-    enumName  = enu->GetHierarchicalName();
+    enumName  = enu->GetHierarchicalName(enumValuesNames->container);
   }
 
   uint32_t val = enu->GetValue().u32;
@@ -61,7 +61,7 @@ bool HeaderData::CreatePeripheralType(SvdPeripheral* peripheral)
     CreateRegisters(regCont);
   }
 
-  peripheral->SetSize(m_addressCnt);
+  SetCalcSize(peripheral, m_addressCnt);
   ClosePeripheral(peripheral);
 
   return true;
@@ -112,7 +112,7 @@ bool HeaderData::ClosePeripheral(SvdPeripheral* peripheral)
   string name = periName;
   const auto dim = peripheral->GetDimension();
   if(dim) {
-    uint32_t periSize  = peripheral->GetSize();
+    uint32_t periSize  = GetCalcSize(peripheral);
     uint32_t periInc   = dim->GetDimIncrement();
 
     if(periSize <= periInc) {
@@ -124,7 +124,7 @@ bool HeaderData::ClosePeripheral(SvdPeripheral* peripheral)
       }
 
       GenerateReserved(reserved, (uint32_t)peripheral->GetAbsoluteAddress() + periSize, false);
-      peripheral->SetSize(reserved + periSize);
+      SetCalcSize(peripheral, reserved + periSize);
     }
     else {
       m_gen->Generate<C_ERROR>("Peripheral size (0x%02x) greater than <dimIncrement> (0x%02x) !", peripheral->GetLineNumber(), periSize, periInc);
@@ -132,7 +132,7 @@ bool HeaderData::ClosePeripheral(SvdPeripheral* peripheral)
   }
 
   GenerateReserved();
-  peripheral->SetSize(m_addressCnt);
+  SetCalcSize(peripheral, m_addressCnt);
 
   if(m_reservedPad.size()) {
     m_gen->Generate<C_ERROR>("Not generated remaining reserved bytes error!", -1);
@@ -153,7 +153,7 @@ bool HeaderData::ClosePeripheral(SvdPeripheral* peripheral)
   }
 
   if(m_bDebugHeaderfile) {
-    uint32_t size = peripheral->GetSize();
+    uint32_t size = GetCalcSize(peripheral);
     m_gen->Generate<MAKE|MK_DOXY_COMMENT>("Size = %i (0x%x)", size, size);
   }
 
@@ -243,14 +243,12 @@ void HeaderData::CreateStructUnion(bool isUnion, bool open, uint32_t num)
 
 RegTreeNode *HeaderData::GetNextRegNode(bool first /* = 0 */)
 {
-  static uint32_t cnt = 0;
-
   if(first) {
     memset(m_regTreeNodes, 0, sizeof(m_regTreeNodes));      // clean array
-    cnt = 0;
+    m_regTreeNodeCnt = 0;
   }
 
-  return &m_regTreeNodes[cnt++];
+  return &m_regTreeNodes[m_regTreeNodeCnt++];
 }
 
 bool HeaderData::NodeValid(RegTreeNode *node)
@@ -225,7 +225,7 @@ uint32_t HeaderData::CreateRegCluster(SvdCluster*  cluster)
   const auto descr              = cluster->GetDescriptionCalculated();
   uint32_t   addr               = (uint32_t) cluster->GetAddress();
   SvdTypes::Access accessType   = cluster->GetEffectiveAccess();
-  uint32_t   size               = cluster->GetSize();
+  uint32_t   size               = GetCalcSize(cluster);
 
   string name = headerTypeName;
   name += "_Type";
@@ -84,7 +84,7 @@ bool SfdData::CreateExpressionRefs(SvdDevice* device)
     }
 
     const auto& strAddrWidth = m_addrWidthStr[(regWidth/8)-1];
-    reg->SetUsedForExpression();   // mark as already generated
+    m_expressionRegs.insert(reg);   // mark as already generated
 
     CreateItemDescription(reg, "Expression Object");
     m_gen->Generate<MAKE|MK_ADDRSTR>(ADDRESS_STRING, strAddrWidth.c_str(), itemName.c_str(), address);
@@ -757,7 +757,7 @@ bool SfdData::CreateRegisterItem(SvdRegister* reg)
 
   CreateItemDescription(reg, "Item Address");
   const auto& strAddrWidth = m_addrWidthStr[(regWidth/8)-1];
-  if(!reg->IsUsedForCExpression()) {
+  if(m_expressionRegs.find(reg) == m_expressionRegs.end()) {
     m_gen->Generate<MAKE|MK_ADDRSTR >(ADDRESS_STRING, strAddrWidth.c_str(), itemName.c_str(), address);
   }
   else {
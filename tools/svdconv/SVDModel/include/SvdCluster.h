@@ -30,8 +30,6 @@ public:
   virtual bool                        Calculate               ();
   virtual bool                        CalculateDim            ();
   virtual uint64_t                    GetAddress              ()                                                    { return m_offset;               }     // needed for absolute address calculation
-  virtual uint32_t                    GetSize                 ();
-  virtual uint32_t                    SetSize                 (uint32_t size);
   virtual std::string                 GetNameCalculated       ();
   virtual bool                        CheckItem               ();
   
@@ -62,7 +60,6 @@ protected:
 
 private:
   SvdEnumContainer               *m_enumContainer;
-  uint32_t                        m_calcSize;
   uint64_t                        m_offset;
   std::optional<uint64_t>         m_resetValue;
   std::optional<uint64_t>         m_resetMask;
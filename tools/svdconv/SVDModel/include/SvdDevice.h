@@ -10,8 +10,10 @@
 #include "SvdTypes.h"
 #include "SvdCExpression.h"
 
+#include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 class SvdPeripheralContainer;
 class SvdPeripheral;
@@ -41,6 +43,7 @@ public:
 
   SvdPeripheralContainer* GetPeripheralContainer() const;
   bool                    CheckForItemsPeri             (const std::list<SvdItem*> &childs);
+  bool                    CheckForItemsPeri             (SvdPeripheral* peri);
   bool                    CheckForItemsCluster          (const std::list<SvdItem*> &childs);
   bool                    CheckForItemsRegister         (SvdRegister* reg);
   bool                    CheckPeripherals              (const std::list<SvdItem*> &childs);
@@ -84,14 +87,18 @@ public:
 
   bool                GetHasAnnonUnions                 () { return m_hasAnnonUnions;              }
   bool                SetHasAnnonUnions                 () { m_hasAnnonUnions = true; return true; }
+  uint32_t            CountUnknownTag                   () { return m_unknownTagCnt++;             }
 
   SvdCExpression::RegList& GetExpressionRegistersList   () { return m_expressionRegList; }
 
 protected:
+  unsigned                GetJobs                       ();
+  void                    ForEachPeripheral             (const std::vector<SvdPeripheral*>& peris, const std::function<void(SvdPeripheral*)>& func);
 
 private:
   SvdCpu                           *m_cpu;
   bool                              m_hasAnnonUnions;
+  uint32_t                          m_unknownTagCnt;
   uint32_t                          m_addressUnitBits;
   uint32_t                          m_width;
   std::optional<uint64_t>           m_resetValue;
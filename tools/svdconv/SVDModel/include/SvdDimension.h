@@ -93,7 +93,7 @@ public:
   bool                            SetTo                 (std::string                    to          )  { m_to           = to          ; return true; }
   bool                            SetDimIndex           (const std::string&             dimIndex    )  { m_dimIndex     = dimIndex    ; return true; }
   bool                            SetDimIndexList       (const std::list<std::string>&  dimIndexList)  { m_dimIndexList = dimIndexList; return true; }
-  bool                            SetDimName            (const std::string&             dimName     )  { m_dimName      = dimName     ; return true; }
+  bool                            SetDimName            (const std::string&             dimName     );
 
   int32_t                             GetAddressBitsUnits   ();
   int32_t                             CalcAddressIncrement  ();
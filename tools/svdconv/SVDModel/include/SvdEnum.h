@@ -31,6 +31,8 @@ public:
   SvdTypes::EnumUsage     GetEnumUsage          ()  { return m_enumUsage ; }
   SvdTypes::EnumUsage     GetEffectiveEnumUsage ();
   bool                    SetEnumUsage          (SvdTypes::EnumUsage enumUsage) { m_enumUsage = enumUsage; return true; }
+  void                    SetChecked            ()  { m_bChecked = true; }
+  bool                    IsShareable           ();
   
 protected:
 
@@ -38,6 +40,7 @@ private:
   SvdEnum*              m_defaultValue;
   SvdTypes::EnumUsage   m_enumUsage;
   std::string           m_headerEnumName;
+  bool                  m_bChecked;
 };
 
 
@@ -74,6 +74,7 @@ class SvdDimension;
 class SvdVisitor;
 class XMLTreeElement;
 class SvdDevice;
+struct SvdChildIndex;
 
 
 class SvdElement {
@@ -119,6 +120,8 @@ public:
   SvdItem(SvdItem* parent);
   virtual ~SvdItem();
 
+  virtual bool SetName (const std::string &name);
+
   static const uint32_t VALUE32_NOT_INIT;
   static const uint64_t VALUE64_NOT_INIT;
 
@@ -132,6 +135,7 @@ public:
   const std::list<SvdItem*>&            GetChildren                       () const                { return m_children; }
   size_t                                GetChildCount                     () const                { return m_children.size();}
   void                                  AddItem                           (SvdItem* item);
+  void                                  AddSharedItem                     (SvdItem* item);
   bool                                  AcceptVisitor                     (SvdVisitor* visitor);
   void                                  DebugModel                        (const std::string &value);
   void                                  Invalidate                        ();
@@ -181,6 +185,7 @@ public:
   bool                                  SetDisplayName                      (const std::string &name);
   const std::string&                    GetDisplayName                      ();
   std::string                           GetHierarchicalName                 ();
+  std::string                           GetHierarchicalName                 (const std::string &parentName);
   std::string                           GetHierarchicalNameResulting        ();
   std::string                           TryGetHeaderStructName              (SvdItem *item);
   const std::string&                    GetPeripheralName                   ();
@@ -193,8 +198,13 @@ public:
   SVD_LEVEL                             GetSvdLevel                         ()                    { return m_svdLevel; }
 
   bool                                  FindChild                           (SvdItem *&item, const std::string &name);
-  bool                                  FindChild                           (const std::list<SvdItem*> childs, SvdItem *&item, const std::string &name);
+  bool                                  FindChild                           (const std::list<SvdItem*>& childs, SvdItem *&item, const std::string &name);
   bool                                  FindChildFromItem                   (SvdItem *&item, const std::string &name);
+  bool                                  FindChildFromDim                    (SvdItem *&item, const std::string &name);
+  bool                                  FindChildFromIndex                  (SvdItem *&item, const std::string &name);
+  void                                  InvalidateChildIndex                ();
+  void                                  UpdateChildIndex                    (SvdItem* child, const std::string &oldDeriveName);
+  bool                                  IsInParentIndex                     ();
 
   void                                  SetModified                         ();
   bool                                  IsModified                          () { return m_modified; }
@@ -227,10 +237,8 @@ public:
   bool                                  SetDimElementIndex                  (uint32_t index)      { m_dimElementIndex = index; return true; }
   uint32_t                              GetDimElementIndex                  ()                    { return m_dimElementIndex; }
 
-  void                                  SetUsedForExpression                (bool bUsed = true)   { m_bUsedForCExpression = bUsed; }
-  bool                                  IsUsedForCExpression                ()                    { return m_bUsedForCExpression; }
-
 protected:
+  void                                  AddToChildIndex                     (SvdItem* child, size_t pos);
 
 private:
   static const std::string  m_svdLevelStr[];
@@ -242,10 +250,11 @@ private:
   SVD_LEVEL                 m_svdLevel;
   int32_t                   m_bitWidth;
   uint32_t                  m_dimElementIndex;
+  uint32_t                  m_shareCount;       // number of items referencing this item as shared child
   bool                      m_modified;
-  bool                      m_bUsedForCExpression;
   SvdTypes::ProtectionType  m_protection;
   std::list<SvdItem*>       m_children;
+  SvdChildIndex*            m_childIndex;       // derive names of m_children, built on first lookup
   std::string               m_displayName;
   std::string               m_description;
 
@@ -29,6 +29,8 @@ public:
   bool                SetInputFileName    (const std::string& inputFileName)  { m_inputFileName = inputFileName;  return true; }
   bool                SetShowMissingEnums ()                                  { m_showMissingEnums = true;        return true; }
   bool                GetShowMissingEnums ()                                  { return m_showMissingEnums; }
+  bool                SetJobs             (unsigned jobs)                     { m_jobs = jobs;                    return true; }
+  unsigned            GetJobs             ()                                  { return m_jobs; }
   SvdDevice*          GetDevice           () const                            { return m_device; }
 
 protected:
@@ -36,6 +38,7 @@ protected:
 private:
   SvdDevice       *m_device;
   bool             m_showMissingEnums;
+  unsigned         m_jobs;
   std::string      m_inputFileName;
 };
 
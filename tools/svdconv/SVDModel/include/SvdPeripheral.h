@@ -48,8 +48,6 @@ public:
   virtual bool            ProcessXmlElement           (XMLTreeElement* xmlElement);
   virtual bool            ProcessXmlAttributes        (XMLTreeElement* xmlElement);
 
-  virtual uint32_t        GetSize                     ();
-  virtual uint32_t        SetSize                     (uint32_t size);
   virtual bool            CopyItem                    (SvdItem *from);
   virtual bool            Calculate                   ();
   virtual bool            CalculateDim                ();
@@ -125,7 +123,6 @@ private:
   SvdEnumContainer*           m_enumContainer;
   SvdCExpression*             m_disableCondition;
   bool                        m_hasAnnonUnions;
-  uint32_t                    m_calcSize;
   std::optional<uint64_t>     m_resetValue;
   std::optional<uint64_t>     m_resetMask;
   SvdTypes::Access            m_access;
@@ -19,7 +19,6 @@ using namespace std;
 SvdCluster::SvdCluster(SvdItem* parent):
   SvdItem(parent),
   m_enumContainer(0),
-  m_calcSize(0),
   m_offset(0),
   m_resetValue(std::nullopt),
   m_resetMask(std::nullopt),
@@ -384,32 +383,6 @@ bool SvdCluster::CopyItem(SvdItem *from)
   return false;
 }
 
-uint32_t SvdCluster::GetSize()
-{
-  if(!m_calcSize) {
-    if(!IsModified()) {
-      const auto copiedFrom = GetCopiedFrom();
-      if(copiedFrom) {
-        return copiedFrom->GetSize();
-      }
-
-      const auto derivedFrom = GetDerivedFrom();
-      if(derivedFrom) {
-        const auto item = derivedFrom->GetDerivedFromItem();
-        if(item) return item->GetSize();
-      }
-    }
-  }
-  return m_calcSize;
-}
-
-uint32_t SvdCluster::SetSize(uint32_t size)
-{
-  m_calcSize = size;
-
-  return true;
-}
-
 bool SvdCluster::AddToMap(SvdEnum *enu, map<string, SvdEnum*> &map)
 {
   if(!enu) {
@@ -18,6 +18,9 @@
 #include "SvdField.h"
 #include "SvdEnum.h"
 #include "SvdAddressBlock.h"
+#include "ThreadPool.h"
+
+#include <memory>
 
 using namespace std;
 
@@ -26,6 +29,7 @@ SvdDevice::SvdDevice(SvdItem* parent):
   SvdItem(parent),
   m_cpu(nullptr),
   m_hasAnnonUnions(false),
+  m_unknownTagCnt(0),
   m_addressUnitBits(0),
   m_width(0),
   m_resetValue(std::nullopt),
@@ -762,14 +766,45 @@ bool SvdDevice::CheckAddressBlockOverlap(SvdPeripheral* peri, SvdAddressBlock* a
   return true;
 }
 
+unsigned SvdDevice::GetJobs()
+{
+  const auto model = dynamic_cast<SvdModel*>(GetParent());
+  return model? model->GetJobs() : 0;
+}
+
+void SvdDevice::ForEachPeripheral(const vector<SvdPeripheral*>& peris, const function<void(SvdPeripheral*)>& func)
+{
+  // peripherals are checked concurrently, messages are captured per peripheral and printed in the given order
+  const auto& fileName = ErrLog::Get()->GetFileName();
+  vector<unique_ptr<ErrLogCapture> > captures(peris.size());
+
+  ThreadPool threadPool(GetJobs());
+  threadPool.ForEach(peris.size(), [&](size_t index, size_t) {
+    ErrLog::Get()->SetFileName(fileName);
+    captures[index] = make_unique<ErrLogCapture>();
+    captures[index]->Start();
+    func(peris[index]);
+    captures[index]->Stop();
+  });
+
+  for(const auto& capture : captures) {
+    capture->Replay();
+  }
+}
+
 bool SvdDevice::CheckPeripheralOverlap(const map<string, SvdItem*>& perisMap)
 {
+  vector<SvdPeripheral*> peris;
   for(const auto& [key, item] : perisMap) {
     const auto peri = dynamic_cast<SvdPeripheral*>(item);
     if(!peri || !peri->IsValid()) {
       continue;
     }
 
+    peris.push_back(peri);
+  }
+
+  ForEachPeripheral(peris, [&](SvdPeripheral* peri) {
     const auto& addrBlocks = peri->GetAddressBlock();
     for(const auto addrBlock : addrBlocks) {
       if(!addrBlock || !addrBlock->IsValid()) {
@@ -778,7 +813,7 @@ bool SvdDevice::CheckPeripheralOverlap(const map<string, SvdItem*>& perisMap)
 
       CheckAddressBlockOverlap(peri, addrBlock, perisMap);
     }
-  }
+  });
 
   return true;
 }
@@ -850,66 +885,82 @@ bool SvdDevice::CheckForItemsCluster(const list<SvdItem*> &childs)
 
 bool SvdDevice::CheckForItemsPeri(const list<SvdItem*> &childs)
 {
+  vector<SvdPeripheral*> peris;
   for(const auto child : childs) {
     const auto peri = dynamic_cast<SvdPeripheral*>(child);
     if(!peri || !peri->IsValid()) {
       continue;
     }
 
-    uint32_t itemCnt = 0;
-
-    const auto regCont = peri->GetRegisterContainer();
-    if(regCont) {
-      const auto& regChilds = regCont->GetChildren();
-      for(const auto regChild : regChilds) {
-        const auto clust = dynamic_cast<SvdCluster*>(regChild);
-        if(clust && clust->IsValid()) {
-          const auto& subChilds = clust->GetChildren();
-          const auto dim = clust->GetDimension();
-          if(dim) {
-            //if(dim->GetExpression()->GetType() == SvdTypes::Expression::EXTEND) {
-              const auto& dimChilds = dim->GetChildren();
-              for(const auto dimChild : dimChilds) {
-                SvdCluster* dimClust = dynamic_cast<SvdCluster*>(dimChild);
-                if(!dimClust || !dimClust->IsValid()) {
-                  continue;
-                }
-
-                const auto& dimClustChilds = dimClust->GetChildren();
-                CheckForItemsCluster(dimClustChilds);
+    peris.push_back(peri);
+  }
+
+  ForEachPeripheral(peris, [&](SvdPeripheral* peri) {
+    CheckForItemsPeri(peri);
+  });
+
+  return true;
+}
+
+bool SvdDevice::CheckForItemsPeri(SvdPeripheral* peri)
+{
+  if(!peri) {
+    return true;
+  }
+
+  uint32_t itemCnt = 0;
+
+  const auto regCont = peri->GetRegisterContainer();
+  if(regCont) {
+    const auto& regChilds = regCont->GetChildren();
+    for(const auto regChild : regChilds) {
+      const auto clust = dynamic_cast<SvdCluster*>(regChild);
+      if(clust && clust->IsValid()) {
+        const auto& subChilds = clust->GetChildren();
+        const auto dim = clust->GetDimension();
+        if(dim) {
+          //if(dim->GetExpression()->GetType() == SvdTypes::Expression::EXTEND) {
+            const auto& dimChilds = dim->GetChildren();
+            for(const auto dimChild : dimChilds) {
+              SvdCluster* dimClust = dynamic_cast<SvdCluster*>(dimChild);
+              if(!dimClust || !dimClust->IsValid()) {
+                continue;
               }
-            //}
-          }
 
-          if(CheckForItemsCluster(subChilds)) {
-            itemCnt++;
-          }
-          else {
-            const auto name = clust->GetNameCalculated();
-            const auto lineNo = clust->GetLineNumber();
-            const auto& svdLevelStr = GetSvdLevelStr(clust->GetSvdLevel());
-            LogMsg("M234", LEVEL(svdLevelStr), NAME(name), lineNo);
-            clust->Invalidate();
-          }
+              const auto& dimClustChilds = dimClust->GetChildren();
+              CheckForItemsCluster(dimClustChilds);
+            }
+          //}
         }
 
-        const auto reg = dynamic_cast<SvdRegister*>(regChild);
-        if(reg && reg->IsValid()) {
+        if(CheckForItemsCluster(subChilds)) {
           itemCnt++;
-          CheckForItemsRegister(reg);
+        }
+        else {
+          const auto name = clust->GetNameCalculated();
+          const auto lineNo = clust->GetLineNumber();
+          const auto& svdLevelStr = GetSvdLevelStr(clust->GetSvdLevel());
+          LogMsg("M234", LEVEL(svdLevelStr), NAME(name), lineNo);
+          clust->Invalidate();
         }
       }
-    }
 
-    if(!itemCnt) {
-      const string name = peri->GetNameCalculated();
-      const auto lineNo = peri->GetLineNumber();
-      const auto& svdLevelStr = GetSvdLevelStr(peri->GetSvdLevel());
-      LogMsg("M234", LEVEL(svdLevelStr), NAME(name), lineNo);
-      peri->Invalidate();
+      const auto reg = dynamic_cast<SvdRegister*>(regChild);
+      if(reg && reg->IsValid()) {
+        itemCnt++;
+        CheckForItemsRegister(reg);
+      }
     }
   }
 
+  if(!itemCnt) {
+    const string name = peri->GetNameCalculated();
+    const auto lineNo = peri->GetLineNumber();
+    const auto& svdLevelStr = GetSvdLevelStr(peri->GetSvdLevel());
+    LogMsg("M234", LEVEL(svdLevelStr), NAME(name), lineNo);
+    peri->Invalidate();
+  }
+
   return true;
 }
 
@@ -58,6 +58,21 @@ SvdDimension::~SvdDimension()
 {
 }
 
+bool SvdDimension::SetDimName(const string& dimName)
+{
+  const auto item = GetParent();
+  if(!item || !item->IsInParentIndex()) {
+    m_dimName = dimName;
+    return true;
+  }
+
+  const auto deriveName = item->GetDeriveName();
+  m_dimName = dimName;
+  item->GetParent()->UpdateChildIndex(item, deriveName);    // derive name of the dim item changes
+
+  return true;
+}
+
 bool SvdDimension::InitAllowedTags()
 {
   if(!m_allowedTagsDim.empty()) {
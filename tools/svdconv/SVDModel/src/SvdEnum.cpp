@@ -15,7 +15,8 @@ using namespace std;
 SvdEnumContainer::SvdEnumContainer(SvdItem* parent):
   SvdItem(parent),
   m_defaultValue(0),
-  m_enumUsage(SvdTypes::EnumUsage::UNDEF)
+  m_enumUsage(SvdTypes::EnumUsage::UNDEF),
+  m_bChecked(false)
 {
   const auto svdLevel = parent->GetSvdLevel();
   if(svdLevel == L_Peripheral || svdLevel == L_Register || svdLevel == L_Cluster) {
@@ -95,6 +96,32 @@ bool SvdEnumContainer::CopyItem(SvdItem *from)
   return SvdItem::CopyItem(from);
 }
 
+/*** Shared enumerated values
+ * A copied field references a container instead of copying it, if the container is checked by its field
+ * and a copy would be the same: all values are valid and no property is set that CopyItem() does not copy.
+ ***/
+bool SvdEnumContainer::IsShareable()
+{
+  if(!m_bChecked || !IsValid() || m_defaultValue || !m_headerEnumName.empty() || GetDerivedFrom() || GetDimension()) {
+    return false;
+  }
+
+  const auto& childs = GetChildren();
+  for(const auto child : childs) {
+    const auto enu = dynamic_cast<SvdEnum*>(child);
+    if(!enu || !enu->IsValid() || enu->GetDerivedFrom() || enu->GetDimension() || enu->GetChildCount()) {
+      return false;
+    }
+
+    const auto val = enu->GetValue();
+    if(val.bValid && val.u64 > 0xffffffff) {     // SvdEnum::CopyItem() copies 32 bit values
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool SvdEnumContainer::CheckItem()
 {
   const auto& headerEnumName = GetHeaderEnumName();
@@ -628,5 +628,12 @@ bool SvdField::CheckItem()
     }
   }
 
+  for(const auto enumCont : enumConts) {
+    const auto cont = dynamic_cast<SvdEnumContainer*>(enumCont);
+    if(cont) {
+      cont->SetChecked();
+    }
+  }
+
   return SvdItem::CheckItem();
 }
@@ -13,10 +13,16 @@
 #include "SvdRegister.h"
 #include "SvdPeripheral.h"
 #include "SvdCluster.h"
+#include "SvdDevice.h"
 #include "SvdAddressBlock.h"
 #include "SvdDimension.h"
 #include "SvdTypes.h"
 
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 using namespace std;
 
 #define DEFAULT_BITWIDTH     32
@@ -112,9 +118,10 @@ SvdItem::SvdItem(SvdItem* parent):
   m_svdLevel(L_UNDEF),
   m_bitWidth(SvdItem::VALUE32_NOT_INIT),
   m_dimElementIndex(SvdItem::VALUE32_NOT_INIT),
+  m_shareCount(0),
   m_modified(false),
-  m_bUsedForCExpression(false),
-  m_protection(SvdTypes::ProtectionType::UNDEF)
+  m_protection(SvdTypes::ProtectionType::UNDEF),
+  m_childIndex(nullptr)
 {
 }
 
@@ -124,6 +131,20 @@ SvdItem::~SvdItem()
   delete m_dimension;     // Child items that are attached get deleted by ~SvdItem() !!!
 
   ClearChildren();
+  InvalidateChildIndex();
+}
+
+bool SvdItem::SetName(const string &name)
+{
+  if(!IsInParentIndex()) {
+    return SvdElement::SetName(name);
+  }
+
+  const auto deriveName = GetDeriveName();
+  SvdElement::SetName(name);
+  m_parent->UpdateChildIndex(this, deriveName);
+
+  return true;
 }
 
 bool SvdItem::SetDescription(const string &descr)
@@ -207,8 +228,6 @@ bool SvdItem::ProcessXmlChildren(XMLTreeElement* xmlElement)
 
 bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
 {
-  static uint32_t tagCnt=0;
-
   // default inserts element's text as attribute
 	const auto& tag = xmlElement->GetTag();
 	const auto& value = xmlElement->GetText();
@@ -256,8 +275,9 @@ bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
     }
     return dimension->Construct(xmlElement);
   }
-  else {    // report "Tag unknown"
-    if(tagCnt++ < 10) {
+  else {    // report "Tag unknown", at most 10 times per device
+    const auto device = GetDevice();
+    if(!device || device->CountUnknownTag() < 10) {
       LogMsg("M201", TAG(tag), lineNo);
     }
   }
@@ -343,6 +363,23 @@ void SvdItem::AddItem(SvdItem* item)
   }
 
   m_children.push_back(item);
+  if(m_childIndex) {
+    AddToChildIndex(item, m_children.size() - 1);
+  }
+}
+
+// item is referenced, but not owned: the last one clearing its children deletes it
+void SvdItem::AddSharedItem(SvdItem* item)
+{
+  if(!item) {
+    return;
+  }
+
+  item->m_shareCount++;
+  m_children.push_back(item);
+  if(m_childIndex) {
+    AddToChildIndex(item, m_children.size() - 1);
+  }
 }
 
 void SvdItem::ClearChildren()
@@ -352,10 +389,16 @@ void SvdItem::ClearChildren()
   }
 
   for(auto child : m_children) {
+    if(child->m_shareCount) {
+      child->m_shareCount--;
+      continue;
+    }
+
     delete child;
   }
 
   m_children.clear();
+  InvalidateChildIndex();
 }
 
 string SvdItem::GetHeaderTypeNameCalculated()
@@ -520,6 +563,26 @@ string SvdItem::GetHierarchicalName()
   return name;
 }
 
+// hierarchical name of this item as child of an item with the given hierarchical name,
+// used for shared items whose parent is the item they were first created for
+string SvdItem::GetHierarchicalName(const string &parentName)
+{
+  string name = parentName;
+  const auto itemName = GetNameCalculated();
+  if(!itemName.empty()) {
+    if(!name.empty()) name += "_";
+    name += itemName;
+  }
+
+  const string altGrpName = GetAlternateGroup();
+  if(!altGrpName.empty()) {
+    name += "_";
+    name += altGrpName;
+  }
+
+  return name;
+}
+
 string SvdItem::TryGetHeaderStructName(SvdItem *item)
 {
   switch(item->GetSvdLevel()) {
@@ -626,7 +689,14 @@ SvdDerivedFrom* SvdItem::GetDerivedFrom()
 
 bool SvdItem::SetDimension(SvdDimension *dimension)
 {
+  if(!IsInParentIndex()) {
+    m_dimension = dimension;
+    return true;
+  }
+
+  const auto deriveName = GetDeriveName();
   m_dimension = dimension;
+  m_parent->UpdateChildIndex(this, deriveName);
 
   return true;
 }
@@ -827,7 +897,7 @@ bool SvdItem::FindChild (SvdItem *&item, const string &name)
   return FindChild(m_children, item, name);
 }
 
-bool SvdItem::FindChild (const list<SvdItem*> childs, SvdItem *&item, const string &name)
+bool SvdItem::FindChild (const list<SvdItem*>& childs, SvdItem *&item, const string &name)
 {
   if(FindChildFromItem(item, name)) {
     return true;
@@ -837,6 +907,10 @@ bool SvdItem::FindChild (const list<SvdItem*> childs, SvdItem *&item, const stri
     return false;
   }
 
+  if(&childs == &m_children) {
+    return FindChildFromIndex(item, name);
+  }
+
   for(const auto child : childs) {
     if(!child) {
       continue;
@@ -859,6 +933,11 @@ bool SvdItem::FindChildFromItem (SvdItem *&item, const string &name)
     return true;
   }
 
+  return FindChildFromDim(item, name);
+}
+
+bool SvdItem::FindChildFromDim (SvdItem *&item, const string &name)
+{
   // search dim items
   const auto dimension = GetDimension();
   if(dimension) {
@@ -882,6 +961,105 @@ bool SvdItem::FindChildFromItem (SvdItem *&item, const string &name)
   return false;
 }
 
+/*** Child index ******************************************************************
+ * Same result as searching the children in list order: the first child with the
+ * derive name is found, unless a child before it contains the name in its dim items.
+ */
+struct SvdChildIndex {
+  unordered_map<string, pair<size_t, SvdItem*> > names;      // derive name to first child with this name and its position
+  vector<pair<size_t, SvdItem*> >                 dimChilds;  // children with dim items, sorted by position
+  unordered_map<const SvdItem*, size_t>           positions;  // position of each indexed child
+};
+
+void SvdItem::AddToChildIndex (SvdItem* child, size_t pos)
+{
+  if(!child) {
+    return;
+  }
+
+  m_childIndex->positions[child] = pos;
+  const auto deriveName = child->GetDeriveName();
+  if(!deriveName.empty()) {
+    const auto [it, inserted] = m_childIndex->names.emplace(deriveName, make_pair(pos, child));
+    if(!inserted && pos < it->second.first) {
+      it->second = make_pair(pos, child);   // keep the first child with this name
+    }
+  }
+  if(child->GetDimension()) {
+    auto& dimChilds = m_childIndex->dimChilds;
+    const auto it = lower_bound(dimChilds.begin(), dimChilds.end(), make_pair(pos, (SvdItem*)nullptr));
+    if(it == dimChilds.end() || it->first != pos) {
+      dimChilds.emplace(it, pos, child);
+    }
+  }
+}
+
+bool SvdItem::FindChildFromIndex (SvdItem *&item, const string &name)
+{
+  if(!m_childIndex) {
+    m_childIndex = new SvdChildIndex;
+    size_t pos = 0;
+    for(const auto child : m_children) {
+      AddToChildIndex(child, pos++);
+    }
+  }
+
+  const auto it = m_childIndex->names.find(name);
+  const auto namePos = it != m_childIndex->names.end() ? it->second.first : m_children.size();
+  for(const auto& [pos, child] : m_childIndex->dimChilds) {
+    if(pos >= namePos) {
+      break;
+    }
+
+    if(child->FindChildFromDim(item, name)) {
+      return true;
+    }
+  }
+
+  if(it == m_childIndex->names.end()) {
+    return false;
+  }
+
+  item = it->second.second;
+  return true;
+}
+
+void SvdItem::InvalidateChildIndex()
+{
+  delete m_childIndex;
+  m_childIndex = nullptr;
+}
+
+// items are added to the parent before they get named and dimensioned
+void SvdItem::UpdateChildIndex(SvdItem* child, const string &oldDeriveName)
+{
+  if(!m_childIndex) {
+    return;
+  }
+
+  const auto it = m_childIndex->positions.find(child);
+  if(it == m_childIndex->positions.end()) {
+    return;
+  }
+
+  if(child->GetDeriveName() == oldDeriveName) {
+    return;
+  }
+
+  const auto nameIt = m_childIndex->names.find(oldDeriveName);
+  if(nameIt != m_childIndex->names.end() && nameIt->second.second == child) {
+    InvalidateChildIndex();     // a later child with the old name is not indexed
+    return;
+  }
+
+  AddToChildIndex(child, it->second);
+}
+
+bool SvdItem::IsInParentIndex()
+{
+  return m_parent && m_parent->m_childIndex && m_parent->m_childIndex->positions.count(this);
+}
+
 bool SvdItem::CalculateDim()
 {
   return true;
@@ -938,6 +1116,13 @@ bool SvdItem::CopyChilds(SvdItem *from, SvdItem *hook)
 
     // Container
     if(lv == L_EnumeratedValues) {      // more <enumeratedValues> containers can be set!
+      // checked containers are shared, a derived field keeps own copies as it can change bitWidth or add containers
+      const auto enumCont = dynamic_cast<SvdEnumContainer*>(copy);
+      if(enumCont && enumCont->IsShareable() && !hook->GetDerivedFrom()) {
+        hook->AddSharedItem(enumCont);
+        continue;
+      }
+
       const auto nItem = new SvdEnumContainer(hook);
       hook->AddItem(nItem);
       CopyChilds(copy, nItem);
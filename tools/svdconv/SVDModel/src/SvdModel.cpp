@@ -15,7 +15,8 @@ using namespace std;
 SvdModel::SvdModel(SvdItem* parent):
   SvdItem(parent),
   m_device(nullptr),
-  m_showMissingEnums(false)
+  m_showMissingEnums(false),
+  m_jobs(0)
 {
   SetSvdLevel(L_Device);
 }
@@ -84,7 +84,6 @@ SvdPeripheral::SvdPeripheral(SvdItem* parent):
   m_enumContainer(nullptr),
   m_disableCondition(nullptr),
   m_hasAnnonUnions(false),
-  m_calcSize(0),
   m_resetValue(std::nullopt),
   m_resetMask(std::nullopt),
   m_access(SvdTypes::Access::UNDEF)
@@ -312,33 +311,6 @@ string SvdPeripheral::GetHeaderTypeName()
   return SvdUtils::EMPTY_STRING;
 }
 
-uint32_t SvdPeripheral::GetSize()
-{
-  if(!m_calcSize) {
-    if(!IsModified()) {
-      const auto copiedFrom = GetCopiedFrom();
-      if(copiedFrom) {
-        return copiedFrom->GetSize();
-      }
-      const auto derivedFrom = GetDerivedFrom();
-      if(derivedFrom) {
-        const auto item = derivedFrom->GetDerivedFromItem();
-        if(item) {
-          return item->GetSize();
-        }
-      }
-    }
-  }
-  return m_calcSize;
-}
-
-uint32_t SvdPeripheral::SetSize(uint32_t size)
-{
-  m_calcSize = size;
-
-  return true;
-}
-
 string SvdPeripheral::GetNameCalculated()
 {
   auto name = SvdItem::GetNameCalculated();
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "FileIo.h"
+
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+class FileIoUnitTests : public ::testing::Test {
+protected:
+  void SetUp() override {
+    m_fileName = (filesystem::temp_directory_path() / "FileIoUnitTests.h").generic_string();
+  }
+  void TearDown() override {
+    error_code ec;
+    filesystem::remove(m_fileName, ec);
+  }
+
+  // file content written after the generated file description
+  string ReadBody() {
+    ifstream file(m_fileName, ios::binary);
+    stringstream buf;
+    buf << file.rdbuf();
+    const string content = buf.str();
+    const auto pos = content.find(" */\n");
+    return pos == string::npos? content : content.substr(pos + 4);
+  }
+
+  string m_fileName;
+};
+
+TEST_F(FileIoUnitTests, ConvertTab) {
+  FileIo fileIo;
+  ASSERT_TRUE(fileIo.Create(m_fileName));
+  fileIo.WriteText("abcde\r\t\t\t\tX\n");
+  // same line split across writes
+  fileIo.WriteText("abc");
+  fileIo.WriteText("de\r\t\t");
+  fileIo.WriteText("\t\tX\n");
+  fileIo.WriteChar('\t');
+  fileIo.WriteLine("%s", "Y");
+  fileIo.Close();
+
+  EXPECT_EQ("abcde X\nabcde X\nY\n\n", ReadBody());
+}
+
+TEST_F(FileIoUnitTests, WriteLongLines) {
+  const string longText(4000, 'a');
+  FileIo fileIo;
+  ASSERT_TRUE(fileIo.Create(m_fileName));
+  fileIo.WriteLine("%s:%d", longText.c_str(), 42);
+  fileIo.WriteFormat("{}:{}\n", longText, 43);
+  fileIo.Close();
+
+  EXPECT_EQ(longText + ":42\n" + longText + ":43\n\n", ReadBody());
+}
+
+TEST_F(FileIoUnitTests, Flush) {
+  const string line = string(99, 'b') + "\n";
+  FileIo fileIo;
+  ASSERT_TRUE(fileIo.Create(m_fileName));
+  string expected;
+  for(int i = 0; i < (3 * FILE_BUF_SIZE) / 100; i++) {
+    fileIo.WriteText(line);
+    expected += line;
+  }
+  fileIo.Close();
+
+  EXPECT_EQ(expected + "\n", ReadBody());
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdItem.h"
+#include "SvdDimension.h"
+
+#include "gtest/gtest.h"
+#include <string>
+
+using namespace std;
+
+static SvdItem* AddChild(SvdItem* parent, const string& name)
+{
+  const auto child = new SvdItem(parent);
+  parent->AddItem(child);
+  child->SetName(name);
+  return child;
+}
+
+TEST(SvdItemUnitTests, FindChild_FirstWithName) {
+  SvdItem parent(nullptr);
+  const auto a = AddChild(&parent, "A");
+  AddChild(&parent, "B");
+  AddChild(&parent, "A");
+
+  SvdItem* item = nullptr;
+  ASSERT_TRUE(parent.FindChild(item, "A"));
+  EXPECT_EQ(a, item);
+  EXPECT_FALSE(parent.FindChild(item, "C"));
+}
+
+TEST(SvdItemUnitTests, FindChild_AfterChanges) {
+  SvdItem parent(nullptr);
+  const auto a = AddChild(&parent, "A");
+  const auto b = AddChild(&parent, "B");
+
+  SvdItem* item = nullptr;
+  ASSERT_TRUE(parent.FindChild(item, "B"));
+  EXPECT_EQ(b, item);
+
+  // child added to the parent before it is named
+  const auto c = AddChild(&parent, "");
+  EXPECT_FALSE(parent.FindChild(item, "C"));
+  c->SetName("C");
+  ASSERT_TRUE(parent.FindChild(item, "C"));
+  EXPECT_EQ(c, item);
+
+  // renamed child: a later child with the old name is found
+  const auto b2 = AddChild(&parent, "B");
+  b->SetName("B0");
+  ASSERT_TRUE(parent.FindChild(item, "B"));
+  EXPECT_EQ(b2, item);
+  ASSERT_TRUE(parent.FindChild(item, "B0"));
+  EXPECT_EQ(b, item);
+
+  // renamed child before the first one with the new name
+  a->SetName("C");
+  ASSERT_TRUE(parent.FindChild(item, "C"));
+  EXPECT_EQ(a, item);
+  EXPECT_FALSE(parent.FindChild(item, "A"));
+
+  parent.ClearChildren();
+  EXPECT_FALSE(parent.FindChild(item, "C"));
+}
+
+TEST(SvdItemUnitTests, FindChild_DimItems) {
+  SvdItem parent(nullptr);
+  const auto array = AddChild(&parent, "X%s");
+  const auto dim = new SvdDimension(array);
+  array->SetDimension(dim);
+  const auto x0 = new SvdItem(dim);
+  dim->AddItem(x0);
+  x0->SetName("X0");
+  AddChild(&parent, "X0");
+
+  // dim items of a child are searched before later children
+  SvdItem* item = nullptr;
+  ASSERT_TRUE(parent.FindChild(item, "X0"));
+  EXPECT_EQ(x0, item);
+  ASSERT_TRUE(parent.FindChild(item, "X%s"));
+  EXPECT_EQ(array, item);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdModel.h"
+#include "SvdDevice.h"
+#include "SvdEnum.h"
+#include "XMLTreeSlim.h"
+#include "ErrLog.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// device with peripheral types and instances derived from them, every field has enumerated values
+static string CreateSvd(int types, int instances)
+{
+  const int registers = 8;
+  const int fields = 8;
+  const int enums = 4;
+  string svd = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+    "<device schemaVersion=\"1.3\">\n"
+    "<vendor>ARM Ltd.</vendor><vendorID>ARM</vendorID><name>BENCH</name><series>ARMCM33</series><version>1.0</version>\n"
+    "<description>Benchmark device</description>\n"
+    "<cpu><name>CM33</name><revision>r0p0</revision><endian>little</endian><mpuPresent>true</mpuPresent><fpuPresent>true</fpuPresent>"
+    "<vtorPresent>true</vtorPresent><nvicPrioBits>3</nvicPrioBits><vendorSystickConfig>false</vendorSystickConfig></cpu>\n"
+    "<addressUnitBits>8</addressUnitBits><width>32</width><size>32</size><access>read-write</access>"
+    "<resetValue>0x00000000</resetValue><resetMask>0xFFFFFFFF</resetMask>\n"
+    "<peripherals>\n";
+
+  uint32_t base = 0x40000000;
+  for(int t = 0; t < types; t++) {
+    const string type = "TYPE" + to_string(t);
+    svd += "<peripheral><name>" + type + "</name><description>Peripheral " + type + "</description>"
+      "<baseAddress>" + to_string(base) + "</baseAddress>"
+      "<addressBlock><offset>0</offset><size>0x1000</size><usage>registers</usage></addressBlock><registers>\n";
+    for(int r = 0; r < registers; r++) {
+      const string reg = type + "_R" + to_string(r);
+      svd += "<register><name>" + reg + "</name><description>Register " + reg + "</description>"
+        "<addressOffset>" + to_string(r * 4) + "</addressOffset><fields>\n";
+      for(int f = 0; f < fields; f++) {
+        const string field = reg + "_F" + to_string(f);
+        svd += "<field><name>" + field + "</name><description>Field " + field + "</description>"
+          "<bitOffset>" + to_string(f * 4) + "</bitOffset><bitWidth>4</bitWidth><enumeratedValues>";
+        for(int e = 0; e < enums; e++) {
+          const string value = field + "_V" + to_string(e);
+          svd += "<enumeratedValue><name>" + value + "</name><description>Value " + value + "</description>"
+            "<value>" + to_string(e) + "</value></enumeratedValue>";
+        }
+        svd += "</enumeratedValues></field>\n";
+      }
+      svd += "</fields></register>\n";
+    }
+    svd += "</registers></peripheral>\n";
+    base += 0x1000;
+
+    for(int i = 0; i < instances; i++) {
+      svd += "<peripheral derivedFrom=\"" + type + "\"><name>" + type + "_I" + to_string(i) + "</name>"
+        "<baseAddress>" + to_string(base) + "</baseAddress></peripheral>\n";
+      base += 0x1000;
+    }
+  }
+  svd += "</peripherals>\n</device>\n";
+
+  return svd;
+}
+
+// enumerated values containers referenced by fields and the number of distinct ones
+static void CountEnumContainers(SvdItem* item, size_t& references, set<SvdItem*>& containers)
+{
+  for(const auto child : item->GetChildren()) {
+    if(dynamic_cast<SvdEnumContainer*>(child)) {
+      references++;
+      containers.insert(child);
+    } else {
+      CountEnumContainers(child, references, containers);
+    }
+  }
+}
+
+static void ConstructModel(benchmark::State& state, XMLTreeSlim& xmlTree, const string& fileName)
+{
+  for (auto _ : state) {
+    SvdModel model(nullptr);
+    model.SetInputFileName(fileName);
+    model.Construct(&xmlTree);
+    model.CalculateModel();
+    model.Validate();
+    benchmark::DoNotOptimize(model.GetDevice());
+    ErrLog::Get()->ClearLogMessages();
+  }
+
+  SvdModel model(nullptr);
+  model.SetInputFileName(fileName);
+  model.Construct(&xmlTree);
+  size_t references = 0;
+  set<SvdItem*> containers;
+  CountEnumContainers(&model, references, containers);
+  state.counters["enumContainers"] = (double)containers.size();
+  state.counters["enumContainerRefs"] = (double)references;
+  ErrLog::Get()->ClearLogMessages();
+}
+
+static void BM_ConstructModel(benchmark::State& state)
+{
+  XMLTreeSlim xmlTree;
+  if(!xmlTree.ParseString(CreateSvd((int)state.range(0), (int)state.range(1)))) {
+    state.SkipWithError("parsing SVD failed");
+    return;
+  }
+  ConstructModel(state, xmlTree, "BENCH.svd");
+}
+BENCHMARK(BM_ConstructModel)->Args({ 4, 8 })->Args({ 16, 32 })->Unit(benchmark::kMillisecond);
+
+static void BM_ConstructModelFile(benchmark::State& state, const string& fileName)
+{
+  XMLTreeSlim xmlTree;
+  xmlTree.AddFileName(fileName);
+  if(!xmlTree.ParseAll()) {
+    state.SkipWithError("parsing SVD failed");
+    return;
+  }
+  state.counters["fileSize"] = (double)filesystem::file_size(fileName);
+  ConstructModel(state, xmlTree, fileName);
+}
+
+// SVD files of the test data, largest first, followed by the SVD files given in
+// environment variable SVDCONV_BENCHMARK_SVD (a file or a folder, e.g. with vendor SVD files),
+// mapped to names relative to the folder
+static vector<pair<string, string> > GetSvdFiles()
+{
+  vector<pair<string, string> > files;
+  auto collect = [&files](const filesystem::path& path) {
+    error_code ec;
+    vector<filesystem::path> found;
+    if(filesystem::is_directory(path, ec)) {
+      for(const auto& entry : filesystem::recursive_directory_iterator(path, ec)) {
+        if(entry.is_regular_file() && entry.path().extension() == ".svd") {
+          found.push_back(entry.path());
+        }
+      }
+    } else if(filesystem::is_regular_file(path, ec)) {
+      found.push_back(path);
+    }
+    sort(found.begin(), found.end(), [](const filesystem::path& a, const filesystem::path& b) {
+      error_code ec;
+      return filesystem::file_size(a, ec) > filesystem::file_size(b, ec);
+    });
+    for(const auto& file : found) {
+      const auto name = file == path ? file.filename() : file.lexically_relative(path);
+      files.push_back({ name.generic_string(), file.generic_string() });
+    }
+  };
+  collect(string(TEST_FOLDER) + "data");
+  const char* benchmarkSvd = getenv("SVDCONV_BENCHMARK_SVD");
+  if(benchmarkSvd) {
+    collect(benchmarkSvd);
+  }
+  return files;
+}
+
+static const bool registerFileBenchmarks = []() {
+  for(const auto& [name, fileName] : GetSvdFiles()) {
+    benchmark::RegisterBenchmark(("BM_ConstructModelFile/" + name).c_str(), BM_ConstructModelFile, fileName)->Unit(benchmark::kMillisecond);
+  }
+  return true;
+}();
+
+// end of SvdModelBenchmark.cpp
@@ -9,6 +9,8 @@
 #include "SVDConv.h"
 #include "ErrLog.h"
 
+#include <nlohmann/json.hpp>
+
 #include <map>
 #include <list>
 #include <fstream>
@@ -16,6 +18,7 @@
 
 using namespace std;
 using namespace testing;
+using json = nlohmann::json;
 
 
 class SvdConvIntegTests : public ::testing::Test {
@@ -203,3 +206,139 @@ TEST_F(SvdConvIntegTests, CheckResetMask) {
   }
 }
 
+// Validate that parallel checks and generators give the same result as sequential ones
+TEST_F(SvdConvIntegTests, CheckJobs) {
+  const string& inFile = SvdConvIntegTestEnv::localtestdata_dir + "/parallelCheck/MultiPeripheral.svd";
+  const string testOut = SvdConvIntegTestEnv::testoutput_dir + "/parallelCheck";
+  ASSERT_TRUE(RteFsUtils::Exists(inFile));
+
+  struct Result {
+    int exitCode;
+    list<string> messages;
+    map<string, string> files;
+  };
+
+  auto runSvdConv = [&](const string& jobs) {
+    Arguments args("SVDConv.exe", inFile);
+    args.add({ "-o", testOut, "--generate=header", "--generate=sfd", "--fields=struct", "--create-folder" });
+    args.add({ "-j", jobs });
+
+    Result result;
+    SvdConv svdConv;
+    result.exitCode = svdConv.Check(args, args, nullptr);
+    result.messages = ErrLog::Get()->GetLogMessages();
+    result.messages.remove_if([](const string& msg) {
+      return msg.find("Arguments:") == 0;    // contains the number of jobs
+    });
+    ErrLog::Get()->ClearLogMessages();
+
+    // generation and modification time lines of the file headers differ between runs
+    const regex timeLine(" \\* .*\\w{3} \\w{3} [ \\d]\\d \\d{2}:\\d{2}:\\d{2} \\d{4}\r?\n");
+    for(const string fileName : { "MultiPeripheral.h", "MultiPeripheral.sfd" }) {
+      string buf;
+      EXPECT_TRUE(RteFsUtils::ReadFile(testOut + "/" + fileName, buf));
+      result.files[fileName] = regex_replace(buf, timeLine, "");
+      RteFsUtils::RemoveFile(testOut + "/" + fileName);
+    }
+    return result;
+  };
+
+  const Result sequential = runSvdConv("1");
+  EXPECT_EQ(2, sequential.exitCode);
+  int errCnt = 0, warnCnt = 0;
+  for(const string& msg : sequential.messages) {
+    if(msg.find("*** ERROR") != string::npos) {
+      errCnt++;
+    }
+    if(msg.find("*** WARNING") != string::npos) {
+      warnCnt++;
+    }
+  }
+  EXPECT_EQ(2, errCnt);
+  EXPECT_EQ(5, warnCnt);
+  EXPECT_FALSE(sequential.files.at("MultiPeripheral.h").empty());
+  EXPECT_FALSE(sequential.files.at("MultiPeripheral.sfd").empty());
+
+  const Result parallel = runSvdConv("4");
+  EXPECT_EQ(sequential.exitCode, parallel.exitCode);
+  EXPECT_EQ(sequential.messages, parallel.messages);
+  EXPECT_EQ(sequential.files, parallel.files);
+}
+
+// Validate --batch with a list file and --batch-summary
+TEST_F(SvdConvIntegTests, CheckBatchListFile) {
+  const string resetMask = SvdConvIntegTestEnv::localtestdata_dir + "/ResetMask/ResetMask.svd";
+  const string sauOk = SvdConvIntegTestEnv::localtestdata_dir + "/sauConfig/SSE300_ok.svd";
+  const string testOut = SvdConvIntegTestEnv::testoutput_dir + "/batchList";
+  const string listFile = testOut + "/svdfiles.txt";
+  const string summaryFile = testOut + "/summary.json";
+  ASSERT_TRUE(RteFsUtils::CreateTextFile(listFile, "# SVD files\n" + resetMask + "\n\n  " + sauOk + "\n"));
+
+  Arguments args("SVDConv.exe");
+  args.add({ "--batch", listFile, "--batch-summary", summaryFile });
+
+  SvdConv svdConv;
+  EXPECT_EQ(1, svdConv.Check(args, args, nullptr));
+
+  string buf;
+  ASSERT_TRUE(RteFsUtils::ReadFile(summaryFile, buf));
+  const json summary = json::parse(buf);
+  ASSERT_EQ(2, summary["files"].size());
+
+  const json& resetMaskSummary = summary["files"][0];
+  EXPECT_EQ(resetMask, resetMaskSummary["file"]);
+  EXPECT_EQ("warning", resetMaskSummary["result"]);
+  EXPECT_EQ(0, resetMaskSummary["errors"]);
+  EXPECT_EQ(1, resetMaskSummary["warnings"]);
+  ASSERT_EQ(1, resetMaskSummary["messages"].size());
+  const json& message = resetMaskSummary["messages"][0];
+  EXPECT_EQ("M302", message["id"]);
+  EXPECT_EQ("warning", message["level"]);
+  EXPECT_EQ(51, message["line"]);
+  EXPECT_EQ("Size of Register 'TIMER2:65' must be 8, 16 or 32 Bits", message["text"]);
+
+  const json& sauOkSummary = summary["files"][1];
+  EXPECT_EQ(sauOk, sauOkSummary["file"]);
+  EXPECT_EQ("ok", sauOkSummary["result"]);
+  EXPECT_TRUE(sauOkSummary["messages"].empty());
+
+  EXPECT_EQ(0, summary["errors"]);
+  EXPECT_EQ(1, summary["warnings"]);
+}
+
+// Validate --batch with a wild card pattern
+TEST_F(SvdConvIntegTests, CheckBatchWildcard) {
+  const string testOut = SvdConvIntegTestEnv::testoutput_dir + "/batchWildcard";
+  const string summaryFile = testOut + "/summary.json";
+
+  Arguments args("SVDConv.exe");
+  args.add({ "--batch", SvdConvIntegTestEnv::localtestdata_dir + "/sauConfig/SSE300_*.svd" });
+  args.add({ "-o", testOut, "--generate=partition", "--create-folder" });
+  args.add({ "--batch-summary", summaryFile });
+
+  SvdConv svdConv;
+  EXPECT_EQ(2, svdConv.Check(args, args, nullptr));
+
+  string buf;
+  ASSERT_TRUE(RteFsUtils::ReadFile(summaryFile, buf));
+  const json summary = json::parse(buf);
+  ASSERT_EQ(2, summary["files"].size());
+
+  // files are sorted by name
+  const json& errsSummary = summary["files"][0];
+  EXPECT_EQ(SvdConvIntegTestEnv::localtestdata_dir + "/sauConfig/SSE300_errs.svd", errsSummary["file"]);
+  EXPECT_EQ("error", errsSummary["result"]);
+  map<string, int> cnt;
+  for(const auto& message : errsSummary["messages"]) {
+    if(message["level"] == "error") {
+      cnt[message["id"]]++;
+    }
+  }
+  EXPECT_EQ(2, cnt["M219"]);
+  EXPECT_EQ(1, cnt["M364"]);
+
+  const json& okSummary = summary["files"][1];
+  EXPECT_EQ(SvdConvIntegTestEnv::localtestdata_dir + "/sauConfig/SSE300_ok.svd", okSummary["file"]);
+  EXPECT_EQ("ok", okSummary["result"]);
+  EXPECT_EQ(errsSummary["errors"], summary["errors"]);
+}
@@ -284,3 +284,25 @@ TEST_F(SvdConvIntegTestsCmdParser, CheckSfdNameOverride) {
   EXPECT_TRUE(!name.empty());
   EXPECT_TRUE(ext.empty());
 }
+
+TEST_F(SvdConvIntegTestsCmdParser, CheckBatch) {
+  const string& inFile = SvdConvIntegTestEnv::localtestdata_dir + "/cmdlineParser/DisableCondTest.svd";
+  const string batch = SvdConvIntegTestEnv::localtestdata_dir + "/*/*.svd";
+
+  Arguments args("SVDConv.exe");
+  args.add({ "--batch", batch });
+
+  SvdOptions svdOptions;
+  ParseOptions parseOptions(svdOptions);
+  EXPECT_EQ(ParseOptions::Result::Ok, parseOptions.Parse(args, args));
+  EXPECT_EQ(batch, svdOptions.GetBatch());
+
+  // input file is rejected together with batch
+  Arguments argsInput("SVDConv.exe", inFile);
+  argsInput.add({ "--batch", batch });
+
+  SvdOptions svdOptionsInput;
+  ParseOptions parseOptionsInput(svdOptionsInput);
+  EXPECT_EQ(ParseOptions::Result::Error, parseOptionsInput.Parse(argsInput, argsInput));
+  EXPECT_TRUE(svdOptionsInput.GetBatch().empty());
+}